@@ -9,6 +9,9 @@ let package = Package(
         .library(
             name: "SimpleFeaturesWKT",
             targets: ["SimpleFeaturesWKT"]),
+        .library(
+            name: "SimpleFeaturesWKTSwift",
+            targets: ["SimpleFeaturesWKTSwift"]),
     ],
     dependencies: [
         .package(url: "https://github.com/ngageoint/simple-features-ios", from: "5.0.0"),
@@ -20,7 +23,18 @@ let package = Package(
                 .product(name: "SimpleFeatures", package: "simple-features-ios")
             ],
             path: "sf-wkt-ios",
-            publicHeadersPath: "include"
+            publicHeadersPath: "include",
+            linkerSettings: [
+                .linkedLibrary("z")
+            ]
+        ),
+        .target(
+            name: "SimpleFeaturesWKTSwift",
+            dependencies: [
+                "SimpleFeaturesWKT",
+                .product(name: "SimpleFeatures", package: "simple-features-ios")
+            ],
+            path: "sf-wkt-ios-swift"
         ),
         .testTarget(
             name: "SimpleFeaturesWKTTests",
@@ -34,6 +48,7 @@ let package = Package(
             name: "SimpleFeaturesWKTTestsSwift",
             dependencies: [
                 "SimpleFeaturesWKT",
+                "SimpleFeaturesWKTSwift",
                 "TestUtils"
             ],
             path: "sf-wkt-iosTests-swift"
@@ -0,0 +1,80 @@
+//
+//  SFWTFlatGeometry+Coordinates.swift
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+import Foundation
+import SimpleFeaturesWKT
+
+/**
+ * Flat geometry coordinate buffers without per point bridging
+ */
+extension SFWTFlatGeometry {
+
+    /**
+     * Number of coordinate values held directly by the geometry, numPoints
+     * * stride
+     */
+    public var coordinateCount: Int {
+        return Int(numPoints()) * Int(self.stride())
+    }
+
+    /**
+     * Access the coordinates held directly by the geometry without copying.
+     * The buffer is only valid within the closure.
+     *
+     * @param body
+     *            closure given the interleaved coordinate values
+     *
+     * @return closure result
+     */
+    public func withCoordinates<Result>(_ body: (UnsafeBufferPointer<Double>) throws -> Result) rethrows -> Result {
+        return try withExtendedLifetime(self) {
+            try body(UnsafeBufferPointer(start: coordinates(), count: coordinateCount))
+        }
+    }
+
+    /**
+     * Visit the coordinates of the geometry and each descendant geometry
+     * holding points, in pre-order, without copying. The buffers are only
+     * valid within the closure.
+     *
+     * @param body
+     *            closure given the interleaved coordinate values and stride
+     */
+    public func forEachCoordinateBuffer(_ body: (UnsafeBufferPointer<Double>, Int) throws -> Void) rethrows {
+        if numPoints() > 0 {
+            try withCoordinates { try body($0, Int(self.stride())) }
+        }
+        for index in 0..<numGeometries() {
+            try geometry(at: index).forEachCoordinateBuffer(body)
+        }
+    }
+
+    /**
+     * Copy the coordinates of the geometry and each descendant geometry, in
+     * pre-order, into a single array with a uniform stride. Use
+     * forEachCoordinateBuffer for geometries mixing dimensions.
+     *
+     * @return interleaved coordinate values and stride, nil when the parts
+     *         have different strides
+     */
+    public func coordinateArray() -> (values: ContiguousArray<Double>, stride: Int)? {
+        var values = ContiguousArray<Double>()
+        var stride: Int? = nil
+        var uniform = true
+        forEachCoordinateBuffer { buffer, partStride in
+            if stride == nil {
+                stride = partStride
+            } else if stride != partStride {
+                uniform = false
+            }
+            values.append(contentsOf: buffer)
+        }
+        return uniform ? (values, stride ?? Int(self.stride())) : nil
+    }
+
+}
@@ -0,0 +1,218 @@
+//
+//  SFWTGeometrySequence.swift
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+import Foundation
+import SimpleFeatures
+import SimpleFeaturesWKT
+
+/**
+ * Async sequence of the non empty geometries in well-known text. Geometries
+ * are read in batches on a background queue only when the consumer asks for
+ * the next geometry, so at most one batch is held ahead of the consumer.
+ * The sequence reads its text once; iterating again continues where the
+ * previous iteration stopped.
+ */
+public struct SFWTGeometrySequence: AsyncSequence {
+
+    public typealias Element = SFGeometry
+
+    /**
+     * Default number of geometries read per batch
+     */
+    public static let defaultBatchSize: Int = 256
+
+    private let source: SFWTBatchSource
+
+    private let batchSize: Int
+
+    /**
+     * Initializer
+     *
+     * @param text
+     *            well-known text
+     * @param limits
+     *            resource limits, nil for unlimited
+     * @param batchSize
+     *            geometries read per batch
+     */
+    public init(text: String, limits: SFWTReaderLimits? = nil, batchSize: Int = SFWTGeometrySequence.defaultBatchSize) {
+        self.init(reader: SFWTBatchReader(text: text), limits: limits, batchSize: batchSize)
+    }
+
+    /**
+     * Initializer for gzip, zlib or uncompressed text
+     *
+     * @param data
+     *            compressed or uncompressed well-known text
+     * @param limits
+     *            resource limits, nil for unlimited
+     * @param batchSize
+     *            geometries read per batch
+     */
+    public init(compressedData data: Data, limits: SFWTReaderLimits? = nil, batchSize: Int = SFWTGeometrySequence.defaultBatchSize) {
+        self.init(reader: SFWTBatchReader(compressedReader: SFWTCompressedGeometryReader(data: data)), limits: limits, batchSize: batchSize)
+    }
+
+    /**
+     * Initializer for a gzip, zlib or uncompressed text file
+     *
+     * @param path
+     *            file path
+     * @param limits
+     *            resource limits, nil for unlimited
+     * @param batchSize
+     *            geometries read per batch
+     */
+    public init(compressedPath path: String, limits: SFWTReaderLimits? = nil, batchSize: Int = SFWTGeometrySequence.defaultBatchSize) {
+        self.init(reader: SFWTBatchReader(compressedReader: SFWTCompressedGeometryReader(path: path)), limits: limits, batchSize: batchSize)
+    }
+
+    private init(reader: SFWTBatchReader, limits: SFWTReaderLimits?, batchSize: Int) {
+        reader.limits = limits
+        self.source = SFWTBatchSource(reader: reader)
+        self.batchSize = max(batchSize, 1)
+    }
+
+    public func makeAsyncIterator() -> AsyncIterator {
+        return AsyncIterator(source: source, batchSize: batchSize)
+    }
+
+    /**
+     * Geometry sequence iterator
+     */
+    public struct AsyncIterator: AsyncIteratorProtocol {
+
+        fileprivate let source: SFWTBatchSource
+
+        fileprivate let batchSize: Int
+
+        private var batch: [SFGeometry] = []
+
+        private var index: Int = 0
+
+        fileprivate init(source: SFWTBatchSource, batchSize: Int) {
+            self.source = source
+            self.batchSize = batchSize
+        }
+
+        public mutating func next() async throws -> SFGeometry? {
+            if index == batch.count {
+                batch = try await source.geometries(batchSize)
+                index = 0
+                if batch.isEmpty {
+                    return nil
+                }
+            }
+            let geometry = batch[index]
+            index += 1
+            return geometry
+        }
+
+    }
+
+}
+
+/**
+ * Async sequence of the non empty geometries in well-known text as flat
+ * geometries, for direct access to coordinate buffers. Each batch shares a
+ * new arena retained by its flat geometries.
+ */
+public struct SFWTFlatGeometrySequence: AsyncSequence {
+
+    public typealias Element = SFWTFlatGeometry
+
+    private let source: SFWTBatchSource
+
+    private let batchSize: Int
+
+    /**
+     * Initializer
+     *
+     * @param text
+     *            well-known text
+     * @param limits
+     *            resource limits, nil for unlimited
+     * @param batchSize
+     *            geometries read per batch
+     */
+    public init(text: String, limits: SFWTReaderLimits? = nil, batchSize: Int = SFWTGeometrySequence.defaultBatchSize) {
+        let reader = SFWTBatchReader(text: text)
+        reader.limits = limits
+        self.source = SFWTBatchSource(reader: reader)
+        self.batchSize = max(batchSize, 1)
+    }
+
+    public func makeAsyncIterator() -> AsyncIterator {
+        return AsyncIterator(source: source, batchSize: batchSize)
+    }
+
+    /**
+     * Flat geometry sequence iterator
+     */
+    public struct AsyncIterator: AsyncIteratorProtocol {
+
+        fileprivate let source: SFWTBatchSource
+
+        fileprivate let batchSize: Int
+
+        private var batch: [SFWTFlatGeometry] = []
+
+        private var index: Int = 0
+
+        fileprivate init(source: SFWTBatchSource, batchSize: Int) {
+            self.source = source
+            self.batchSize = batchSize
+        }
+
+        public mutating func next() async throws -> SFWTFlatGeometry? {
+            if index == batch.count {
+                batch = try await source.flatGeometries(batchSize)
+                index = 0
+                if batch.isEmpty {
+                    return nil
+                }
+            }
+            let geometry = batch[index]
+            index += 1
+            return geometry
+        }
+
+    }
+
+}
+
+/**
+ * Batch reader confined to a serial queue, reading off the calling task
+ */
+fileprivate final class SFWTBatchSource: @unchecked Sendable {
+
+    private let reader: SFWTBatchReader
+
+    private let queue = DispatchQueue(label: "mil.nga.sf.wkt.batch", qos: .userInitiated)
+
+    init(reader: SFWTBatchReader) {
+        self.reader = reader
+    }
+
+    func geometries(_ count: Int) async throws -> [SFGeometry] {
+        return try await withCheckedThrowingContinuation { continuation in
+            queue.async {
+                continuation.resume(with: Result { try self.reader.readBatch(withCount: UInt(count)) })
+            }
+        }
+    }
+
+    func flatGeometries(_ count: Int) async throws -> [SFWTFlatGeometry] {
+        return try await withCheckedThrowingContinuation { continuation in
+            queue.async {
+                continuation.resume(with: Result { try self.reader.readFlatBatch(withCount: UInt(count)) })
+            }
+        }
+    }
+
+}
@@ -0,0 +1,223 @@
+//
+//  SFWTArcLinearizer.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTArcLinearizer.h>
+
+int const SFWT_DEFAULT_SEGMENTS_PER_QUADRANT = 32;
+
+/**
+ * Maximum segments generated for a full circle by a tolerance
+ */
+static int const MAX_CIRCLE_SEGMENTS = 1 << 16;
+
+@implementation SFWTArcLinearizer
+
+-(instancetype) init{
+    return [self initWithSegmentsPerQuadrant:SFWT_DEFAULT_SEGMENTS_PER_QUADRANT];
+}
+
+-(instancetype) initWithSegmentsPerQuadrant: (int) segmentsPerQuadrant{
+    self = [super init];
+    if(self != nil){
+        _segmentsPerQuadrant = MAX(segmentsPerQuadrant, 1);
+        _maxDeviation = 0;
+        _maxAngle = 0;
+    }
+    return self;
+}
+
+-(instancetype) initWithMaxDeviation: (double) maxDeviation{
+    self = [self init];
+    if(self != nil){
+        _maxDeviation = maxDeviation;
+    }
+    return self;
+}
+
+-(void) linearizeArcWithStart: (const double *) start andMiddle: (const double *) middle andEnd: (const double *) end usingBlock: (void (^)(const double *point)) block{
+
+    double ax = start[0], ay = start[1];
+    double bx = middle[0], by = middle[1];
+    double cx = end[0], cy = end[1];
+
+    double centerX, centerY;
+    double sweepToMiddle, sweep;
+
+    if(ax == cx && ay == cy){
+
+        // Full circle, the middle point is diametrically opposite
+        centerX = (ax + bx) / 2.0;
+        centerY = (ay + by) / 2.0;
+        sweepToMiddle = M_PI;
+        sweep = 2.0 * M_PI;
+
+    }else{
+
+        double d = 2.0 * (ax * (by - cy) + bx * (cy - ay) + cx * (ay - by));
+        double scale = fabs(ax * (by - cy)) + fabs(bx * (cy - ay)) + fabs(cx * (ay - by));
+        if(d == 0.0 || fabs(d) <= 1e-12 * scale){
+            // Collinear
+            block(middle);
+            block(end);
+            return;
+        }
+
+        double a2 = ax * ax + ay * ay;
+        double b2 = bx * bx + by * by;
+        double c2 = cx * cx + cy * cy;
+        centerX = (a2 * (by - cy) + b2 * (cy - ay) + c2 * (ay - by)) / d;
+        centerY = (a2 * (cx - bx) + b2 * (ax - cx) + c2 * (bx - ax)) / d;
+
+        double startAngle = atan2(ay - centerY, ax - centerX);
+        BOOL counterClockwise = (bx - ax) * (cy - ay) - (by - ay) * (cx - ax) > 0;
+        sweepToMiddle = [SFWTArcLinearizer sweepFrom:startAngle to:atan2(by - centerY, bx - centerX) counterClockwise:counterClockwise];
+        sweep = [SFWTArcLinearizer sweepFrom:startAngle to:atan2(cy - centerY, cx - centerX) counterClockwise:counterClockwise];
+
+    }
+
+    double radius = hypot(ax - centerX, ay - centerY);
+    double startAngle = atan2(ay - centerY, ax - centerX);
+    int segments = MAX(1, (int) ceil(fabs(sweep) / [self segmentAngleWithRadius:radius]));
+
+    double point[4];
+    for(int i = 1; i < segments; i++){
+        double angle = sweep * i / segments;
+        point[0] = centerX + radius * cos(startAngle + angle);
+        point[1] = centerY + radius * sin(startAngle + angle);
+        if(fabs(angle) <= fabs(sweepToMiddle)){
+            double fraction = angle / sweepToMiddle;
+            point[2] = start[2] + fraction * (middle[2] - start[2]);
+            point[3] = start[3] + fraction * (middle[3] - start[3]);
+        }else{
+            double fraction = (angle - sweepToMiddle) / (sweep - sweepToMiddle);
+            point[2] = middle[2] + fraction * (end[2] - middle[2]);
+            point[3] = middle[3] + fraction * (end[3] - middle[3]);
+        }
+        block(point);
+    }
+
+    block(end);
+}
+
++(void) expandBounds: (double *) bounds withArcStart: (const double *) start andMiddle: (const double *) middle andEnd: (const double *) end{
+    
+    const double *points[3] = {start, middle, end};
+    for(int i = 0; i < 3; i++){
+        bounds[0] = MIN(bounds[0], points[i][0]);
+        bounds[1] = MIN(bounds[1], points[i][1]);
+        bounds[2] = MAX(bounds[2], points[i][0]);
+        bounds[3] = MAX(bounds[3], points[i][1]);
+    }
+    
+    double ax = start[0], ay = start[1];
+    double bx = middle[0], by = middle[1];
+    double cx = end[0], cy = end[1];
+    
+    double centerX, centerY;
+    double sweep;
+    double startAngle;
+    BOOL counterClockwise = YES;
+    
+    if(ax == cx && ay == cy){
+        
+        // Full circle, the middle point is diametrically opposite
+        centerX = (ax + bx) / 2.0;
+        centerY = (ay + by) / 2.0;
+        startAngle = atan2(ay - centerY, ax - centerX);
+        sweep = 2.0 * M_PI;
+        
+    }else{
+        
+        double d = 2.0 * (ax * (by - cy) + bx * (cy - ay) + cx * (ay - by));
+        double scale = fabs(ax * (by - cy)) + fabs(bx * (cy - ay)) + fabs(cx * (ay - by));
+        if(d == 0.0 || fabs(d) <= 1e-12 * scale){
+            // Collinear, bounded by the points
+            return;
+        }
+        
+        double a2 = ax * ax + ay * ay;
+        double b2 = bx * bx + by * by;
+        double c2 = cx * cx + cy * cy;
+        centerX = (a2 * (by - cy) + b2 * (cy - ay) + c2 * (ay - by)) / d;
+        centerY = (a2 * (cx - bx) + b2 * (ax - cx) + c2 * (bx - ax)) / d;
+        
+        startAngle = atan2(ay - centerY, ax - centerX);
+        counterClockwise = (bx - ax) * (cy - ay) - (by - ay) * (cx - ax) > 0;
+        sweep = [SFWTArcLinearizer sweepFrom:startAngle to:atan2(cy - centerY, cx - centerX) counterClockwise:counterClockwise];
+        
+    }
+    
+    double radius = hypot(ax - centerX, ay - centerY);
+    
+    // Axis extremes at 0, 90, 180 and 270 degrees within the sweep
+    for(int quadrant = 0; quadrant < 4; quadrant++){
+        double angle = quadrant * M_PI_2;
+        if(fabs([SFWTArcLinearizer sweepFrom:startAngle to:angle counterClockwise:counterClockwise]) <= fabs(sweep)){
+            double x = centerX + radius * cos(angle);
+            double y = centerY + radius * sin(angle);
+            bounds[0] = MIN(bounds[0], x);
+            bounds[1] = MIN(bounds[1], y);
+            bounds[2] = MAX(bounds[2], x);
+            bounds[3] = MAX(bounds[3], y);
+        }
+    }
+    
+}
+
+/**
+ * Get the maximum angle swept by a segment
+ *
+ * @param radius
+ *            arc radius
+ * @return segment angle
+ */
+-(double) segmentAngleWithRadius: (double) radius{
+    
+    double angle = M_PI_2 / _segmentsPerQuadrant;
+    
+    if(_maxDeviation > 0 || _maxAngle > 0){
+        angle = M_PI;
+        if(_maxAngle > 0){
+            angle = MIN(angle, _maxAngle);
+        }
+        if(_maxDeviation > 0 && _maxDeviation < radius){
+            // Sagitta of a chord sweeping the angle equals the deviation
+            angle = MIN(angle, 2.0 * acos(1.0 - _maxDeviation / radius));
+        }
+        angle = MAX(angle, 2.0 * M_PI / MAX_CIRCLE_SEGMENTS);
+    }
+    
+    return angle;
+}
+
+/**
+ * Get the signed angle swept from one angle to another in a direction
+ *
+ * @param from
+ *            start angle
+ * @param to
+ *            end angle
+ * @param counterClockwise
+ *            true for counter clockwise (positive) sweeps
+ * @return swept angle
+ */
++(double) sweepFrom: (double) from to: (double) to counterClockwise: (BOOL) counterClockwise{
+    double sweep = to - from;
+    if(counterClockwise){
+        while(sweep <= 0){
+            sweep += 2.0 * M_PI;
+        }
+    }else{
+        while(sweep >= 0){
+            sweep -= 2.0 * M_PI;
+        }
+    }
+    return sweep;
+}
+
+@end
@@ -0,0 +1,167 @@
+//
+//  SFWTBatchReader.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTBatchReader.h>
+#import <SimpleFeaturesWKT/SFWTGeometryReader.h>
+
+NSString * const SFWT_ERROR_DOMAIN = @"SFWTErrorDomain";
+
+NSString * const SFWT_EXCEPTION_NAME_KEY = @"exceptionName";
+
+@interface SFWTBatchReader()
+
+/**
+ * Geometry reader of well-known text
+ */
+@property (nonatomic, strong) SFWTGeometryReader *geometryReader;
+
+/**
+ * Compressed geometry reader
+ */
+@property (nonatomic, strong) SFWTCompressedGeometryReader *compressedReader;
+
+@end
+
+@implementation SFWTBatchReader{
+    NSError *_pendingError;
+}
+
+-(instancetype) initWithText: (NSString *) text{
+    self = [super init];
+    if(self != nil){
+        _geometryReader = [[SFWTGeometryReader alloc] initWithText:text];
+    }
+    return self;
+}
+
+-(instancetype) initWithCompressedReader: (SFWTCompressedGeometryReader *) reader{
+    self = [super init];
+    if(self != nil){
+        _compressedReader = reader;
+    }
+    return self;
+}
+
+-(NSArray<SFGeometry *> *) readBatchWithCount: (NSUInteger) count error: (NSError **) error{
+    if([self takePendingError:error]){
+        return nil;
+    }
+    NSMutableArray<SFGeometry *> *geometries = [NSMutableArray arrayWithCapacity:count];
+    @try{
+        [_geometryReader setLimits:_limits];
+        [_compressedReader setLimits:_limits];
+        while(geometries.count < count){
+            SFGeometry *geometry = nil;
+            if(_compressedReader != nil){
+                geometry = [_compressedReader read];
+            }else if([[_geometryReader textReader] peekToken] != nil){
+                geometry = [_geometryReader read];
+                if(geometry == nil){
+                    // Empty geometry
+                    continue;
+                }
+            }
+            if(geometry == nil){
+                break;
+            }
+            [geometries addObject:geometry];
+        }
+    }@catch(NSException *exception){
+        geometries = [self batch:geometries withException:exception error:error];
+    }
+    return geometries;
+}
+
+-(NSArray<SFWTFlatGeometry *> *) readFlatBatchWithCount: (NSUInteger) count error: (NSError **) error{
+    if([self takePendingError:error]){
+        return nil;
+    }
+    NSMutableArray<SFWTFlatGeometry *> *geometries = [NSMutableArray arrayWithCapacity:count];
+    @try{
+        if(_geometryReader == nil){
+            [NSException raise:@"Unsupported Read" format:@"Flat geometries are not supported by compressed readers"];
+        }
+        [_geometryReader setLimits:_limits];
+        SFWTGeometryArena *arena = [[SFWTGeometryArena alloc] init];
+        while(geometries.count < count){
+            SFWTFlatGeometry *geometry = [_geometryReader readFlatWithArena:arena];
+            if(geometry == nil){
+                break;
+            }
+            [geometries addObject:geometry];
+        }
+    }@catch(NSException *exception){
+        geometries = [self batch:geometries withException:exception error:error];
+    }
+    return geometries;
+}
+
+/**
+ * Finish a batch interrupted by a raised exception. A partial batch is
+ * returned and the error is held for the next read, otherwise the error is
+ * returned now.
+ *
+ * @param geometries
+ *            geometries read before the exception
+ * @param exception
+ *            raised exception
+ * @param error
+ *            error result
+ *
+ * @return partial batch, nil on error
+ */
+-(NSMutableArray *) batch: (NSMutableArray *) geometries withException: (NSException *) exception error: (NSError **) error{
+    NSError *exceptionError = [SFWTBatchReader errorWithException:exception];
+    if(geometries.count > 0){
+        _pendingError = exceptionError;
+    }else{
+        if(error != NULL){
+            *error = exceptionError;
+        }
+        geometries = nil;
+    }
+    return geometries;
+}
+
+/**
+ * Take the error held from a previous partial batch
+ *
+ * @param error
+ *            error result
+ *
+ * @return true if an error was pending
+ */
+-(BOOL) takePendingError: (NSError **) error{
+    BOOL pending = _pendingError != nil;
+    if(pending){
+        if(error != NULL){
+            *error = _pendingError;
+        }
+        _pendingError = nil;
+    }
+    return pending;
+}
+
+/**
+ * Create an error from a raised exception
+ *
+ * @param exception
+ *            raised exception
+ *
+ * @return error
+ */
++(NSError *) errorWithException: (NSException *) exception{
+    NSMutableDictionary *userInfo = [NSMutableDictionary dictionary];
+    [userInfo setObject:exception.name forKey:SFWT_EXCEPTION_NAME_KEY];
+    if(exception.reason != nil){
+        [userInfo setObject:exception.reason forKey:NSLocalizedDescriptionKey];
+    }
+    return [NSError errorWithDomain:SFWT_ERROR_DOMAIN code:0 userInfo:userInfo];
+}
+
+@end
@@ -0,0 +1,313 @@
+//
+//  SFWTCompressedGeometryReader.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTCompressedGeometryReader.h>
+#import <SimpleFeaturesWKT/SFWTGeometryReader.h>
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+#import <zlib.h>
+
+@interface SFWTCompressedGeometryReader()
+
+/**
+ * Input stream
+ */
+@property (nonatomic, strong) NSInputStream *stream;
+
+/**
+ * Decompressed text not yet tokenized
+ */
+@property (nonatomic, strong) NSMutableData *pending;
+
+/**
+ * Geometry reader of the current tokenized segment
+ */
+@property (nonatomic, strong) SFWTGeometryReader *geometryReader;
+
+@end
+
+@implementation SFWTCompressedGeometryReader{
+    z_stream _zstream;
+    BOOL _initialized;
+    BOOL _detected;
+    SFWTCompressionFormat _format;
+    uint8_t *_input;
+    NSUInteger _inputCapacity;
+    NSUInteger _inputLength;
+    BOOL _inputEnd;
+    BOOL _end;
+    NSUInteger _total;
+    NSUInteger _scanOffset;
+    NSUInteger _boundary;
+    int _depth;
+}
+
++(SFWTCompressedGeometryReader *) readerWithPath: (NSString *) path{
+    return [[SFWTCompressedGeometryReader alloc] initWithStream:[NSInputStream inputStreamWithFileAtPath:path]];
+}
+
+-(instancetype) initWithData: (NSData *) data{
+    return [self initWithStream:[NSInputStream inputStreamWithData:data]];
+}
+
+-(instancetype) initWithStream: (NSInputStream *) stream{
+    self = [super init];
+    if(self != nil){
+        _stream = stream;
+        if([_stream streamStatus] == NSStreamStatusNotOpen){
+            [_stream open];
+        }
+        _pending = [NSMutableData data];
+        _bufferSize = SFWT_COMPRESSION_DEFAULT_BUFFER_SIZE;
+        _format = SFWT_COMPRESSION_NONE;
+    }
+    return self;
+}
+
+-(void) dealloc{
+    if(_initialized){
+        inflateEnd(&_zstream);
+    }
+    free(_input);
+}
+
+-(SFWTCompressionFormat) format{
+    return _format;
+}
+
+-(SFGeometry *) read{
+    SFGeometry *geometry = nil;
+    while(geometry == nil){
+        if(_geometryReader != nil && [[_geometryReader textReader] peekToken] != nil){
+            geometry = [_geometryReader read];
+        }else if(![self nextSegment]){
+            break;
+        }
+    }
+    return geometry;
+}
+
+-(NSMutableArray<SFGeometry *> *) readAll{
+    NSMutableArray<SFGeometry *> *geometries = [NSMutableArray array];
+    SFGeometry *geometry = nil;
+    while((geometry = [self read]) != nil){
+        [geometries addObject:geometry];
+    }
+    return geometries;
+}
+
+/**
+ * Tokenize the next segment of complete geometries, refilling the pending
+ * text as needed
+ *
+ * @return true if a segment was read
+ */
+-(BOOL) nextSegment{
+
+    _geometryReader = nil;
+
+    while(!_end && ([_pending length] < _bufferSize || _boundary == 0)){
+        [self fill];
+        [self scanBoundaries];
+    }
+
+    NSUInteger length = _end ? [_pending length] : _boundary;
+    if(length == 0){
+        return NO;
+    }
+
+    // The structural index retains the segment, copy it out of the pending buffer which is compacted below
+    NSData *segment = [NSData dataWithBytes:[_pending mutableBytes] length:length];
+    SFWTStructuralIndex *index = [[SFWTStructuralIndex alloc] initWithData:segment];
+    SFTextReader *reader = nil;
+    if([index isASCII]){
+        reader = [[SFWTIndexedTextReader alloc] initWithIndex:index andText:@""];
+    }else{
+        reader = [[SFTextReader alloc] initWithText:[[NSString alloc] initWithData:segment encoding:NSUTF8StringEncoding]];
+    }
+
+    // Keep the partial geometry following the segment
+    [_pending replaceBytesInRange:NSMakeRange(0, length) withBytes:NULL length:0];
+    _scanOffset = _scanOffset > length ? _scanOffset - length : 0;
+    _boundary = 0;
+
+    _geometryReader = [[SFWTGeometryReader alloc] initWithReader:reader];
+    [_geometryReader setLimits:_limits];
+
+    return YES;
+}
+
+/**
+ * Append the next block of decompressed text to the pending text
+ */
+-(void) fill{
+
+    if(!_detected){
+        [self detectFormat];
+    }
+
+    NSUInteger length = [_pending length];
+    NSUInteger size = MAX(_bufferSize, 64);
+
+    if(_format == SFWT_COMPRESSION_NONE){
+
+        if(_inputLength > 0){
+            [_pending appendBytes:_input length:_inputLength];
+            _inputLength = 0;
+        }else{
+            [_pending setLength:length + size];
+            NSUInteger read = [self readStream:(uint8_t *) [_pending mutableBytes] + length maxLength:size];
+            [_pending setLength:length + read];
+            _end = read == 0;
+        }
+
+    }else{
+
+        if(_zstream.avail_in == 0 && !_inputEnd){
+            [self readInput];
+        }
+
+        [_pending setLength:length + size];
+        _zstream.next_out = (Bytef *) [_pending mutableBytes] + length;
+        _zstream.avail_out = (uInt) size;
+        int result = inflate(&_zstream, Z_NO_FLUSH);
+        [_pending setLength:length + size - _zstream.avail_out];
+
+        if(result == Z_STREAM_END){
+            // Continue with concatenated gzip members
+            if(_zstream.avail_in == 0 && !_inputEnd){
+                [self readInput];
+            }
+            if(_zstream.avail_in > 0){
+                inflateReset(&_zstream);
+            }else{
+                _end = YES;
+            }
+        }else if(result == Z_BUF_ERROR){
+            if(_zstream.avail_in == 0 && _inputEnd){
+                [NSException raise:@"Decompression Failure" format:@"Unexpected end of compressed input"];
+            }
+        }else if(result != Z_OK){
+            [NSException raise:@"Decompression Failure" format:@"Failed to decompress: %s", _zstream.msg != NULL ? _zstream.msg : "unknown error"];
+        }
+
+    }
+
+    _total += [_pending length] - length;
+    if(_limits != nil){
+        [_limits checkBytes:_total];
+    }
+
+}
+
+/**
+ * Detect the input format from the first input bytes
+ */
+-(void) detectFormat{
+
+    _inputCapacity = MAX(_bufferSize, 2);
+    _input = malloc(_inputCapacity);
+    while(_inputLength < 2 && !_inputEnd){
+        _inputLength += [self readStream:_input + _inputLength maxLength:_inputCapacity - _inputLength];
+    }
+
+    _format = SFWT_COMPRESSION_NONE;
+    if(_inputLength >= 2){
+        if(_input[0] == 0x1F && _input[1] == 0x8B){
+            _format = SFWT_COMPRESSION_GZIP;
+        }else if((_input[0] & 0x0F) == Z_DEFLATED && ((_input[0] << 8) | _input[1]) % 31 == 0){
+            _format = SFWT_COMPRESSION_ZLIB;
+        }
+    }
+
+    if(_format != SFWT_COMPRESSION_NONE){
+        memset(&_zstream, 0, sizeof(z_stream));
+        int windowBits = _format == SFWT_COMPRESSION_GZIP ? MAX_WBITS + 16 : MAX_WBITS;
+        if(inflateInit2(&_zstream, windowBits) != Z_OK){
+            [NSException raise:@"Decompression Failure" format:@"Failed to initialize decompression: %s", _zstream.msg != NULL ? _zstream.msg : "unknown error"];
+        }
+        _initialized = YES;
+        _zstream.next_in = _input;
+        _zstream.avail_in = (uInt) _inputLength;
+        _inputLength = 0;
+    }
+
+    _detected = YES;
+}
+
+/**
+ * Read the next compressed input block
+ */
+-(void) readInput{
+    _zstream.next_in = _input;
+    _zstream.avail_in = (uInt) [self readStream:_input maxLength:_inputCapacity];
+}
+
+/**
+ * Read from the input stream
+ *
+ * @param buffer
+ *            read buffer
+ * @param maxLength
+ *            max bytes to read
+ *
+ * @return bytes read, 0 at the end of the stream
+ */
+-(NSUInteger) readStream: (uint8_t *) buffer maxLength: (NSUInteger) maxLength{
+    NSInteger read = [_stream read:buffer maxLength:maxLength];
+    if(read < 0){
+        [NSException raise:@"Stream Read" format:@"Failed to read well-known text from stream: %@", [_stream streamError]];
+    }
+    if(read == 0){
+        _inputEnd = YES;
+    }
+    return (NSUInteger) read;
+}
+
+/**
+ * Scan the newly filled pending text for the end of the last complete top
+ * level geometry, after a closing parenthesis or EMPTY at depth 0
+ */
+-(void) scanBoundaries{
+
+    const uint8_t *bytes = [_pending bytes];
+    NSUInteger length = [_pending length];
+    NSUInteger i = _scanOffset;
+
+    while(i < length){
+        uint8_t c = bytes[i];
+        if(c == '('){
+            _depth++;
+            i++;
+        }else if(c == ')'){
+            _depth--;
+            i++;
+            if(_depth == 0){
+                _boundary = i;
+            }
+        }else if(_depth == 0 && isalpha(c)){
+            NSUInteger end = i;
+            while(end < length && isalnum(bytes[end])){
+                end++;
+            }
+            if(end == length && !_end){
+                // Word may continue in the next block
+                break;
+            }
+            if(end - i == 5 && strncasecmp((const char *) bytes + i, "EMPTY", 5) == 0){
+                _boundary = end;
+            }
+            i = end;
+        }else{
+            i++;
+        }
+    }
+
+    _scanOffset = i;
+}
+
+@end
@@ -0,0 +1,143 @@
+//
+//  SFWTCompressedGeometryWriter.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTCompressedGeometryWriter.h>
+#import <SimpleFeaturesWKT/SFWTGeometryWriter.h>
+#import <zlib.h>
+
+@interface SFWTCompressedGeometryWriter()
+
+/**
+ * Output stream
+ */
+@property (nonatomic, strong) NSOutputStream *stream;
+
+@end
+
+@implementation SFWTCompressedGeometryWriter{
+    z_stream _zstream;
+    BOOL _initialized;
+    BOOL _compressed;
+    uint8_t *_output;
+}
+
++(SFWTCompressedGeometryWriter *) writerWithPath: (NSString *) path{
+    return [[SFWTCompressedGeometryWriter alloc] initWithStream:[NSOutputStream outputStreamToFileAtPath:path append:NO]];
+}
+
+-(instancetype) initWithStream: (NSOutputStream *) stream{
+    return [self initWithStream:stream andFormat:SFWT_COMPRESSION_GZIP andLevel:Z_DEFAULT_COMPRESSION];
+}
+
+-(instancetype) initWithStream: (NSOutputStream *) stream andFormat: (SFWTCompressionFormat) format andLevel: (int) level{
+    self = [super init];
+    if(self != nil){
+        _stream = stream;
+        if([_stream streamStatus] == NSStreamStatusNotOpen){
+            [_stream open];
+        }
+        _compressed = format != SFWT_COMPRESSION_NONE;
+        if(_compressed){
+            memset(&_zstream, 0, sizeof(z_stream));
+            // 16 added to the window bits writes a gzip wrapper
+            int windowBits = format == SFWT_COMPRESSION_GZIP ? MAX_WBITS + 16 : MAX_WBITS;
+            if(deflateInit2(&_zstream, level, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK){
+                [NSException raise:@"Compression Failure" format:@"Failed to initialize compression: %s", _zstream.msg != NULL ? _zstream.msg : "unknown error"];
+            }
+            _initialized = YES;
+            _output = malloc(SFWT_COMPRESSION_DEFAULT_BUFFER_SIZE);
+        }
+    }
+    return self;
+}
+
+-(void) dealloc{
+    if(_initialized){
+        deflateEnd(&_zstream);
+    }
+    free(_output);
+}
+
+-(void) write: (SFGeometry *) geometry{
+    [self writeText:[SFWTGeometryWriter writeGeometry:geometry]];
+    [self writeBytes:(const uint8_t *) "\n" length:1];
+}
+
+-(void) writeText: (NSString *) text{
+    const char *bytes = [text UTF8String];
+    [self writeBytes:(const uint8_t *) bytes length:strlen(bytes)];
+}
+
+-(void) writeBytes: (const uint8_t *) bytes length: (NSUInteger) length{
+    if(!_compressed){
+        [self writeToStream:bytes length:length];
+    }else{
+        if(!_initialized){
+            [NSException raise:@"Compression Failure" format:@"Writer is closed"];
+        }
+        while(length > 0){
+            uInt chunk = (uInt) MIN(length, (NSUInteger) UINT_MAX);
+            _zstream.next_in = (Bytef *) bytes;
+            _zstream.avail_in = chunk;
+            [self deflateWithFlush:Z_NO_FLUSH];
+            bytes += chunk;
+            length -= chunk;
+        }
+    }
+}
+
+-(void) close{
+    if(_initialized){
+        _zstream.next_in = NULL;
+        _zstream.avail_in = 0;
+        [self deflateWithFlush:Z_FINISH];
+        deflateEnd(&_zstream);
+        _initialized = NO;
+    }
+    [_stream close];
+}
+
+/**
+ * Compress the pending input, writing full output buffers to the stream
+ *
+ * @param flush
+ *            zlib flush mode
+ */
+-(void) deflateWithFlush: (int) flush{
+    int result = Z_OK;
+    do{
+        _zstream.next_out = _output;
+        _zstream.avail_out = SFWT_COMPRESSION_DEFAULT_BUFFER_SIZE;
+        result = deflate(&_zstream, flush);
+        if(result == Z_STREAM_ERROR){
+            [NSException raise:@"Compression Failure" format:@"Failed to compress: %s", _zstream.msg != NULL ? _zstream.msg : "unknown error"];
+        }
+        [self writeToStream:_output length:SFWT_COMPRESSION_DEFAULT_BUFFER_SIZE - _zstream.avail_out];
+    } while(_zstream.avail_out == 0 || (flush == Z_FINISH && result != Z_STREAM_END));
+}
+
+/**
+ * Write bytes to the output stream
+ *
+ * @param bytes
+ *            bytes
+ * @param length
+ *            number of bytes
+ */
+-(void) writeToStream: (const uint8_t *) bytes length: (NSUInteger) length{
+    NSUInteger offset = 0;
+    while(offset < length){
+        NSInteger written = [_stream write:bytes + offset maxLength:length - offset];
+        if(written <= 0){
+            [NSException raise:@"Stream Write" format:@"Failed to write well-known text to stream: %@", [_stream streamError]];
+        }
+        offset += written;
+    }
+}
+
+@end
@@ -0,0 +1,382 @@
+//
+//  SFWTDelimitedReader.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTDelimitedReader.h>
+#import <SimpleFeaturesWKT/SFWTGeometryReader.h>
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+
+/**
+ * Field byte range within the delimited text
+ */
+typedef struct {
+    NSUInteger start;
+    NSUInteger end;
+    BOOL escaped;
+} SFWTFieldRange;
+
+@interface SFWTDelimitedReader()
+
+/**
+ * Delimited text
+ */
+@property (nonatomic, strong) NSData *data;
+
+@end
+
+@implementation SFWTDelimitedReader{
+    const uint8_t *_bytes;
+    NSUInteger _length;
+    uint8_t _delimiter;
+    NSUInteger _column;
+    NSUInteger _offset;
+    NSUInteger _row;
+}
+
++(SFWTDelimitedReader *) readerWithPath: (NSString *) path andDelimiter: (uint8_t) delimiter andColumn: (NSUInteger) column andHeader: (BOOL) header error: (NSError **) error{
+    SFWTDelimitedReader *reader = nil;
+    NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedIfSafe error:error];
+    if(data != nil){
+        reader = [[SFWTDelimitedReader alloc] initWithData:data andDelimiter:delimiter andColumn:column andHeader:header];
+    }
+    return reader;
+}
+
++(SFWTDelimitedReader *) readerWithPath: (NSString *) path andDelimiter: (uint8_t) delimiter andColumnName: (NSString *) name error: (NSError **) error{
+    SFWTDelimitedReader *reader = nil;
+    NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedIfSafe error:error];
+    if(data != nil){
+        reader = [[SFWTDelimitedReader alloc] initWithData:data andDelimiter:delimiter andColumnName:name];
+    }
+    return reader;
+}
+
+-(instancetype) initWithData: (NSData *) data andDelimiter: (uint8_t) delimiter andColumn: (NSUInteger) column andHeader: (BOOL) header{
+    self = [super init];
+    if(self != nil){
+        if(delimiter == '"' || delimiter == '\r' || delimiter == '\n'){
+            [NSException raise:@"Invalid Delimiter" format:@"Delimiter can not be a quote or line ending character: %d", delimiter];
+        }
+        _data = data;
+        _bytes = [data bytes];
+        _length = [data length];
+        _delimiter = delimiter;
+        _column = column;
+        _offset = 0;
+        _row = 0;
+        _batchSize = SFWT_DELIMITED_DEFAULT_BATCH_SIZE;
+        _concurrent = YES;
+        if(header){
+            [self skipBlankLines];
+            [self scanRecordToField:NULL];
+        }
+    }
+    return self;
+}
+
+-(instancetype) initWithData: (NSData *) data andDelimiter: (uint8_t) delimiter andColumnName: (NSString *) name{
+    self = [self initWithData:data andDelimiter:delimiter andColumn:0 andHeader:NO];
+    if(self != nil){
+        [self readHeaderWithColumnName:name];
+    }
+    return self;
+}
+
+-(NSUInteger) column{
+    return _column;
+}
+
+-(NSArray<SFWTDelimitedRecord *> *) readBatch{
+
+    NSUInteger batchSize = MAX(_batchSize, 1);
+    SFWTFieldRange *fields = malloc(batchSize * sizeof(SFWTFieldRange));
+    NSUInteger count = 0;
+    NSUInteger firstRow = _row;
+
+    @try{
+        while(count < batchSize && [self skipBlankLines]){
+            if(![self scanRecordToField:&fields[count]]){
+                [NSException raise:@"Invalid Row" format:@"Row %lu does not have column %lu", (unsigned long)_row, (unsigned long)_column];
+            }
+            count++;
+            _row++;
+        }
+    }@catch(NSException *exception){
+        free(fields);
+        @throw exception;
+    }
+
+    if(count == 0){
+        free(fields);
+        return nil;
+    }
+
+    SFGeometry * __strong *geometries = (SFGeometry * __strong *) calloc(count, sizeof(SFGeometry *));
+    NSException * __strong *exceptions = (NSException * __strong *) calloc(count, sizeof(NSException *));
+
+    void (^readField)(size_t) = ^(size_t index){
+        @try{
+            geometries[index] = [self readGeometryInField:fields[index]];
+        }@catch(NSException *exception){
+            exceptions[index] = exception;
+        }
+    };
+
+    if(_concurrent && count > 1){
+        dispatch_apply(count, dispatch_get_global_queue(QOS_CLASS_USER_INITIATED, 0), readField);
+    }else{
+        for(NSUInteger i = 0; i < count; i++){
+            readField(i);
+        }
+    }
+
+    NSMutableArray<SFWTDelimitedRecord *> *records = [NSMutableArray arrayWithCapacity:count];
+    NSException *failure = nil;
+    for(NSUInteger i = 0; i < count; i++){
+        if(failure == nil && exceptions[i] != nil){
+            failure = [NSException exceptionWithName:exceptions[i].name reason:[NSString stringWithFormat:@"Row %lu: %@", (unsigned long)(firstRow + i), exceptions[i].reason] userInfo:exceptions[i].userInfo];
+        }
+        if(failure == nil){
+            [records addObject:[[SFWTDelimitedRecord alloc] initWithRow:firstRow + i andGeometry:geometries[i]]];
+        }
+        geometries[i] = nil;
+        exceptions[i] = nil;
+    }
+    free(geometries);
+    free(exceptions);
+    free(fields);
+
+    if(failure != nil){
+        @throw failure;
+    }
+
+    return records;
+}
+
+-(NSArray<SFWTDelimitedRecord *> *) readAll{
+    NSMutableArray<SFWTDelimitedRecord *> *records = [NSMutableArray array];
+    NSArray<SFWTDelimitedRecord *> *batch = nil;
+    while((batch = [self readBatch]) != nil){
+        [records addObjectsFromArray:batch];
+    }
+    return records;
+}
+
+-(void) enumerateRecordsUsingBlock: (void (^)(SFWTDelimitedRecord *record, BOOL *stop)) block{
+    BOOL stop = NO;
+    NSArray<SFWTDelimitedRecord *> *batch = nil;
+    while(!stop && (batch = [self readBatch]) != nil){
+        for(SFWTDelimitedRecord *record in batch){
+            block(record, &stop);
+            if(stop){
+                break;
+            }
+        }
+    }
+}
+
+/**
+ * Read the geometry in a field from the field bytes
+ *
+ * @param field
+ *            field range
+ *
+ * @return geometry or nil
+ */
+-(SFGeometry *) readGeometryInField: (SFWTFieldRange) field{
+
+    if(field.start == field.end){
+        return nil;
+    }
+
+    NSData *data = nil;
+    if(field.escaped){
+        data = [self unescapedDataOfField:field];
+    }else{
+        data = [NSData dataWithBytesNoCopy:(void *) (_bytes + field.start) length:field.end - field.start freeWhenDone:NO];
+    }
+
+    [_limits checkBytes:[data length]];
+
+    SFTextReader *reader = nil;
+    SFWTStructuralIndex *index = [[SFWTStructuralIndex alloc] initWithData:data];
+    if([index isASCII]){
+        reader = [[SFWTIndexedTextReader alloc] initWithIndex:index andText:@""];
+    }else{
+        reader = [[SFTextReader alloc] initWithText:[[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding]];
+    }
+
+    SFWTGeometryReader *geometryReader = [[SFWTGeometryReader alloc] initWithReader:reader];
+    [geometryReader setLimits:_limits];
+    return [geometryReader read];
+}
+
+/**
+ * Read the header row and find the column with the name
+ *
+ * @param name
+ *            column name
+ */
+-(void) readHeaderWithColumnName: (NSString *) name{
+
+    BOOL found = NO;
+
+    if([self skipBlankLines]){
+        NSUInteger column = 0;
+        BOOL more = YES;
+        while(more){
+            SFWTFieldRange field;
+            more = [self scanField:&field];
+            if(!found){
+                NSData *data = field.escaped ? [self unescapedDataOfField:field] : [NSData dataWithBytesNoCopy:(void *) (_bytes + field.start) length:field.end - field.start freeWhenDone:NO];
+                NSString *fieldName = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+                if([name isEqualToString:fieldName]){
+                    _column = column;
+                    found = YES;
+                }
+            }
+            column++;
+        }
+    }
+
+    if(!found){
+        [NSException raise:@"Invalid Column" format:@"Column '%@' not found in the header row", name];
+    }
+}
+
+/**
+ * Skip blank lines
+ *
+ * @return true if a row follows
+ */
+-(BOOL) skipBlankLines{
+    while(_offset < _length){
+        if(_bytes[_offset] == '\n'){
+            _offset++;
+        }else if(_bytes[_offset] == '\r' && _offset + 1 < _length && _bytes[_offset + 1] == '\n'){
+            _offset += 2;
+        }else{
+            break;
+        }
+    }
+    return _offset < _length;
+}
+
+/**
+ * Scan a row, locating the column field
+ *
+ * @param field
+ *            column field result, NULL to skip the row
+ *
+ * @return true if the column was found
+ */
+-(BOOL) scanRecordToField: (SFWTFieldRange *) field{
+    BOOL found = NO;
+    NSUInteger column = 0;
+    BOOL more = YES;
+    while(more){
+        SFWTFieldRange current;
+        more = [self scanField:&current];
+        if(column++ == _column){
+            found = YES;
+            if(field != NULL){
+                *field = current;
+            }
+        }
+    }
+    return found;
+}
+
+/**
+ * Scan the next field of the row and its delimiter or row ending
+ *
+ * @param field
+ *            field range result, excluding enclosing quotes
+ *
+ * @return true if another field follows in the row
+ */
+-(BOOL) scanField: (SFWTFieldRange *) field{
+
+    field->escaped = NO;
+
+    if(_offset < _length && _bytes[_offset] == '"'){
+
+        NSUInteger start = _offset + 1;
+        NSUInteger position = start;
+        while(YES){
+            const uint8_t *quote = memchr(_bytes + position, '"', _length - position);
+            if(quote == NULL){
+                [NSException raise:@"Invalid Row" format:@"Unterminated quoted field in row %lu", (unsigned long)_row];
+            }
+            position = quote - _bytes;
+            if(position + 1 < _length && _bytes[position + 1] == '"'){
+                field->escaped = YES;
+                position += 2;
+            }else{
+                break;
+            }
+        }
+        field->start = start;
+        field->end = position;
+        _offset = position + 1;
+
+        if(_offset < _length && _bytes[_offset] != _delimiter && _bytes[_offset] != '\n'
+           && !(_bytes[_offset] == '\r' && _offset + 1 < _length && _bytes[_offset + 1] == '\n')){
+            [NSException raise:@"Invalid Row" format:@"Unexpected character after quoted field in row %lu", (unsigned long)_row];
+        }
+
+    }else{
+
+        NSUInteger position = _offset;
+        while(position < _length && _bytes[position] != _delimiter && _bytes[position] != '\n'){
+            position++;
+        }
+        field->start = _offset;
+        field->end = position;
+        if(position < _length && _bytes[position] == '\n' && position > _offset && _bytes[position - 1] == '\r'){
+            field->end--;
+        }
+        _offset = position;
+
+    }
+
+    BOOL more = NO;
+    if(_offset < _length){
+        if(_bytes[_offset] == _delimiter){
+            more = YES;
+        }else if(_bytes[_offset] == '\r'){
+            _offset++;
+        }
+        _offset++;
+    }
+
+    return more;
+}
+
+/**
+ * Copy a quoted field with escaped quotes replaced
+ *
+ * @param field
+ *            field range
+ *
+ * @return unescaped field bytes
+ */
+-(NSData *) unescapedDataOfField: (SFWTFieldRange) field{
+    NSMutableData *data = [NSMutableData dataWithLength:field.end - field.start];
+    uint8_t *bytes = [data mutableBytes];
+    NSUInteger length = 0;
+    for(NSUInteger i = field.start; i < field.end; i++){
+        bytes[length++] = _bytes[i];
+        if(_bytes[i] == '"'){
+            i++;
+        }
+    }
+    [data setLength:length];
+    return data;
+}
+
+@end
@@ -0,0 +1,22 @@
+//
+//  SFWTDelimitedRecord.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTDelimitedRecord.h>
+
+@implementation SFWTDelimitedRecord
+
+-(instancetype) initWithRow: (NSUInteger) row andGeometry: (SFGeometry *) geometry{
+    self = [super init];
+    if(self != nil){
+        _row = row;
+        _geometry = geometry;
+    }
+    return self;
+}
+
+@end
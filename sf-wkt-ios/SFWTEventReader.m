@@ -0,0 +1,565 @@
+//
+//  SFWTEventReader.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTEventReader.h>
+#import <SimpleFeaturesWKT/SFWTGeometryReader.h>
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+
+/**
+ * Member content read within a geometry's parentheses
+ */
+typedef enum {
+    SFWT_MEMBERS_POINT,
+    SFWT_MEMBERS_BARE_POINT,
+    SFWT_MEMBERS_COORDINATES,
+    SFWT_MEMBERS_LINE_STRINGS,
+    SFWT_MEMBERS_POLYGONS,
+    SFWT_MEMBERS_POINTS,
+    SFWT_MEMBERS_GEOMETRIES,
+    SFWT_MEMBERS_CURVES,
+    SFWT_MEMBERS_SURFACES
+} SFWTMembers;
+
+/**
+ * Open geometry frame
+ */
+typedef struct {
+    SFGeometryType geometryType;
+    SFWTMembers members;
+    BOOL tagged;
+    BOOL declaredZ;
+    BOOL declaredM;
+    BOOL hasZ;
+    BOOL hasM;
+    BOOL separator;
+    int count;
+} SFWTEventFrame;
+
+@interface SFWTEventReader()
+
+/**
+ * Text Reader
+ */
+@property (nonatomic, strong) SFTextReader *reader;
+
+@end
+
+@implementation SFWTEventReader{
+    SFWTEventFrame *_frames;
+    int _size;
+    int _capacity;
+    int _taggedDepth;
+    NSUInteger _coordinates;
+    NSUInteger _allocation;
+    NSUInteger _numEmpty;
+    BOOL _textChecked;
+    NSUInteger _offset;
+    SFWTEventType _eventType;
+    SFGeometryType _geometryType;
+    SFGeometryType _containingType;
+    BOOL _hasZ;
+    BOOL _hasM;
+    int _depth;
+    int _count;
+    double _x;
+    double _y;
+    double _z;
+    double _m;
+}
+
+-(instancetype) initWithText: (NSString *) text{
+    return [self initWithReader:[SFWTIndexedTextReader readerWithText:text]];
+}
+
+-(instancetype) initWithReader: (SFTextReader *) reader{
+    self = [super init];
+    if(self != nil){
+        _reader = reader;
+        _capacity = 8;
+        _frames = malloc(_capacity * sizeof(SFWTEventFrame));
+        _size = 0;
+        _eventType = SFWT_EVENT_NONE;
+    }
+    return self;
+}
+
+-(void) dealloc{
+    free(_frames);
+}
+
+-(SFTextReader *) textReader{
+    return _reader;
+}
+
+-(SFWTEventType) next{
+
+    while(YES){
+
+        if(_size == 0){
+
+            // Start the next top level geometry
+            if([_reader isKindOfClass:[SFWTIndexedTextReader class]]){
+                _offset = [(SFWTIndexedTextReader *) _reader offset];
+            }
+            SFWTGeometryTypeInfo *geometryTypeInfo = [SFWTGeometryReader readGeometryTypeWithReader:_reader];
+            if(geometryTypeInfo == nil){
+                _eventType = SFWT_EVENT_NONE;
+                break;
+            }
+
+            _taggedDepth = 0;
+            _coordinates = 0;
+            _allocation = 0;
+            if(_limits != nil && !_textChecked && ![_reader isKindOfClass:[SFWTIndexedTextReader class]]){
+                [_limits checkText:[_reader text]];
+                _textChecked = YES;
+            }
+
+            if([self startGeometryWithType:[geometryTypeInfo geometryType] andHasZ:[geometryTypeInfo hasZ] andHasM:[geometryTypeInfo hasM] andTagged:YES]){
+                break;
+            }
+            [self checkRecordBytes];
+            _numEmpty++;
+            continue;
+        }
+
+        SFWTEventFrame *frame = &_frames[_size - 1];
+
+        if(frame->members == SFWT_MEMBERS_POINT || frame->members == SFWT_MEMBERS_BARE_POINT){
+            if(frame->count == 0){
+                [self readCoordinateInFrame:frame];
+            }else{
+                if(frame->members == SFWT_MEMBERS_POINT){
+                    [SFWTGeometryReader rightParenthesis:_reader];
+                }
+                [self endGeometry];
+            }
+            break;
+        }
+
+        if(frame->separator && ![SFWTGeometryReader commaOrRightParenthesis:_reader]){
+            [self endGeometry];
+            break;
+        }
+        frame->separator = YES;
+
+        SFGeometryType containingType = frame->geometryType;
+        BOOL hasZ = frame->declaredZ;
+        BOOL hasM = frame->declaredM;
+        BOOL started = NO;
+
+        switch(frame->members){
+            case SFWT_MEMBERS_COORDINATES:
+                [self readCoordinateInFrame:frame];
+                started = YES;
+                break;
+            case SFWT_MEMBERS_LINE_STRINGS:
+                started = [self startGeometryWithType:SF_LINESTRING andHasZ:hasZ andHasM:hasM andTagged:NO];
+                break;
+            case SFWT_MEMBERS_POLYGONS:
+                started = [self startGeometryWithType:SF_POLYGON andHasZ:hasZ andHasM:hasM andTagged:NO];
+                break;
+            case SFWT_MEMBERS_POINTS:
+                if([SFWTGeometryReader isLeftParenthesisOrEmpty:_reader]){
+                    started = [self startGeometryWithType:SF_POINT andHasZ:hasZ andHasM:hasM andTagged:NO];
+                }else{
+                    [self pushGeometryWithType:SF_POINT andMembers:SFWT_MEMBERS_BARE_POINT andHasZ:hasZ andHasM:hasM andTagged:NO];
+                    started = YES;
+                }
+                break;
+            case SFWT_MEMBERS_CURVES:
+                if([SFWTGeometryReader isLeftParenthesisOrEmpty:_reader]){
+                    started = [self startGeometryWithType:SF_LINESTRING andHasZ:hasZ andHasM:hasM andTagged:NO];
+                }else{
+                    started = [self startTaggedGeometryInType:containingType];
+                }
+                break;
+            case SFWT_MEMBERS_SURFACES:
+                if([SFWTGeometryReader isLeftParenthesisOrEmpty:_reader]){
+                    started = [self startGeometryWithType:SF_POLYGON andHasZ:hasZ andHasM:hasM andTagged:NO];
+                }else{
+                    started = [self startTaggedGeometryInType:containingType];
+                }
+                break;
+            case SFWT_MEMBERS_GEOMETRIES:
+                started = [self startTaggedGeometryInType:containingType];
+                break;
+            default:
+                [NSException raise:@"Unexpected Members" format:@"Unexpected member content within %@", [SFGeometryTypes name:containingType]];
+        }
+
+        if(started){
+            break;
+        }
+
+    }
+
+    return _eventType;
+}
+
+-(SFWTEventType) eventType{
+    return _eventType;
+}
+
+-(SFGeometryType) geometryType{
+    return _geometryType;
+}
+
+-(BOOL) hasZ{
+    return _hasZ;
+}
+
+-(BOOL) hasM{
+    return _hasM;
+}
+
+-(int) depth{
+    return _depth;
+}
+
+-(SFGeometryType) containingType{
+    return _containingType;
+}
+
+-(int) count{
+    return _count;
+}
+
+-(NSUInteger) numEmpty{
+    return _numEmpty;
+}
+
+-(double) x{
+    return _x;
+}
+
+-(double) y{
+    return _y;
+}
+
+-(double) z{
+    return _z;
+}
+
+-(double) m{
+    return _m;
+}
+
+-(void) skipGeometry{
+
+    if(_size > 0){
+
+        SFWTEventFrame *frame = &_frames[_size - 1];
+
+        if(frame->members == SFWT_MEMBERS_BARE_POINT){
+            if(frame->count == 0){
+                [self readCoordinateInFrame:frame];
+            }
+        }else{
+            int open = 1;
+            while(open > 0){
+                NSString *token = [_reader readToken];
+                if(token == nil){
+                    [NSException raise:@"Invalid Token" format:@"Invalid token, expected ')'. found: '%@'", token];
+                }else if([token isEqualToString:@"("]){
+                    open++;
+                }else if([token isEqualToString:@")"]){
+                    open--;
+                }
+            }
+        }
+
+        [self popGeometry];
+
+    }
+
+}
+
++(BOOL) isType: (SFGeometryType) geometryType allowedInType: (SFGeometryType) containingType{
+    BOOL allowed;
+    switch(containingType){
+        case SF_COMPOUNDCURVE:
+            allowed = geometryType == SF_LINESTRING || geometryType == SF_CIRCULARSTRING;
+            break;
+        case SF_MULTICURVE:
+        case SF_CURVEPOLYGON:
+            allowed = geometryType == SF_LINESTRING || geometryType == SF_CIRCULARSTRING || geometryType == SF_COMPOUNDCURVE;
+            break;
+        case SF_MULTISURFACE:
+            allowed = geometryType == SF_POLYGON || geometryType == SF_CURVEPOLYGON || geometryType == SF_TRIANGLE
+                || geometryType == SF_POLYHEDRALSURFACE || geometryType == SF_TIN;
+            break;
+        default:
+            allowed = YES;
+            break;
+    }
+    return allowed;
+}
+
+/**
+ * Read a geometry type and start a tagged member geometry
+ *
+ * @param containingType
+ *            containing geometry type
+ * @return true if started, false if empty
+ */
+-(BOOL) startTaggedGeometryInType: (SFGeometryType) containingType{
+
+    SFWTGeometryTypeInfo *geometryTypeInfo = [SFWTGeometryReader readGeometryTypeWithReader:_reader];
+    if(geometryTypeInfo == nil){
+        return NO;
+    }
+
+    SFGeometryType geometryType = [geometryTypeInfo geometryType];
+    if(![SFWTEventReader isType:geometryType allowedInType:containingType]){
+        [NSException raise:@"Unexpected Geometry" format:@"Unexpected Geometry Type within %@. Actual: %@", [SFGeometryTypes name:containingType], [SFGeometryTypes name:geometryType]];
+    }
+
+    return [self startGeometryWithType:geometryType andHasZ:[geometryTypeInfo hasZ] andHasM:[geometryTypeInfo hasM] andTagged:YES];
+}
+
+/**
+ * Read the left parenthesis or empty set of a geometry and start it
+ *
+ * @param geometryType
+ *            geometry type
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ * @param tagged
+ *            true if read with a geometry type tag
+ * @return true if started, false if empty
+ */
+-(BOOL) startGeometryWithType: (SFGeometryType) geometryType andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM andTagged: (BOOL) tagged{
+
+    SFWTMembers members = [SFWTEventReader membersOfType:geometryType];
+
+    BOOL started = [SFWTGeometryReader leftParenthesisOrEmpty:_reader];
+    if(started){
+        [self pushGeometryWithType:geometryType andMembers:members andHasZ:hasZ andHasM:hasM andTagged:tagged];
+    }
+
+    return started;
+}
+
+/**
+ * Push a geometry frame and set the start event
+ *
+ * @param geometryType
+ *            geometry type
+ * @param members
+ *            member content
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ * @param tagged
+ *            true if read with a geometry type tag
+ */
+-(void) pushGeometryWithType: (SFGeometryType) geometryType andMembers: (SFWTMembers) members andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM andTagged: (BOOL) tagged{
+
+    if(tagged){
+        _taggedDepth++;
+    }
+    if(_limits != nil){
+        [_limits checkDepth:_taggedDepth];
+        _allocation += [SFWTReaderLimits containerAllocation];
+        [_limits checkAllocation:_allocation];
+    }
+
+    if(_size == _capacity){
+        _capacity *= 2;
+        _frames = realloc(_frames, _capacity * sizeof(SFWTEventFrame));
+    }
+
+    _containingType = _size > 0 ? _frames[_size - 1].geometryType : SF_NONE;
+
+    SFWTEventFrame *frame = &_frames[_size++];
+    frame->geometryType = geometryType;
+    frame->members = members;
+    frame->tagged = tagged;
+    frame->declaredZ = hasZ;
+    frame->declaredM = hasM;
+    frame->hasZ = hasZ;
+    frame->hasM = hasM;
+    frame->separator = NO;
+    frame->count = 0;
+
+    _eventType = SFWT_EVENT_START_GEOMETRY;
+    _geometryType = geometryType;
+    _hasZ = hasZ;
+    _hasM = hasM;
+    _depth = _size;
+    _count = 0;
+}
+
+/**
+ * Pop the current geometry frame and set the end event
+ */
+-(void) endGeometry{
+
+    SFWTEventFrame *frame = &_frames[_size - 1];
+
+    _eventType = SFWT_EVENT_END_GEOMETRY;
+    _geometryType = frame->geometryType;
+    _hasZ = frame->hasZ;
+    _hasM = frame->hasM;
+    _count = frame->count;
+    _depth = _size;
+
+    [self popGeometry];
+
+    _containingType = SF_NONE;
+    if(_size > 0){
+        SFWTEventFrame *parent = &_frames[_size - 1];
+        parent->hasZ = parent->hasZ || _hasZ;
+        parent->hasM = parent->hasM || _hasM;
+        _containingType = parent->geometryType;
+    }
+
+}
+
+/**
+ * Pop the current geometry frame, counting it as a member of its parent
+ */
+-(void) popGeometry{
+
+    if(_frames[_size - 1].tagged){
+        _taggedDepth--;
+    }
+    _size--;
+
+    if(_size > 0){
+        _frames[_size - 1].count++;
+    }else{
+        [self checkRecordBytes];
+    }
+
+}
+
+/**
+ * Verify the bytes of the completed top level geometry are within the
+ * limit, when reading indexed text
+ */
+-(void) checkRecordBytes{
+    if(_limits != nil && [_reader isKindOfClass:[SFWTIndexedTextReader class]]){
+        [_limits checkBytes:[(SFWTIndexedTextReader *) _reader offset] - _offset];
+    }
+}
+
+/**
+ * Read a coordinate and set the coordinate event
+ *
+ * @param frame
+ *            frame containing the coordinate
+ */
+-(void) readCoordinateInFrame: (SFWTEventFrame *) frame{
+
+    _coordinates++;
+    if(_limits != nil){
+        [_limits checkCoordinates:_coordinates];
+        _allocation += [SFWTReaderLimits pointAllocationWithHasZ:frame->declaredZ andHasM:frame->declaredM];
+        [_limits checkAllocation:_allocation];
+    }
+
+    _x = [_reader readDouble];
+    _y = [_reader readDouble];
+    _z = NAN;
+    _m = NAN;
+    BOOL hasZ = frame->declaredZ;
+    BOOL hasM = frame->declaredM;
+
+    if(hasZ || hasM){
+        if(hasZ){
+            _z = [_reader readDouble];
+        }
+        if(hasM){
+            _m = [_reader readDouble];
+        }
+    } else if(![SFWTGeometryReader isCommaOrRightParenthesis:_reader]){
+
+        _z = [_reader readDouble];
+        hasZ = YES;
+
+        if(![SFWTGeometryReader isCommaOrRightParenthesis:_reader]){
+            _m = [_reader readDouble];
+            hasM = YES;
+        }
+
+    }
+
+    frame->count++;
+    frame->hasZ = frame->hasZ || hasZ;
+    frame->hasM = frame->hasM || hasM;
+
+    _eventType = SFWT_EVENT_COORDINATE;
+    _geometryType = frame->geometryType;
+    _containingType = frame->geometryType;
+    _hasZ = hasZ;
+    _hasM = hasM;
+    _depth = _size;
+    _count = 0;
+}
+
+/**
+ * Get the member content of a geometry type
+ *
+ * @param geometryType
+ *            geometry type
+ * @return members
+ */
++(SFWTMembers) membersOfType: (SFGeometryType) geometryType{
+
+    SFWTMembers members = SFWT_MEMBERS_GEOMETRIES;
+
+    switch(geometryType){
+        case SF_POINT:
+            members = SFWT_MEMBERS_POINT;
+            break;
+        case SF_LINESTRING:
+        case SF_CIRCULARSTRING:
+            members = SFWT_MEMBERS_COORDINATES;
+            break;
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+        case SF_MULTILINESTRING:
+            members = SFWT_MEMBERS_LINE_STRINGS;
+            break;
+        case SF_MULTIPOLYGON:
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            members = SFWT_MEMBERS_POLYGONS;
+            break;
+        case SF_MULTIPOINT:
+            members = SFWT_MEMBERS_POINTS;
+            break;
+        case SF_GEOMETRYCOLLECTION:
+            members = SFWT_MEMBERS_GEOMETRIES;
+            break;
+        case SF_MULTICURVE:
+        case SF_COMPOUNDCURVE:
+        case SF_CURVEPOLYGON:
+            members = SFWT_MEMBERS_CURVES;
+            break;
+        case SF_MULTISURFACE:
+            members = SFWT_MEMBERS_SURFACES;
+            break;
+        case SF_GEOMETRY:
+        case SF_CURVE:
+        case SF_SURFACE:
+            [NSException raise:@"Unexpected Geometry" format:@"Unexpected Geometry Type of %@ which is abstract", [SFGeometryTypes name:geometryType]];
+        case SF_NONE:
+        default:
+            [NSException raise:@"Unsupported Geometry" format:@"Geometry Type not supported: %@", [SFGeometryTypes name:geometryType]];
+    }
+
+    return members;
+}
+
+@end
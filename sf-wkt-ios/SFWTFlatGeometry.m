@@ -0,0 +1,472 @@
+//
+//  SFWTFlatGeometry.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTFlatGeometry.h>
+
+/**
+ * Scratch coordinate stride, x y z m and the presence mask
+ */
+static int const SCRATCH_STRIDE = 5;
+
+/**
+ * Arena scratch buffers of the flat geometry builder
+ */
+static int const SCRATCH_NODES = 0;
+static int const SCRATCH_COORDINATES = 1;
+static int const SCRATCH_STACK = 2;
+
+@interface SFWTFlatGeometry()
+
+/**
+ * Owner of the node and coordinate memory
+ */
+@property (nonatomic, strong) NSObject *owner;
+
+@end
+
+@implementation SFWTFlatGeometry{
+    const SFWTFlatNode *_nodes;
+    const double *_coordinates;
+    NSUInteger _generation;
+}
+
+-(instancetype) initWithNodes: (const SFWTFlatNode *) nodes andCoordinates: (const double *) coordinates andOwner: (NSObject *) owner{
+    self = [super init];
+    if(self != nil){
+        _nodes = nodes;
+        _coordinates = coordinates;
+        _owner = owner;
+        if([owner isKindOfClass:[SFWTGeometryArena class]]){
+            _generation = [(SFWTGeometryArena *)owner generation];
+        }
+    }
+    return self;
+}
+
++(SFWTFlatGeometry *) flatGeometryWithEventReader: (SFWTEventReader *) eventReader andArena: (SFWTGeometryArena *) arena{
+    return [self flatGeometryWithEventReader:eventReader andArena:arena andTransform:nil];
+}
+
++(SFWTFlatGeometry *) flatGeometryWithEventReader: (SFWTEventReader *) eventReader andArena: (SFWTGeometryArena *) arena andTransform: (SFWTCoordinateTransform) transform{
+
+    if([eventReader next] == SFWT_EVENT_NONE){
+        return nil;
+    }
+
+    SFWTFlatGeometry *flatGeometry = nil;
+
+    // Build state lives in arena scratch buffers reused across geometries
+    uint32_t nodeCapacity = (uint32_t) MAX(16, [arena scratchSize:SCRATCH_NODES] / sizeof(SFWTFlatNode));
+    uint32_t nodeCount = 0;
+    SFWTFlatNode *nodes = [arena scratch:SCRATCH_NODES withSize:nodeCapacity * sizeof(SFWTFlatNode)];
+
+    NSUInteger scratchCapacity = MAX(64 * SCRATCH_STRIDE, [arena scratchSize:SCRATCH_COORDINATES] / (SCRATCH_STRIDE * sizeof(double)) * SCRATCH_STRIDE);
+    NSUInteger scratchCount = 0;
+    double *scratch = [arena scratch:SCRATCH_COORDINATES withSize:scratchCapacity * sizeof(double)];
+
+    int stackCapacity = (int) MAX(8, [arena scratchSize:SCRATCH_STACK] / sizeof(uint32_t));
+    int stackSize = 0;
+    uint32_t *stack = [arena scratch:SCRATCH_STACK withSize:stackCapacity * sizeof(uint32_t)];
+
+    SFWTEventType eventType = [eventReader eventType];
+    while(eventType != SFWT_EVENT_NONE){
+
+        switch(eventType){
+
+            case SFWT_EVENT_START_GEOMETRY:
+                {
+                    if(nodeCount == nodeCapacity){
+                        nodeCapacity *= 2;
+                        nodes = [arena scratch:SCRATCH_NODES withSize:nodeCapacity * sizeof(SFWTFlatNode)];
+                    }
+                    if(stackSize == stackCapacity){
+                        stackCapacity *= 2;
+                        stack = [arena scratch:SCRATCH_STACK withSize:stackCapacity * sizeof(uint32_t)];
+                    }
+                    if(stackSize > 0){
+                        nodes[stack[stackSize - 1]].numChildren++;
+                    }
+                    SFWTFlatNode *node = &nodes[nodeCount];
+                    memset(node, 0, sizeof(SFWTFlatNode));
+                    node->coordinateOffset = scratchCount;
+                    node->geometryType = [eventReader geometryType];
+                    if([eventReader hasZ]){
+                        node->flags |= SFWT_FLAT_DECLARED_Z;
+                    }
+                    if([eventReader hasM]){
+                        node->flags |= SFWT_FLAT_DECLARED_M;
+                    }
+                    stack[stackSize++] = nodeCount++;
+                }
+                break;
+
+            case SFWT_EVENT_COORDINATE:
+                {
+                    if(scratchCount == scratchCapacity){
+                        scratchCapacity *= 2;
+                        scratch = [arena scratch:SCRATCH_COORDINATES withSize:scratchCapacity * sizeof(double)];
+                    }
+                    double *coordinate = scratch + scratchCount;
+                    coordinate[0] = [eventReader x];
+                    coordinate[1] = [eventReader y];
+                    coordinate[2] = [eventReader z];
+                    coordinate[3] = [eventReader m];
+                    coordinate[4] = ([eventReader hasZ] ? SFWT_FLAT_PRESENT_Z : 0) | ([eventReader hasM] ? SFWT_FLAT_PRESENT_M : 0);
+                    scratchCount += SCRATCH_STRIDE;
+                    nodes[stack[stackSize - 1]].numCoordinates++;
+                }
+                break;
+
+            case SFWT_EVENT_END_GEOMETRY:
+                {
+                    uint32_t index = stack[--stackSize];
+                    SFWTFlatNode *node = &nodes[index];
+                    node->hasZ = [eventReader hasZ];
+                    node->hasM = [eventReader hasM];
+                    node->subtreeSize = nodeCount - index;
+                }
+                break;
+
+            default:
+                break;
+        }
+
+        if(stackSize == 0){
+            break;
+        }
+        eventType = [eventReader next];
+    }
+
+    if(stackSize > 0){
+        [NSException raise:@"Invalid Token" format:@"Unexpected end of text within %@", [SFGeometryTypes name:nodes[stack[stackSize - 1]].geometryType]];
+    }
+
+    // Compact the coordinates to each node's final dimensions, flagging
+    // nodes where undeclared values are missing from some coordinates
+    NSUInteger coordinateCount = 0;
+    for(uint32_t i = 0; i < nodeCount; i++){
+        SFWTFlatNode *node = &nodes[i];
+        int expected = (node->hasZ && !(node->flags & SFWT_FLAT_DECLARED_Z) ? SFWT_FLAT_PRESENT_Z : 0)
+            | (node->hasM && !(node->flags & SFWT_FLAT_DECLARED_M) ? SFWT_FLAT_PRESENT_M : 0);
+        if(expected != 0){
+            const double *source = scratch + node->coordinateOffset;
+            for(uint32_t j = 0; j < node->numCoordinates; j++, source += SCRATCH_STRIDE){
+                if(((int) source[4] & expected) != expected){
+                    node->flags |= SFWT_FLAT_PARTIAL;
+                    break;
+                }
+            }
+        }
+        coordinateCount += [self numValuesOfNode:node];
+    }
+
+    NSUInteger nodesSize = nodeCount * sizeof(SFWTFlatNode);
+    uint8_t *memory = [arena allocate:nodesSize + coordinateCount * sizeof(double)];
+    SFWTFlatNode *arenaNodes = (SFWTFlatNode *) memory;
+    double *arenaCoordinates = (double *)(memory + nodesSize);
+
+    double *target = arenaCoordinates;
+    for(uint32_t i = 0; i < nodeCount; i++){
+        SFWTFlatNode *node = &arenaNodes[i];
+        *node = nodes[i];
+        const double *source = scratch + node->coordinateOffset;
+        node->coordinateOffset = target - arenaCoordinates;
+        for(uint32_t j = 0; j < node->numCoordinates; j++){
+            *target++ = source[0];
+            *target++ = source[1];
+            if(node->hasZ){
+                *target++ = source[2];
+            }
+            if(node->hasM){
+                *target++ = source[3];
+            }
+            source += SCRATCH_STRIDE;
+        }
+        if(node->flags & SFWT_FLAT_PARTIAL){
+            uint8_t *presence = (uint8_t *) target;
+            source = scratch + nodes[i].coordinateOffset;
+            for(uint32_t j = 0; j < node->numCoordinates; j++, source += SCRATCH_STRIDE){
+                presence[j] = (uint8_t) source[4];
+            }
+            NSUInteger presenceValues = (node->numCoordinates + sizeof(double) - 1) / sizeof(double);
+            memset(presence + node->numCoordinates, 0, presenceValues * sizeof(double) - node->numCoordinates);
+            target += presenceValues;
+        }
+    }
+
+    if(transform != nil){
+        // Transform runs of consecutive nodes with the same dimension
+        NSUInteger runStart = 0;
+        NSUInteger runCount = 0;
+        int runDimension = 0;
+        for(uint32_t i = 0; i < nodeCount; i++){
+            SFWTFlatNode *node = &arenaNodes[i];
+            if(node->numCoordinates == 0){
+                continue;
+            }
+            int dimension = 2 + node->hasZ + node->hasM;
+            if(runCount > 0 && dimension != runDimension){
+                transform(arenaCoordinates + runStart, runCount, runDimension);
+                runCount = 0;
+            }
+            if(runCount == 0){
+                runStart = node->coordinateOffset;
+                runDimension = dimension;
+            }
+            runCount += node->numCoordinates;
+            // The presence mask separates the next node's coordinates
+            if(node->flags & SFWT_FLAT_PARTIAL){
+                transform(arenaCoordinates + runStart, runCount, runDimension);
+                runCount = 0;
+            }
+        }
+        if(runCount > 0){
+            transform(arenaCoordinates + runStart, runCount, runDimension);
+        }
+    }
+
+    flatGeometry = [[SFWTFlatGeometry alloc] initWithNodes:arenaNodes andCoordinates:arenaCoordinates andOwner:arena];
+
+    return flatGeometry;
+}
+
++(uint64_t) numValuesOfNode: (const SFWTFlatNode *) node{
+    uint64_t values = (uint64_t) node->numCoordinates * (2 + node->hasZ + node->hasM);
+    if(node->flags & SFWT_FLAT_PARTIAL){
+        values += ((uint64_t) node->numCoordinates + sizeof(double) - 1) / sizeof(double);
+    }
+    return values;
+}
+
+-(SFGeometryType) geometryType{
+    return [self validNode]->geometryType;
+}
+
+-(BOOL) hasZ{
+    return [self validNode]->hasZ;
+}
+
+-(BOOL) hasM{
+    return [self validNode]->hasM;
+}
+
+-(int) numGeometries{
+    return [self validNode]->numChildren;
+}
+
+-(SFWTFlatGeometry *) geometryAtIndex: (int) index{
+    const SFWTFlatNode *node = [self validNode];
+    if(index < 0 || index >= node->numChildren){
+        [NSException raise:NSRangeException format:@"Index %d out of bounds for %u geometries", index, node->numChildren];
+    }
+    const SFWTFlatNode *child = node + 1;
+    for(int i = 0; i < index; i++){
+        child += child->subtreeSize;
+    }
+    return [[SFWTFlatGeometry alloc] initWithNodes:child andCoordinates:_coordinates andOwner:_owner];
+}
+
+-(int) numPoints{
+    return [self validNode]->numCoordinates;
+}
+
+-(int) stride{
+    const SFWTFlatNode *node = [self validNode];
+    return 2 + node->hasZ + node->hasM;
+}
+
+-(const double *) coordinates{
+    return _coordinates + [self validNode]->coordinateOffset;
+}
+
+-(const SFWTFlatNode *) node{
+    return [self validNode];
+}
+
+-(SFGeometry *) geometry{
+    return [self geometryOfNode:[self validNode]];
+}
+
+/**
+ * Get the root node, verifying the arena storage has not been reset
+ *
+ * @return node
+ */
+-(const SFWTFlatNode *) validNode{
+    if([_owner isKindOfClass:[SFWTGeometryArena class]]
+       && [(SFWTGeometryArena *)_owner generation] != _generation){
+        [NSException raise:@"Invalid Geometry" format:@"Flat geometry storage was released by an arena reset"];
+    }
+    return _nodes;
+}
+
+/**
+ * Build the geometry object of a node
+ *
+ * @param node
+ *            flat node
+ *
+ * @return geometry
+ */
+-(SFGeometry *) geometryOfNode: (const SFWTFlatNode *) node{
+
+    SFGeometry *geometry = nil;
+
+    BOOL hasZ = (node->flags & SFWT_FLAT_DECLARED_Z) != 0;
+    BOOL hasM = (node->flags & SFWT_FLAT_DECLARED_M) != 0;
+    SFGeometryType geometryType = node->geometryType;
+
+    switch(geometryType){
+        case SF_POINT:
+            geometry = [self pointOfNode:node atIndex:0 withHasZ:hasZ andHasM:hasM];
+            break;
+        case SF_LINESTRING:
+        case SF_CIRCULARSTRING:
+            {
+                SFLineString *lineString = geometryType == SF_CIRCULARSTRING
+                    ? [SFCircularString circularStringWithHasZ:hasZ andHasM:hasM]
+                    : [SFLineString lineStringWithHasZ:hasZ andHasM:hasM];
+                for(uint32_t i = 0; i < node->numCoordinates; i++){
+                    [lineString addPoint:[self pointOfNode:node atIndex:i withHasZ:hasZ andHasM:hasM]];
+                }
+                geometry = lineString;
+            }
+            break;
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+            {
+                SFPolygon *polygon = geometryType == SF_TRIANGLE
+                    ? [SFTriangle triangleWithHasZ:hasZ andHasM:hasM]
+                    : [SFPolygon polygonWithHasZ:hasZ andHasM:hasM];
+                for(const SFWTFlatNode *child = node + 1; child < node + node->subtreeSize; child += child->subtreeSize){
+                    [polygon addRing:(SFLineString *)[self geometryOfNode:child]];
+                }
+                geometry = polygon;
+            }
+            break;
+        case SF_CURVEPOLYGON:
+            {
+                SFCurvePolygon *curvePolygon = [SFCurvePolygon curvePolygonWithHasZ:hasZ andHasM:hasM];
+                for(const SFWTFlatNode *child = node + 1; child < node + node->subtreeSize; child += child->subtreeSize){
+                    [curvePolygon addRing:(SFCurve *)[self geometryOfNode:child]];
+                }
+                geometry = curvePolygon;
+            }
+            break;
+        case SF_COMPOUNDCURVE:
+            {
+                SFCompoundCurve *compoundCurve = [SFCompoundCurve compoundCurveWithHasZ:hasZ andHasM:hasM];
+                for(const SFWTFlatNode *child = node + 1; child < node + node->subtreeSize; child += child->subtreeSize){
+                    [compoundCurve addLineString:(SFLineString *)[self geometryOfNode:child]];
+                }
+                geometry = compoundCurve;
+            }
+            break;
+        case SF_MULTIPOINT:
+            {
+                SFMultiPoint *multiPoint = [SFMultiPoint multiPointWithHasZ:hasZ andHasM:hasM];
+                for(const SFWTFlatNode *child = node + 1; child < node + node->subtreeSize; child += child->subtreeSize){
+                    [multiPoint addPoint:(SFPoint *)[self geometryOfNode:child]];
+                }
+                geometry = multiPoint;
+            }
+            break;
+        case SF_MULTILINESTRING:
+            {
+                SFMultiLineString *multiLineString = [SFMultiLineString multiLineStringWithHasZ:hasZ andHasM:hasM];
+                for(const SFWTFlatNode *child = node + 1; child < node + node->subtreeSize; child += child->subtreeSize){
+                    [multiLineString addLineString:(SFLineString *)[self geometryOfNode:child]];
+                }
+                geometry = multiLineString;
+            }
+            break;
+        case SF_MULTIPOLYGON:
+            {
+                SFMultiPolygon *multiPolygon = [SFMultiPolygon multiPolygonWithHasZ:hasZ andHasM:hasM];
+                for(const SFWTFlatNode *child = node + 1; child < node + node->subtreeSize; child += child->subtreeSize){
+                    [multiPolygon addPolygon:(SFPolygon *)[self geometryOfNode:child]];
+                }
+                geometry = multiPolygon;
+            }
+            break;
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            {
+                SFPolyhedralSurface *polyhedralSurface = geometryType == SF_TIN
+                    ? [SFTIN tinWithHasZ:hasZ andHasM:hasM]
+                    : [SFPolyhedralSurface polyhedralSurfaceWithHasZ:hasZ andHasM:hasM];
+                for(const SFWTFlatNode *child = node + 1; child < node + node->subtreeSize; child += child->subtreeSize){
+                    [polyhedralSurface addPolygon:(SFPolygon *)[self geometryOfNode:child]];
+                }
+                geometry = polyhedralSurface;
+            }
+            break;
+        case SF_GEOMETRYCOLLECTION:
+        case SF_MULTICURVE:
+        case SF_MULTISURFACE:
+            {
+                SFGeometryCollection *geometryCollection = [SFGeometryCollection geometryCollectionWithHasZ:hasZ andHasM:hasM];
+                for(const SFWTFlatNode *child = node + 1; child < node + node->subtreeSize; child += child->subtreeSize){
+                    [geometryCollection addGeometry:[self geometryOfNode:child]];
+                }
+                geometry = geometryCollection;
+            }
+            break;
+        default:
+            [NSException raise:@"Unsupported Geometry" format:@"Geometry Type not supported: %@", [SFGeometryTypes name:geometryType]];
+    }
+
+    return geometry;
+}
+
+/**
+ * Build a point from a node coordinate
+ *
+ * @param node
+ *            flat node
+ * @param index
+ *            coordinate index
+ * @param hasZ
+ *            declared z values
+ * @param hasM
+ *            declared m values
+ *
+ * @return point
+ */
+-(SFPoint *) pointOfNode: (const SFWTFlatNode *) node atIndex: (uint32_t) index withHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+
+    int stride = 2 + node->hasZ + node->hasM;
+    const double *coordinate = _coordinates + node->coordinateOffset + index * stride;
+
+    SFPoint *point = [SFPoint pointWithHasZ:hasZ andHasM:hasM andXValue:coordinate[0] andYValue:coordinate[1]];
+
+    // Undeclared values are present on every coordinate unless the node has a presence mask
+    int present = SFWT_FLAT_PRESENT_Z | SFWT_FLAT_PRESENT_M;
+    if(node->flags & SFWT_FLAT_PARTIAL){
+        const uint8_t *presence = (const uint8_t *) (_coordinates + node->coordinateOffset + node->numCoordinates * stride);
+        present = presence[index];
+    }
+
+    int ordinate = 2;
+    if(node->hasZ){
+        double z = coordinate[ordinate++];
+        if(hasZ || (present & SFWT_FLAT_PRESENT_Z)){
+            [point setZValue:z];
+        }
+    }
+    if(node->hasM){
+        double m = coordinate[ordinate];
+        if(hasM || (present & SFWT_FLAT_PRESENT_M)){
+            [point setMValue:m];
+        }
+    }
+
+    return point;
+}
+
+@end
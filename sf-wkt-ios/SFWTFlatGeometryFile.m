@@ -0,0 +1,305 @@
+//
+//  SFWTFlatGeometryFile.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTFlatGeometryFile.h>
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+
+/**
+ * Byte order mark, read back as a different value on other byte orders
+ */
+static uint32_t const BYTE_ORDER_MARK = 0x01020304;
+
+/**
+ * Section alignment
+ */
+static NSUInteger const ALIGNMENT = 16;
+
+static NSUInteger sfwt_align(NSUInteger offset){
+    return (offset + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+}
+
+@interface SFWTFlatGeometryFile()
+
+/**
+ * File data
+ */
+@property (nonatomic, strong) NSData *data;
+
+@end
+
+@implementation SFWTFlatGeometryFile{
+    const SFWTFlatFileHeader *_header;
+    const SFWTFlatFileRecord *_records;
+    const SFWTFlatNode *_nodes;
+    const double *_coordinates;
+}
+
++(SFWTFlatGeometryFile *) fileWithPath: (NSString *) path error: (NSError **) error{
+    SFWTFlatGeometryFile *file = nil;
+    NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedAlways error:error];
+    if(data != nil){
+        file = [[SFWTFlatGeometryFile alloc] initWithData:data];
+    }
+    return file;
+}
+
+-(instancetype) initWithData: (NSData *) data{
+    self = [super init];
+    if(self != nil){
+        _data = data;
+
+        const uint8_t *bytes = [data bytes];
+        NSUInteger length = [data length];
+        if(length < sizeof(SFWTFlatFileHeader)){
+            [self invalid:@"File is smaller than the header"];
+        }
+        _header = (const SFWTFlatFileHeader *) bytes;
+        if(memcmp(_header->magic, SFWT_FLAT_FILE_MAGIC, sizeof(_header->magic)) != 0){
+            [self invalid:@"Not a flat geometry file"];
+        }
+        if(_header->version != SFWT_FLAT_FILE_VERSION){
+            [self invalid:[NSString stringWithFormat:@"Unsupported version %u", _header->version]];
+        }
+        if(_header->byteOrderMark != BYTE_ORDER_MARK){
+            [self invalid:@"File was written with a different byte order"];
+        }
+
+        [self verifySectionAtOffset:_header->recordsOffset withCount:_header->numRecords andSize:sizeof(SFWTFlatFileRecord)];
+        [self verifySectionAtOffset:_header->nodesOffset withCount:_header->numNodes andSize:sizeof(SFWTFlatNode)];
+        [self verifySectionAtOffset:_header->coordinatesOffset withCount:_header->numCoordinates andSize:sizeof(double)];
+
+        _records = (const SFWTFlatFileRecord *) (bytes + _header->recordsOffset);
+        _nodes = (const SFWTFlatNode *) (bytes + _header->nodesOffset);
+        _coordinates = (const double *) (bytes + _header->coordinatesOffset);
+    }
+    return self;
+}
+
+-(NSUInteger) count{
+    return (NSUInteger) _header->numRecords;
+}
+
+-(SFWTFlatGeometry *) flatGeometryAtIndex: (NSUInteger) index{
+    if(index >= _header->numRecords){
+        [NSException raise:NSRangeException format:@"Index %lu out of bounds for %llu records", (unsigned long)index, _header->numRecords];
+    }
+    SFWTFlatGeometry *flatGeometry = nil;
+    const SFWTFlatFileRecord *record = &_records[index];
+    if(record->numNodes > 0){
+        [self verifyRecord:record];
+        flatGeometry = [[SFWTFlatGeometry alloc] initWithNodes:_nodes + record->firstNode andCoordinates:_coordinates andOwner:_data];
+    }
+    return flatGeometry;
+}
+
+-(SFGeometry *) geometryAtIndex: (NSUInteger) index{
+    return [[self flatGeometryAtIndex:index] geometry];
+}
+
+-(NSUInteger) numCoordinates{
+    return (NSUInteger) _header->numCoordinates;
+}
+
+-(const double *) coordinates{
+    return _coordinates;
+}
+
+/**
+ * Verify a section is aligned and within the file
+ *
+ * @param offset
+ *            section offset
+ * @param count
+ *            number of entries
+ * @param size
+ *            entry size
+ */
+-(void) verifySectionAtOffset: (uint64_t) offset withCount: (uint64_t) count andSize: (NSUInteger) size{
+    uint64_t length = [_data length];
+    if(offset % ALIGNMENT != 0 || offset < sizeof(SFWTFlatFileHeader) || offset > length || count > (length - offset) / size){
+        [self invalid:@"Section is out of bounds"];
+    }
+}
+
+/**
+ * Verify the nodes of a record reference only memory within the file, so
+ * corrupt files raise instead of reading out of bounds
+ *
+ * @param record
+ *            record
+ */
+-(void) verifyRecord: (const SFWTFlatFileRecord *) record{
+
+    uint64_t numNodes = record->numNodes;
+    if(record->firstNode > _header->numNodes || numNodes > _header->numNodes - record->firstNode){
+        [self invalid:@"Record nodes are out of bounds"];
+    }
+
+    const SFWTFlatNode *nodes = _nodes + record->firstNode;
+    if(nodes[0].subtreeSize != numNodes){
+        [self invalid:@"Record node count does not match the geometry"];
+    }
+
+    for(uint64_t i = 0; i < numNodes; i++){
+        const SFWTFlatNode *node = &nodes[i];
+        if(node->subtreeSize < 1 || node->subtreeSize > numNodes - i || node->hasZ > 1 || node->hasM > 1){
+            [self invalid:@"Invalid node"];
+        }
+        uint64_t values = [SFWTFlatGeometry numValuesOfNode:node];
+        if(node->coordinateOffset > _header->numCoordinates || values > _header->numCoordinates - node->coordinateOffset){
+            [self invalid:@"Node coordinates are out of bounds"];
+        }
+        uint64_t child = i + 1;
+        uint64_t end = i + node->subtreeSize;
+        for(uint32_t j = 0; j < node->numChildren; j++){
+            if(child >= end){
+                [self invalid:@"Node children exceed the subtree"];
+            }
+            child += nodes[child].subtreeSize;
+        }
+        if(child > end){
+            [self invalid:@"Node children exceed the subtree"];
+        }
+    }
+
+}
+
+/**
+ * Raise an invalid file exception
+ *
+ * @param reason
+ *            reason
+ */
+-(void) invalid: (NSString *) reason{
+    [NSException raise:@"Invalid Flat Geometry File" format:@"%@", reason];
+}
+
+@end
+
+@implementation SFWTFlatGeometryFileWriter{
+    SFWTGeometryArena *_arena;
+    NSMutableData *_records;
+    NSMutableData *_nodes;
+    NSMutableData *_coordinates;
+}
+
++(BOOL) writeText: (NSString *) text toFile: (NSString *) path error: (NSError **) error{
+    SFWTFlatGeometryFileWriter *writer = [[SFWTFlatGeometryFileWriter alloc] init];
+    [writer addAllText:text];
+    return [writer writeToFile:path error:error];
+}
+
+-(instancetype) init{
+    self = [super init];
+    if(self != nil){
+        _arena = [[SFWTGeometryArena alloc] init];
+        _records = [NSMutableData data];
+        _nodes = [NSMutableData data];
+        _coordinates = [NSMutableData data];
+    }
+    return self;
+}
+
+-(void) addText: (NSString *) text{
+    SFWTEventReader *eventReader = [[SFWTEventReader alloc] initWithReader:[SFWTIndexedTextReader readerWithText:text]];
+    [eventReader setLimits:_limits];
+    [self addFlatGeometry:[SFWTFlatGeometry flatGeometryWithEventReader:eventReader andArena:_arena]];
+}
+
+-(NSUInteger) addAllText: (NSString *) text{
+    NSUInteger added = 0;
+    SFWTEventReader *eventReader = [[SFWTEventReader alloc] initWithReader:[SFWTIndexedTextReader readerWithText:text]];
+    [eventReader setLimits:_limits];
+    NSUInteger empty = 0;
+    SFWTFlatGeometry *flatGeometry;
+    do{
+        flatGeometry = [SFWTFlatGeometry flatGeometryWithEventReader:eventReader andArena:_arena];
+        // Empty geometries read before the geometry keep their records
+        for(; empty < [eventReader numEmpty]; empty++){
+            [self addFlatGeometry:nil];
+            added++;
+        }
+        if(flatGeometry != nil){
+            [self addFlatGeometry:flatGeometry];
+            added++;
+        }
+    }while(flatGeometry != nil);
+    return added;
+}
+
+-(NSUInteger) count{
+    return [_records length] / sizeof(SFWTFlatFileRecord);
+}
+
+/**
+ * Add a record for the flat geometry, rebasing its coordinate offsets into
+ * the file coordinate array, and release the arena storage
+ *
+ * @param flatGeometry
+ *            flat geometry or nil for an empty record
+ */
+-(void) addFlatGeometry: (SFWTFlatGeometry *) flatGeometry{
+
+    SFWTFlatFileRecord record;
+    record.firstNode = [_nodes length] / sizeof(SFWTFlatNode);
+    record.numNodes = 0;
+
+    if(flatGeometry != nil){
+
+        const SFWTFlatNode *nodes = [flatGeometry node];
+        // The root coordinates start the geometry's contiguous coordinates
+        const double *coordinates = [flatGeometry coordinates];
+        uint64_t base = [_coordinates length] / sizeof(double);
+
+        uint64_t values = 0;
+        record.numNodes = nodes[0].subtreeSize;
+        for(uint32_t i = 0; i < record.numNodes; i++){
+            SFWTFlatNode node = nodes[i];
+            values += [SFWTFlatGeometry numValuesOfNode:&node];
+            node.coordinateOffset += base;
+            [_nodes appendBytes:&node length:sizeof(SFWTFlatNode)];
+        }
+        [_coordinates appendBytes:coordinates length:values * sizeof(double)];
+
+        [_arena reset];
+    }
+
+    [_records appendBytes:&record length:sizeof(SFWTFlatFileRecord)];
+}
+
+-(NSData *) data{
+
+    SFWTFlatFileHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, SFWT_FLAT_FILE_MAGIC, sizeof(header.magic));
+    header.version = SFWT_FLAT_FILE_VERSION;
+    header.byteOrderMark = BYTE_ORDER_MARK;
+    header.numRecords = [self count];
+    header.numNodes = [_nodes length] / sizeof(SFWTFlatNode);
+    header.numCoordinates = [_coordinates length] / sizeof(double);
+    header.recordsOffset = sfwt_align(sizeof(SFWTFlatFileHeader));
+    header.nodesOffset = sfwt_align(header.recordsOffset + [_records length]);
+    header.coordinatesOffset = sfwt_align(header.nodesOffset + [_nodes length]);
+
+    NSMutableData *data = [NSMutableData dataWithCapacity:header.coordinatesOffset + [_coordinates length]];
+    [data appendBytes:&header length:sizeof(header)];
+    [data setLength:header.recordsOffset];
+    [data appendData:_records];
+    [data setLength:header.nodesOffset];
+    [data appendData:_nodes];
+    [data setLength:header.coordinatesOffset];
+    [data appendData:_coordinates];
+
+    return data;
+}
+
+-(BOOL) writeToFile: (NSString *) path error: (NSError **) error{
+    return [[self data] writeToFile:path options:NSDataWritingAtomic error:error];
+}
+
+@end
@@ -0,0 +1,426 @@
+//
+//  SFWTGeoJSONTranscoder.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTGeoJSONTranscoder.h>
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+#import <SimpleFeaturesWKT/SFWTGeometryWriter.h>
+
+/**
+ * Stream output chunk size
+ */
+static NSUInteger const CHUNK_SIZE = 16384;
+
+/**
+ * JSON shape an open geometry is written as
+ */
+typedef NS_ENUM(NSInteger, SFWTJSONShape){
+    /** Single position */
+    SFWT_JSON_POSITION,
+    /** Array of positions or nested arrays */
+    SFWT_JSON_ARRAY,
+    /** Compound curve segment, positions written to the parent array */
+    SFWT_JSON_SEGMENT,
+    /** Surface within a multi surface, polygons written to the parent array */
+    SFWT_JSON_FLATTEN,
+    /** Geometry collection geometries array */
+    SFWT_JSON_COLLECTION
+};
+
+/**
+ * Open geometry being written
+ */
+typedef struct {
+    SFGeometryType geometryType;
+    SFWTJSONShape shape;
+    BOOL object;
+    BOOL circular;
+    BOOL skipFirst;
+    int members;
+    int segments;
+    int coordinates;
+    double start[4];
+    double middle[4];
+} SFWTJSONFrame;
+
+@interface SFWTGeoJSONTranscoder()
+
+/**
+ * Event reader
+ */
+@property (nonatomic, strong) SFWTEventReader *eventReader;
+
+@end
+
+@implementation SFWTGeoJSONTranscoder{
+    SFWTJSONFrame *_frames;
+    int _capacity;
+    int _size;
+    NSMutableData *_data;
+}
+
++(NSData *) geoJSONWithText: (NSString *) text{
+    return [[[SFWTGeoJSONTranscoder alloc] initWithText:text] write];
+}
+
++(NSString *) geoJSONStringWithText: (NSString *) text{
+    NSString *json = nil;
+    NSData *data = [self geoJSONWithText:text];
+    if(data != nil){
+        json = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+    }
+    return json;
+}
+
+-(instancetype) initWithText: (NSString *) text{
+    return [self initWithReader:[SFWTIndexedTextReader readerWithText:text]];
+}
+
+-(instancetype) initWithReader: (SFTextReader *) reader{
+    self = [super init];
+    if(self != nil){
+        _eventReader = [[SFWTEventReader alloc] initWithReader:reader];
+        _curvePolicy = SFWT_CURVE_LINEARIZE;
+        _linearizer = [[SFWTArcLinearizer alloc] init];
+        _capacity = 8;
+        _frames = malloc(_capacity * sizeof(SFWTJSONFrame));
+    }
+    return self;
+}
+
+-(void) dealloc{
+    free(_frames);
+}
+
+-(NSData *) write{
+    NSMutableData *data = [NSMutableData data];
+    return [self writeToData:data] ? data : nil;
+}
+
+-(BOOL) writeToData: (NSMutableData *) data{
+    return [self writeToData:data andStream:nil];
+}
+
+-(BOOL) writeToStream: (NSOutputStream *) stream{
+    NSMutableData *data = [NSMutableData dataWithCapacity:CHUNK_SIZE];
+    BOOL written = [self writeToData:data andStream:stream];
+    [self flushData:data toStream:stream];
+    return written;
+}
+
+/**
+ * Transcode the next non empty geometry, appending to the data and
+ * flushing full chunks to the optional stream
+ *
+ * @param data
+ *            GeoJSON output
+ * @param stream
+ *            output stream or nil
+ *
+ * @return true if a geometry was written
+ */
+-(BOOL) writeToData: (NSMutableData *) data andStream: (NSOutputStream *) stream{
+
+    [_eventReader setLimits:_limits];
+
+    if([_eventReader next] == SFWT_EVENT_NONE){
+        return NO;
+    }
+
+    _data = data;
+    _size = 0;
+
+    @try{
+
+        do{
+
+            switch([_eventReader eventType]){
+                case SFWT_EVENT_START_GEOMETRY:
+                    [self startGeometry];
+                    break;
+                case SFWT_EVENT_COORDINATE:
+                    [self coordinate];
+                    break;
+                case SFWT_EVENT_END_GEOMETRY:
+                    [self endGeometry];
+                    break;
+                default:
+                    break;
+            }
+
+            if(stream != nil && [data length] >= CHUNK_SIZE){
+                [self flushData:data toStream:stream];
+            }
+
+        } while(_size > 0 && [_eventReader next] != SFWT_EVENT_NONE);
+
+    }@finally{
+        _data = nil;
+    }
+
+    if(_size > 0){
+        [NSException raise:@"Invalid Token" format:@"Unexpected end of text, %d geometries not closed", _size];
+    }
+
+    return YES;
+}
+
+/**
+ * Handle a start geometry event
+ */
+-(void) startGeometry{
+
+    SFGeometryType geometryType = [_eventReader geometryType];
+    SFWTJSONFrame *parent = _size > 0 ? &_frames[_size - 1] : NULL;
+
+    if(geometryType == SF_CIRCULARSTRING && _curvePolicy == SFWT_CURVE_ERROR){
+        [NSException raise:@"Unsupported Geometry" format:@"GeoJSON does not support circular arcs: %@", [SFGeometryTypes name:geometryType]];
+    }
+
+    if(_size == _capacity){
+        _capacity *= 2;
+        _frames = reallocf(_frames, _capacity * sizeof(SFWTJSONFrame));
+        parent = &_frames[_size - 1];
+    }
+    SFWTJSONFrame *frame = &_frames[_size++];
+    memset(frame, 0, sizeof(SFWTJSONFrame));
+    frame->geometryType = geometryType;
+    frame->circular = geometryType == SF_CIRCULARSTRING;
+
+    if(parent == NULL || parent->shape == SFWT_JSON_COLLECTION){
+
+        frame->object = YES;
+        if(parent != NULL){
+            [self beginMemberOfFrame:_size - 2];
+        }
+        [self appendCString:"{\"type\":\""];
+        [self appendCString:[[SFWTGeoJSONTranscoder geoJSONTypeOfGeometryType:geometryType] UTF8String]];
+        if(geometryType == SF_GEOMETRYCOLLECTION){
+            [self appendCString:"\",\"geometries\":["];
+            frame->shape = SFWT_JSON_COLLECTION;
+        }else{
+            [self appendCString:"\",\"coordinates\":"];
+            if(geometryType == SF_POINT){
+                frame->shape = SFWT_JSON_POSITION;
+            }else{
+                [self appendCString:"["];
+                frame->shape = SFWT_JSON_ARRAY;
+            }
+        }
+
+    }else if(parent->geometryType == SF_COMPOUNDCURVE){
+
+        frame->shape = SFWT_JSON_SEGMENT;
+        frame->skipFirst = parent->segments++ > 0;
+
+    }else if(parent->geometryType == SF_MULTISURFACE
+             && (geometryType == SF_POLYHEDRALSURFACE || geometryType == SF_TIN)){
+
+        frame->shape = SFWT_JSON_FLATTEN;
+
+    }else if(geometryType == SF_POINT){
+
+        frame->shape = SFWT_JSON_POSITION;
+
+    }else{
+
+        [self beginMemberOfFrame:_size - 2];
+        [self appendCString:"["];
+        frame->shape = SFWT_JSON_ARRAY;
+
+    }
+
+}
+
+/**
+ * Handle a coordinate event
+ */
+-(void) coordinate{
+
+    SFWTJSONFrame *frame = &_frames[_size - 1];
+
+    double point[4];
+    point[0] = [_eventReader x];
+    point[1] = [_eventReader y];
+    point[2] = [_eventReader z];
+    point[3] = NAN;
+
+    int index = frame->coordinates++;
+
+    if(frame->circular && index > 0){
+        if(index % 2 == 1){
+            memcpy(frame->middle, point, sizeof(point));
+        }else{
+            [_linearizer linearizeArcWithStart:frame->start andMiddle:frame->middle andEnd:point usingBlock:^(const double *linearized){
+                [self writePosition:linearized ofFrame:self->_size - 1];
+            }];
+            memcpy(frame->start, point, sizeof(point));
+        }
+    }else{
+        if(frame->circular){
+            memcpy(frame->start, point, sizeof(point));
+        }
+        if(index > 0 || !frame->skipFirst){
+            [self writePosition:point ofFrame:_size - 1];
+        }
+    }
+
+}
+
+/**
+ * Handle an end geometry event
+ */
+-(void) endGeometry{
+
+    SFWTJSONFrame *frame = &_frames[_size - 1];
+
+    if(frame->circular && frame->coordinates > 1 && frame->coordinates % 2 == 0){
+        // Incomplete arc, continue to the unmatched point
+        [self writePosition:frame->middle ofFrame:_size - 1];
+    }
+
+    if(frame->shape == SFWT_JSON_ARRAY || frame->shape == SFWT_JSON_COLLECTION){
+        [self appendCString:"]"];
+    }
+    if(frame->object){
+        [self appendCString:"}"];
+    }
+
+    _size--;
+}
+
+/**
+ * Write a member separator when needed to the nearest array at or below
+ * the frame and count the member
+ *
+ * @param index
+ *            frame index
+ */
+-(void) beginMemberOfFrame: (int) index{
+    while(index >= 0 && _frames[index].shape != SFWT_JSON_ARRAY && _frames[index].shape != SFWT_JSON_COLLECTION){
+        index--;
+    }
+    if(index >= 0){
+        SFWTJSONFrame *frame = &_frames[index];
+        if(frame->members++ > 0){
+            [self appendCString:","];
+        }
+    }
+}
+
+/**
+ * Write a position
+ *
+ * @param point
+ *            x, y, z values with NaN z when not present
+ * @param index
+ *            frame index
+ */
+-(void) writePosition: (const double *) point ofFrame: (int) index{
+    if(_frames[index].shape != SFWT_JSON_POSITION || !_frames[index].object){
+        [self beginMemberOfFrame:index];
+    }
+    [self appendCString:"["];
+    [self appendValue:point[0]];
+    [self appendCString:","];
+    [self appendValue:point[1]];
+    if(!isnan(point[2])){
+        [self appendCString:","];
+        [self appendValue:point[2]];
+    }
+    [self appendCString:"]"];
+}
+
+/**
+ * Append a JSON number
+ *
+ * @param value
+ *            finite value
+ */
+-(void) appendValue: (double) value{
+    if(!isfinite(value)){
+        [NSException raise:@"Invalid Value" format:@"GeoJSON does not support non finite coordinate values: %f", value];
+    }
+    char buffer[SFWT_VALUE_BUFFER_SIZE];
+    int length = [SFWTGeometryWriter formatValue:value toBuffer:buffer];
+    [_data appendBytes:buffer length:length];
+}
+
+/**
+ * Append a C string
+ *
+ * @param string
+ *            C string
+ */
+-(void) appendCString: (const char *) string{
+    [_data appendBytes:string length:strlen(string)];
+}
+
+/**
+ * Write and clear the buffered data to the stream
+ *
+ * @param data
+ *            buffered data
+ * @param stream
+ *            output stream
+ */
+-(void) flushData: (NSMutableData *) data toStream: (NSOutputStream *) stream{
+    const uint8_t *bytes = [data bytes];
+    NSUInteger length = [data length];
+    NSUInteger offset = 0;
+    while(offset < length){
+        NSInteger written = [stream write:bytes + offset maxLength:length - offset];
+        if(written <= 0){
+            [NSException raise:@"Stream Write" format:@"Failed to write GeoJSON to stream: %@", [stream streamError]];
+        }
+        offset += written;
+    }
+    [data setLength:0];
+}
+
++(NSString *) geoJSONTypeOfGeometryType: (SFGeometryType) geometryType{
+
+    NSString *type = nil;
+
+    switch(geometryType){
+        case SF_POINT:
+            type = @"Point";
+            break;
+        case SF_LINESTRING:
+        case SF_CIRCULARSTRING:
+        case SF_COMPOUNDCURVE:
+            type = @"LineString";
+            break;
+        case SF_POLYGON:
+        case SF_CURVEPOLYGON:
+        case SF_TRIANGLE:
+            type = @"Polygon";
+            break;
+        case SF_MULTIPOINT:
+            type = @"MultiPoint";
+            break;
+        case SF_MULTILINESTRING:
+        case SF_MULTICURVE:
+            type = @"MultiLineString";
+            break;
+        case SF_MULTIPOLYGON:
+        case SF_MULTISURFACE:
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            type = @"MultiPolygon";
+            break;
+        case SF_GEOMETRYCOLLECTION:
+            type = @"GeometryCollection";
+            break;
+        default:
+            [NSException raise:@"Unsupported Geometry" format:@"Geometry Type not supported by GeoJSON: %@", [SFGeometryTypes name:geometryType]];
+    }
+
+    return type;
+}
+
+@end
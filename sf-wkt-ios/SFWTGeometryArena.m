@@ -0,0 +1,179 @@
+//
+//  SFWTGeometryArena.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTGeometryArena.h>
+
+NSUInteger const SFWT_ARENA_DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+/**
+ * Allocation alignment
+ */
+static NSUInteger const ARENA_ALIGNMENT = 16;
+
+/**
+ * Arena block, data follows the header
+ */
+typedef struct SFWTArenaBlock {
+    struct SFWTArenaBlock *next;
+    NSUInteger capacity;
+    NSUInteger used;
+    NSUInteger padding;
+} SFWTArenaBlock;
+
+@implementation SFWTGeometryArena{
+    SFWTArenaBlock *_head;
+    NSUInteger _blockSize;
+    NSUInteger _size;
+    NSUInteger _capacity;
+    NSUInteger _generation;
+    void *_scratch[SFWT_ARENA_SCRATCH_BUFFERS];
+    NSUInteger _scratchSize[SFWT_ARENA_SCRATCH_BUFFERS];
+}
+
+-(instancetype) init{
+    return [self initWithBlockSize:SFWT_ARENA_DEFAULT_BLOCK_SIZE];
+}
+
+-(instancetype) initWithBlockSize: (NSUInteger) blockSize{
+    self = [super init];
+    if(self != nil){
+        _blockSize = MAX(blockSize, ARENA_ALIGNMENT);
+        _head = NULL;
+        _size = 0;
+        _capacity = 0;
+        _generation = 0;
+    }
+    return self;
+}
+
+-(void) dealloc{
+    [self freeBlocksFrom:_head];
+    for(int i = 0; i < SFWT_ARENA_SCRATCH_BUFFERS; i++){
+        free(_scratch[i]);
+    }
+}
+
+-(void *) allocate: (NSUInteger) size{
+
+    NSUInteger aligned = (size + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+
+    if(_head == NULL || _head->capacity - _head->used < aligned){
+        NSUInteger capacity = MAX(_blockSize, aligned);
+        SFWTArenaBlock *block = malloc(sizeof(SFWTArenaBlock) + capacity);
+        if(block == NULL){
+            [NSException raise:NSMallocException format:@"Failed to allocate arena block of %lu bytes", (unsigned long)capacity];
+        }
+        block->capacity = capacity;
+        block->used = 0;
+        if(_head != NULL && capacity > _blockSize){
+            // Dedicated block, keep filling the current block
+            block->next = _head->next;
+            _head->next = block;
+        }else{
+            block->next = _head;
+            _head = block;
+        }
+        _capacity += capacity;
+        if(block != _head){
+            block->used = aligned;
+            _size += aligned;
+            return (uint8_t *)(block + 1);
+        }
+    }
+
+    void *memory = (uint8_t *)(_head + 1) + _head->used;
+    _head->used += aligned;
+    _size += aligned;
+
+    return memory;
+}
+
+-(NSUInteger) size{
+    return _size;
+}
+
+-(NSUInteger) capacity{
+    return _capacity;
+}
+
+-(NSUInteger) generation{
+    return _generation;
+}
+
+-(void *) scratch: (int) buffer withSize: (NSUInteger) size{
+    if(buffer < 0 || buffer >= SFWT_ARENA_SCRATCH_BUFFERS){
+        [NSException raise:NSRangeException format:@"Scratch buffer %d out of bounds for %d buffers", buffer, SFWT_ARENA_SCRATCH_BUFFERS];
+    }
+    if(size > _scratchSize[buffer]){
+        NSUInteger capacity = MAX(size, _scratchSize[buffer] * 2);
+        _scratch[buffer] = reallocf(_scratch[buffer], capacity);
+        if(_scratch[buffer] == NULL){
+            _scratchSize[buffer] = 0;
+            [NSException raise:NSMallocException format:@"Failed to allocate arena scratch of %lu bytes", (unsigned long)capacity];
+        }
+        _scratchSize[buffer] = capacity;
+    }
+    return _scratch[buffer];
+}
+
+-(NSUInteger) scratchSize: (int) buffer{
+    if(buffer < 0 || buffer >= SFWT_ARENA_SCRATCH_BUFFERS){
+        [NSException raise:NSRangeException format:@"Scratch buffer %d out of bounds for %d buffers", buffer, SFWT_ARENA_SCRATCH_BUFFERS];
+    }
+    return _scratchSize[buffer];
+}
+
+-(void) reset{
+
+    if(_head != NULL){
+
+        // Keep a single standard size block for reuse
+        SFWTArenaBlock *keep = NULL;
+        SFWTArenaBlock *block = _head;
+        SFWTArenaBlock *released = NULL;
+        while(block != NULL){
+            SFWTArenaBlock *next = block->next;
+            if(keep == NULL && block->capacity == _blockSize){
+                keep = block;
+            }else{
+                block->next = released;
+                released = block;
+            }
+            block = next;
+        }
+        [self freeBlocksFrom:released];
+
+        _head = keep;
+        _capacity = 0;
+        if(keep != NULL){
+            keep->next = NULL;
+            keep->used = 0;
+            _capacity = keep->capacity;
+        }
+
+    }
+
+    _size = 0;
+    _generation++;
+}
+
+/**
+ * Free a linked list of blocks
+ *
+ * @param block
+ *            first block
+ */
+-(void) freeBlocksFrom: (SFWTArenaBlock *) block{
+    while(block != NULL){
+        SFWTArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+}
+
+@end
@@ -0,0 +1,324 @@
+//
+//  SFWTGeometryCache.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTGeometryCache.h>
+#import <SimpleFeaturesWKT/SFWTGeometryReader.h>
+#import <os/lock.h>
+
+NSUInteger const SFWT_CACHE_DEFAULT_MAX_BYTES = 16 * 1024 * 1024;
+
+/**
+ * Approximate fixed size of a cache entry, key and dictionary slot
+ */
+static NSUInteger const ENTRY_ALLOCATION = 160;
+
+/**
+ * Characters hashed per chunk
+ */
+#define SFWT_HASH_CHUNK 256
+
+static uint64_t sfwt_hash_mix(uint64_t hash, uint64_t value){
+    hash ^= value;
+    hash *= 0x9E3779B97F4A7C15ULL;
+    return hash ^ (hash >> 29);
+}
+
+/**
+ * Geometry cache key
+ */
+@interface SFWTGeometryCacheKey : NSObject <NSCopying>
+
+@property (nonatomic, readonly) uint64_t contentHash;
+@property (nonatomic, strong, readonly) NSString *text;
+@property (nonatomic, strong, readonly) NSObject<SFGeometryFilter> *filter;
+@property (nonatomic, strong, readonly) Class expectedType;
+
+@end
+
+@implementation SFWTGeometryCacheKey
+
+-(instancetype) initWithText: (NSString *) text andFilter: (NSObject<SFGeometryFilter> *) filter andExpectedType: (Class) expectedType{
+    self = [super init];
+    if(self != nil){
+        _text = [text copy];
+        _filter = filter;
+        _expectedType = expectedType;
+        uint64_t hash = [SFWTGeometryCache hashOfText:_text];
+        hash = sfwt_hash_mix(hash, (uint64_t) (uintptr_t) (__bridge void *) filter);
+        hash = sfwt_hash_mix(hash, (uint64_t) (uintptr_t) (__bridge void *) expectedType);
+        _contentHash = hash;
+    }
+    return self;
+}
+
+-(id) copyWithZone: (NSZone *) zone{
+    // Immutable
+    return self;
+}
+
+-(NSUInteger) hash{
+    return (NSUInteger) _contentHash;
+}
+
+-(BOOL) isEqual: (id) object{
+    if(self == object){
+        return YES;
+    }
+    if(![object isKindOfClass:[SFWTGeometryCacheKey class]]){
+        return NO;
+    }
+    SFWTGeometryCacheKey *key = (SFWTGeometryCacheKey *) object;
+    return _contentHash == key.contentHash
+        && _filter == key.filter
+        && _expectedType == key.expectedType
+        && [_text isEqualToString:key.text];
+}
+
+@end
+
+/**
+ * Geometry cache entry, a node in the recently used list
+ */
+@interface SFWTGeometryCacheEntry : NSObject
+
+@property (nonatomic, strong) SFWTGeometryCacheKey *key;
+@property (nonatomic, strong) SFGeometry *geometry;
+@property (nonatomic) NSUInteger bytes;
+@property (nonatomic, strong) SFWTGeometryCacheEntry *next;
+@property (nonatomic, unsafe_unretained) SFWTGeometryCacheEntry *previous;
+
+@end
+
+@implementation SFWTGeometryCacheEntry
+
+@end
+
+@implementation SFWTGeometryCache{
+    os_unfair_lock _lock;
+    NSMutableDictionary<SFWTGeometryCacheKey *, SFWTGeometryCacheEntry *> *_entries;
+    SFWTGeometryCacheEntry *_head;
+    SFWTGeometryCacheEntry *_tail;
+    NSUInteger _bytes;
+    NSUInteger _hits;
+    NSUInteger _misses;
+    NSUInteger _evictions;
+}
+
+-(instancetype) init{
+    return [self initWithMaxBytes:SFWT_CACHE_DEFAULT_MAX_BYTES];
+}
+
+-(instancetype) initWithMaxBytes: (NSUInteger) maxBytes{
+    self = [super init];
+    if(self != nil){
+        _maxBytes = maxBytes;
+        _copyResults = YES;
+        _lock = OS_UNFAIR_LOCK_INIT;
+        _entries = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+-(SFGeometry *) readGeometryWithText: (NSString *) text{
+    return [self readGeometryWithText:text andFilter:nil andExpectedType:nil];
+}
+
+-(SFGeometry *) readGeometryWithText: (NSString *) text andFilter: (NSObject<SFGeometryFilter> *) filter andExpectedType: (Class) expectedType{
+
+    SFWTGeometryCacheKey *key = [[SFWTGeometryCacheKey alloc] initWithText:text andFilter:filter andExpectedType:expectedType];
+
+    SFGeometry *geometry = nil;
+    BOOL hit = NO;
+
+    os_unfair_lock_lock(&_lock);
+    SFWTGeometryCacheEntry *entry = [_entries objectForKey:key];
+    if(entry != nil){
+        hit = YES;
+        _hits++;
+        geometry = entry.geometry;
+        [self unlinkEntry:entry];
+        [self insertEntryAtHead:entry];
+    }else{
+        _misses++;
+    }
+    os_unfair_lock_unlock(&_lock);
+
+    if(!hit){
+
+        SFWTGeometryReader *reader = [[SFWTGeometryReader alloc] initWithText:key.text];
+        // Unlimited limits track the approximate allocation
+        [reader setLimits:[SFWTReaderLimits limits]];
+        geometry = [reader readWithFilter:filter andExpectedType:expectedType];
+
+        NSUInteger bytes = ENTRY_ALLOCATION + 2 * [key.text length] + [reader allocation];
+        if(bytes <= _maxBytes){
+            entry = [[SFWTGeometryCacheEntry alloc] init];
+            entry.key = key;
+            entry.geometry = geometry;
+            entry.bytes = bytes;
+
+            os_unfair_lock_lock(&_lock);
+            SFWTGeometryCacheEntry *existing = [_entries objectForKey:key];
+            if(existing != nil){
+                // Parsed concurrently by another thread
+                [self removeEntry:existing];
+            }
+            [_entries setObject:entry forKey:key];
+            [self insertEntryAtHead:entry];
+            _bytes += bytes;
+            while(_bytes > _maxBytes && _tail != nil){
+                [self removeEntry:_tail];
+                _evictions++;
+            }
+            os_unfair_lock_unlock(&_lock);
+        }
+    }
+
+    // Copy shared cached geometries
+    if(geometry != nil && entry != nil && self.copyResults){
+        geometry = [geometry mutableCopy];
+    }
+
+    return geometry;
+}
+
+-(NSUInteger) count{
+    os_unfair_lock_lock(&_lock);
+    NSUInteger count = [_entries count];
+    os_unfair_lock_unlock(&_lock);
+    return count;
+}
+
+-(NSUInteger) bytes{
+    os_unfair_lock_lock(&_lock);
+    NSUInteger bytes = _bytes;
+    os_unfair_lock_unlock(&_lock);
+    return bytes;
+}
+
+-(NSUInteger) hits{
+    os_unfair_lock_lock(&_lock);
+    NSUInteger hits = _hits;
+    os_unfair_lock_unlock(&_lock);
+    return hits;
+}
+
+-(NSUInteger) misses{
+    os_unfair_lock_lock(&_lock);
+    NSUInteger misses = _misses;
+    os_unfair_lock_unlock(&_lock);
+    return misses;
+}
+
+-(NSUInteger) evictions{
+    os_unfair_lock_lock(&_lock);
+    NSUInteger evictions = _evictions;
+    os_unfair_lock_unlock(&_lock);
+    return evictions;
+}
+
+-(void) removeAll{
+    os_unfair_lock_lock(&_lock);
+    while(_tail != nil){
+        [self removeEntry:_tail];
+    }
+    os_unfair_lock_unlock(&_lock);
+}
+
++(uint64_t) hashOfText: (NSString *) text{
+
+    CFStringRef string = (__bridge CFStringRef) text;
+    CFIndex length = CFStringGetLength(string);
+    uint64_t hash = sfwt_hash_mix(0x243F6A8885A308D3ULL, (uint64_t) length);
+
+    const UniChar *characters = CFStringGetCharactersPtr(string);
+    UniChar buffer[SFWT_HASH_CHUNK];
+
+    for(CFIndex location = 0; location < length; location += SFWT_HASH_CHUNK){
+        CFIndex count = MIN(SFWT_HASH_CHUNK, length - location);
+        const UniChar *chunk;
+        if(characters != NULL){
+            chunk = characters + location;
+        }else{
+            CFStringGetCharacters(string, CFRangeMake(location, count), buffer);
+            chunk = buffer;
+        }
+        CFIndex i = 0;
+        for(; i + 4 <= count; i += 4){
+            uint64_t value;
+            memcpy(&value, chunk + i, sizeof(value));
+            hash = sfwt_hash_mix(hash, value);
+        }
+        for(; i < count; i++){
+            hash = sfwt_hash_mix(hash, chunk[i]);
+        }
+    }
+
+    // Final avalanche
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+
+    return hash;
+}
+
+/**
+ * Insert an entry at the head of the recently used list
+ *
+ * @param entry
+ *            cache entry
+ */
+-(void) insertEntryAtHead: (SFWTGeometryCacheEntry *) entry{
+    entry.previous = nil;
+    entry.next = _head;
+    if(_head != nil){
+        _head.previous = entry;
+    }
+    _head = entry;
+    if(_tail == nil){
+        _tail = entry;
+    }
+}
+
+/**
+ * Unlink an entry from the recently used list
+ *
+ * @param entry
+ *            cache entry
+ */
+-(void) unlinkEntry: (SFWTGeometryCacheEntry *) entry{
+    SFWTGeometryCacheEntry *previous = entry.previous;
+    SFWTGeometryCacheEntry *next = entry.next;
+    if(previous != nil){
+        previous.next = next;
+    }else{
+        _head = next;
+    }
+    if(next != nil){
+        next.previous = previous;
+    }else{
+        _tail = previous;
+    }
+    entry.previous = nil;
+    entry.next = nil;
+}
+
+/**
+ * Remove an entry from the cache
+ *
+ * @param entry
+ *            cache entry
+ */
+-(void) removeEntry: (SFWTGeometryCacheEntry *) entry{
+    SFWTGeometryCacheEntry *retained = entry;
+    [self unlinkEntry:retained];
+    [_entries removeObjectForKey:retained.key];
+    _bytes -= retained.bytes;
+}
+
+@end
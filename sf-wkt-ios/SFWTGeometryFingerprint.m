@@ -0,0 +1,208 @@
+//
+//  SFWTGeometryFingerprint.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTGeometryFingerprint.h>
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+
+/**
+ * Hash lane seeds and multipliers
+ */
+static uint64_t const SEED_HIGH = 0x243F6A8885A308D3ULL;
+static uint64_t const SEED_LOW = 0x13198A2E03707344ULL;
+static uint64_t const PRIME_HIGH = 0x9E3779B97F4A7C15ULL;
+static uint64_t const PRIME_LOW = 0xC2B2AE3D27D4EB4FULL;
+
+/**
+ * Event markers hashed ahead of event values
+ */
+static uint64_t const START_MARKER = 1;
+static uint64_t const COORDINATE_MARKER = 2;
+static uint64_t const END_MARKER = 3;
+
+static uint64_t sfwt_fingerprint_mix(uint64_t hash, uint64_t value, uint64_t prime){
+    hash ^= value;
+    hash *= prime;
+    hash = (hash << 31) | (hash >> 33);
+    return hash * prime;
+}
+
+static uint64_t sfwt_fingerprint_finalize(uint64_t hash){
+    hash ^= hash >> 33;
+    hash *= 0xFF51AFD7ED558CCDULL;
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    return hash ^ (hash >> 33);
+}
+
+@interface SFWTGeometryFingerprint()
+
+/**
+ * Event reader
+ */
+@property (nonatomic, strong) SFWTEventReader *eventReader;
+
+@end
+
+@implementation SFWTGeometryFingerprint{
+    uint64_t _high;
+    uint64_t _low;
+}
+
++(SFWTFingerprint) fingerprintWithText: (NSString *) text{
+    return [self fingerprintWithText:text andTolerance:0];
+}
+
++(SFWTFingerprint) fingerprintWithText: (NSString *) text andTolerance: (double) tolerance{
+    SFWTFingerprint fingerprint = {0, 0};
+    SFWTGeometryFingerprint *geometryFingerprint = [[SFWTGeometryFingerprint alloc] initWithText:text];
+    [geometryFingerprint setTolerance:tolerance];
+    [geometryFingerprint readFingerprint:&fingerprint];
+    return fingerprint;
+}
+
++(uint64_t) hashWithText: (NSString *) text{
+    return [self fingerprintWithText:text].low;
+}
+
++(BOOL) isFingerprint: (SFWTFingerprint) fingerprint1 equalToFingerprint: (SFWTFingerprint) fingerprint2{
+    return fingerprint1.high == fingerprint2.high && fingerprint1.low == fingerprint2.low;
+}
+
+-(instancetype) initWithText: (NSString *) text{
+    return [self initWithReader:[SFWTIndexedTextReader readerWithText:text]];
+}
+
+-(instancetype) initWithReader: (SFTextReader *) reader{
+    self = [super init];
+    if(self != nil){
+        _eventReader = [[SFWTEventReader alloc] initWithReader:reader];
+        _tolerance = 0;
+    }
+    return self;
+}
+
+-(BOOL) readFingerprint: (SFWTFingerprint *) fingerprint{
+
+    if(_tolerance < 0 || isnan(_tolerance)){
+        [NSException raise:@"Invalid Tolerance" format:@"Tolerance must be 0 or greater: %f", _tolerance];
+    }
+
+    [_eventReader setLimits:_limits];
+
+    if([_eventReader next] == SFWT_EVENT_NONE){
+        return NO;
+    }
+
+    _high = SEED_HIGH;
+    _low = SEED_LOW;
+
+    int depth = 0;
+    do{
+
+        switch([_eventReader eventType]){
+            case SFWT_EVENT_START_GEOMETRY:
+                [self mix:START_MARKER];
+                [self mix:[SFWTGeometryFingerprint hashTypeOfGeometryType:[_eventReader geometryType]]];
+                depth++;
+                break;
+            case SFWT_EVENT_COORDINATE:
+                [self mix:COORDINATE_MARKER | ([_eventReader hasZ] ? 4 : 0) | ([_eventReader hasM] ? 8 : 0)];
+                [self mixValue:[_eventReader x]];
+                [self mixValue:[_eventReader y]];
+                if([_eventReader hasZ]){
+                    [self mixValue:[_eventReader z]];
+                }
+                if([_eventReader hasM]){
+                    [self mixValue:[_eventReader m]];
+                }
+                break;
+            case SFWT_EVENT_END_GEOMETRY:
+                // Dimensions including untagged ordinates and the child count
+                [self mix:END_MARKER | ([_eventReader hasZ] ? 4 : 0) | ([_eventReader hasM] ? 8 : 0)];
+                [self mix:(uint64_t) [_eventReader count]];
+                depth--;
+                break;
+            default:
+                break;
+        }
+
+    } while(depth > 0 && [_eventReader next] != SFWT_EVENT_NONE);
+
+    if(depth > 0){
+        [NSException raise:@"Invalid Token" format:@"Unexpected end of text, %d geometries not closed", depth];
+    }
+
+    if(fingerprint != NULL){
+        uint64_t high = sfwt_fingerprint_finalize(_high ^ _low);
+        uint64_t low = sfwt_fingerprint_finalize(_low + high);
+        fingerprint->high = high;
+        fingerprint->low = low;
+    }
+
+    return YES;
+}
+
+/**
+ * Mix a value into both hash lanes
+ *
+ * @param value
+ *            value
+ */
+-(void) mix: (uint64_t) value{
+    _high = sfwt_fingerprint_mix(_high, value, PRIME_HIGH);
+    _low = sfwt_fingerprint_mix(_low, value, PRIME_LOW);
+}
+
+/**
+ * Mix a coordinate value, snapped to the tolerance grid when set
+ *
+ * @param value
+ *            coordinate value
+ */
+-(void) mixValue: (double) value{
+    uint64_t bits = 0;
+    if(isnan(value)){
+        bits = 0x7FF8000000000000ULL;
+    }else if(_tolerance > 0 && isfinite(value)){
+        double cell = round(value / _tolerance);
+        // Cells beyond the integer range hash by their value
+        if(fabs(cell) < 9.2e18){
+            bits = (uint64_t) (int64_t) cell;
+        }else{
+            memcpy(&bits, &cell, sizeof(bits));
+        }
+    }else{
+        // Positive and negative zero hash the same
+        double normalized = value == 0 ? 0 : value;
+        memcpy(&bits, &normalized, sizeof(bits));
+    }
+    [self mix:bits];
+}
+
+/**
+ * Get the geometry type hashed for a geometry type, matching the type the
+ * geometry writer outputs
+ *
+ * @param geometryType
+ *            geometry type
+ *
+ * @return hashed geometry type
+ */
++(uint64_t) hashTypeOfGeometryType: (SFGeometryType) geometryType{
+    switch(geometryType){
+        case SF_MULTICURVE:
+        case SF_MULTISURFACE:
+            geometryType = SF_GEOMETRYCOLLECTION;
+            break;
+        default:
+            break;
+    }
+    return (uint64_t) geometryType;
+}
+
+@end
@@ -7,6 +7,13 @@
 //
 
 #import <SimpleFeaturesWKT/SFWTGeometryReader.h>
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+#import <SimpleFeaturesWKT/SFWTArcLinearizer.h>
+
+/**
+ * Number of points passed to the coordinate transform per block
+ */
+static NSUInteger const TRANSFORM_BLOCK_SIZE = 1024;
 
 @interface SFWTGeometryReader()
 
@@ -15,9 +22,286 @@
  */
 @property (nonatomic, strong) SFTextReader *reader;
 
+/**
+ * Current geometry nesting depth
+ */
+@property (nonatomic) int depth;
+
+/**
+ * Coordinates read for the current geometry
+ */
+@property (nonatomic) NSUInteger coordinates;
+
+/**
+ * Approximate bytes allocated for the current geometry
+ */
+@property (nonatomic) NSUInteger allocation;
+
+/**
+ * Validation issues of the current geometry
+ */
+@property (nonatomic, strong) NSMutableArray<SFWTValidationIssue *> *issues;
+
+/**
+ * Point dimensions of the current geometry for validation, -1 before the
+ * first point
+ */
+@property (nonatomic) int pointDimensions;
+
 @end
 
-@implementation SFWTGeometryReader
+/**
+ * Bounds scan result
+ */
+typedef NS_ENUM(NSInteger, SFWTBoundsScan){
+    /** Bounds of all coordinates scanned, the reader is after the geometry */
+    SFWT_SCAN_COMPLETE,
+    /** A coordinate was found within the window */
+    SFWT_SCAN_WITHIN,
+    /** Empty geometry, the reader is at the EMPTY token */
+    SFWT_SCAN_EMPTY,
+    /** Not a geometry, incomplete or invalid text */
+    SFWT_SCAN_INVALID
+};
+
+/**
+ * Parse an ordinate token as a double, named NaN and infinity values
+ * included
+ *
+ * @param token
+ *            ordinate token
+ *
+ * @return value
+ */
+static double sfwt_token_double(NSString *token){
+    double value = [token doubleValue];
+    if(value == 0){
+        NSString *name = [[token stringByTrimmingCharactersInSet:[NSCharacterSet characterSetWithCharactersInString:@"+-"]] lowercaseString];
+        if([name isEqualToString:@"nan"]){
+            value = NAN;
+        }else if([name isEqualToString:@"inf"] || [name isEqualToString:@"infinity"]){
+            value = [token hasPrefix:@"-"] ? -INFINITY : INFINITY;
+        }
+    }
+    return value;
+}
+
+/**
+ * Read or skip the next type or dimension tag in indexed text, determining
+ * if it is a Circular String type
+ *
+ * @param reader
+ *            indexed text reader
+ *
+ * @return true if a Circular String type
+ */
+static BOOL sfwt_scan_circular_string(SFWTIndexedTextReader *reader){
+    BOOL circularString = NO;
+    if(toupper([reader peekCharacter]) == 'C'){
+        circularString = [[reader readToken] caseInsensitiveCompare:[SFGeometryTypes name:SF_CIRCULARSTRING]] == NSOrderedSame;
+    }else{
+        [reader skipToken];
+    }
+    return circularString;
+}
+
+/**
+ * Scan the x and y bounds of the next geometry in indexed text, reading
+ * tokens through the structural index without building objects. Circular
+ * string bounds are expanded to include the bulge of each arc past its
+ * control points.
+ *
+ * @param reader
+ *            indexed text reader
+ * @param bounds
+ *            min x, min y, max x, max y output
+ * @param window
+ *            stop at a coordinate within these bounds, NULL to scan all
+ *
+ * @return scan result
+ */
+static SFWTBoundsScan sfwt_scan_bounds(SFWTIndexedTextReader *reader, double *bounds, const double *window){
+    
+    bounds[0] = INFINITY;
+    bounds[1] = INFINITY;
+    bounds[2] = -INFINITY;
+    bounds[3] = -INFINITY;
+    
+    SFWTBoundsScan result = SFWT_SCAN_INVALID;
+    
+    @try{
+        
+        if(!isalpha([reader peekCharacter])){
+            return SFWT_SCAN_INVALID;
+        }
+        
+        int depth = 0;
+        int ordinate = 0;
+        double x = 0;
+        BOOL scanning = YES;
+        
+        // Circular string arcs, the depth of the arc points or -1 when not
+        // within a circular string
+        BOOL arcNext = sfwt_scan_circular_string(reader);
+        int arcDepth = -1;
+        int arcCount = 0;
+        double arc[3][2];
+        
+        while(scanning){
+            
+            uint8_t character = [reader peekCharacter];
+            
+            switch(character){
+                case 0:
+                    scanning = NO;
+                    break;
+                case '(':
+                    depth++;
+                    ordinate = 0;
+                    if(arcNext){
+                        arcNext = NO;
+                        arcDepth = depth;
+                        arcCount = 0;
+                    }
+                    [reader skipToken];
+                    break;
+                case ')':
+                    if(depth == arcDepth){
+                        arcDepth = -1;
+                    }
+                    depth--;
+                    ordinate = 0;
+                    arcNext = NO;
+                    [reader skipToken];
+                    if(depth <= 0){
+                        result = SFWT_SCAN_COMPLETE;
+                        scanning = NO;
+                    }
+                    break;
+                case ',':
+                    ordinate = 0;
+                    arcNext = NO;
+                    [reader skipToken];
+                    break;
+                default:
+                    if(ordinate == 0 && isalpha(character)){
+                        if(depth == 0 && toupper(character) == 'E'){
+                            result = SFWT_SCAN_EMPTY;
+                            scanning = NO;
+                        }else{
+                            // Type or dimension tag
+                            arcNext = sfwt_scan_circular_string(reader) || arcNext;
+                        }
+                    }else{
+                        double value = [reader readDouble];
+                        if(ordinate == 0){
+                            x = value;
+                        }else if(ordinate == 1){
+                            if(window != NULL && x >= window[0] && x <= window[2] && value >= window[1] && value <= window[3]){
+                                result = SFWT_SCAN_WITHIN;
+                                scanning = NO;
+                            }
+                            bounds[0] = MIN(bounds[0], x);
+                            bounds[1] = MIN(bounds[1], value);
+                            bounds[2] = MAX(bounds[2], x);
+                            bounds[3] = MAX(bounds[3], value);
+                            if(depth == arcDepth){
+                                arc[arcCount][0] = x;
+                                arc[arcCount][1] = value;
+                                if(++arcCount == 3){
+                                    [SFWTArcLinearizer expandBounds:bounds withArcStart:arc[0] andMiddle:arc[1] andEnd:arc[2]];
+                                    arc[0][0] = x;
+                                    arc[0][1] = value;
+                                    arcCount = 1;
+                                }
+                            }
+                        }
+                        ordinate++;
+                    }
+                    break;
+            }
+        }
+        
+    }@catch(NSException *exception){
+        result = SFWT_SCAN_INVALID;
+    }
+    
+    return result;
+}
+
+/**
+ * Expand geometry envelope bounds to include the bulge of Circular String
+ * arcs past their control points
+ *
+ * @param geometry
+ *            geometry
+ * @param bounds
+ *            min x, min y, max x, max y to expand
+ */
+static void sfwt_expand_arc_bounds(SFGeometry *geometry, double *bounds){
+    
+    if([geometry isKindOfClass:[SFCircularString class]]){
+        SFCircularString *circularString = (SFCircularString *) geometry;
+        double arc[3][2];
+        for(int index = 0; index + 2 < [circularString numPoints]; index += 2){
+            for(int i = 0; i < 3; i++){
+                SFPoint *point = [circularString pointAtIndex:index + i];
+                arc[i][0] = [point.x doubleValue];
+                arc[i][1] = [point.y doubleValue];
+            }
+            [SFWTArcLinearizer expandBounds:bounds withArcStart:arc[0] andMiddle:arc[1] andEnd:arc[2]];
+        }
+    }else if([geometry isKindOfClass:[SFCompoundCurve class]]){
+        for(SFLineString *lineString in ((SFCompoundCurve *) geometry).lineStrings){
+            sfwt_expand_arc_bounds(lineString, bounds);
+        }
+    }else if([geometry isKindOfClass:[SFCurvePolygon class]]){
+        for(SFCurve *ring in ((SFCurvePolygon *) geometry).rings){
+            sfwt_expand_arc_bounds(ring, bounds);
+        }
+    }else if([geometry isKindOfClass:[SFGeometryCollection class]]){
+        for(SFGeometry *member in ((SFGeometryCollection *) geometry).geometries){
+            sfwt_expand_arc_bounds(member, bounds);
+        }
+    }
+    
+}
+
+/**
+ * Get the x and y bounds of a read geometry, including Circular String
+ * arcs
+ *
+ * @param geometry
+ *            geometry
+ * @param bounds
+ *            min x, min y, max x, max y output
+ *
+ * @return true if bounds were read, false for a geometry without coordinates
+ */
+static BOOL sfwt_geometry_bounds(SFGeometry *geometry, double *bounds){
+    
+    SFGeometryEnvelope *envelope = geometry != nil ? [geometry envelope] : nil;
+    if(envelope != nil){
+        bounds[0] = [envelope.minX doubleValue];
+        bounds[1] = [envelope.minY doubleValue];
+        bounds[2] = [envelope.maxX doubleValue];
+        bounds[3] = [envelope.maxY doubleValue];
+        sfwt_expand_arc_bounds(geometry, bounds);
+    }
+    
+    return envelope != nil;
+}
+
+@implementation SFWTGeometryReader{
+    double *_pending;
+    uint8_t *_pendingDimensions;
+    int _pendingCount;
+    int _pendingLength;
+    BOOL _transforming;
+    BOOL _holdPoints;
+    unichar _separator;
+    BOOL _textChecked;
+}
 
 +(SFGeometry *) readGeometryWithText: (NSString *) text{
     return [self readGeometryWithText:text andFilter:nil andExpectedType:nil];
@@ -36,18 +320,44 @@
     return [reader readWithFilter:filter andExpectedType:expectedType];
 }
 
++(SFGeometry *) readGeometryWithText: (NSString *) text andLimits: (SFWTReaderLimits *) limits{
+    SFWTGeometryReader *reader = [[SFWTGeometryReader alloc] initWithText:text];
+    [reader setLimits:limits];
+    return [reader read];
+}
+
++(SFGeometry *) readGeometryWithText: (NSString *) text andEnvelope: (SFGeometryEnvelope *) envelope{
+    SFWTGeometryReader *reader = [[SFWTGeometryReader alloc] initWithText:text];
+    return [reader readWithEnvelope:envelope];
+}
+
++(SFWTFlatGeometry *) readFlatGeometryWithText: (NSString *) text andArena: (SFWTGeometryArena *) arena{
+    SFWTGeometryReader *reader = [[SFWTGeometryReader alloc] initWithText:text];
+    return [reader readFlatWithArena:arena];
+}
+
++(SFWTMemberEnumerator *) memberEnumeratorWithText: (NSString *) text{
+    return [[SFWTMemberEnumerator alloc] initWithText:text];
+}
+
 -(instancetype) initWithText: (NSString *) text{
-    return [self initWithReader:[[SFTextReader alloc] initWithText:text]];
+    return [self initWithReader:[SFWTIndexedTextReader readerWithText:text]];
 }
 
 -(instancetype) initWithReader: (SFTextReader *) reader{
     self = [super init];
     if(self != nil){
         _reader = reader;
+        _issues = [NSMutableArray array];
     }
     return self;
 }
 
+-(void) dealloc{
+    free(_pending);
+    free(_pendingDimensions);
+}
+
 -(SFTextReader *) textReader{
     return _reader;
 }
@@ -65,7 +375,159 @@
 }
 
 -(SFGeometry *) readWithFilter: (NSObject<SFGeometryFilter> *) filter andExpectedType: (Class) expectedType{
-    return [self readWithFilter:filter inType:SF_NONE andExpectedType:expectedType];
+    
+    _depth = 0;
+    _coordinates = 0;
+    _allocation = 0;
+    _separator = 0;
+    [_issues removeAllObjects];
+    _pointDimensions = -1;
+    
+    // Indexed text limits the bytes of each geometry record, other readers check the whole text once
+    SFWTIndexedTextReader *indexedReader = nil;
+    NSUInteger offset = 0;
+    if(_limits != nil){
+        if([_reader isKindOfClass:[SFWTIndexedTextReader class]]){
+            indexedReader = (SFWTIndexedTextReader *) _reader;
+            offset = [indexedReader offset];
+        }else if(!_textChecked){
+            [_limits checkText:[_reader text]];
+            _textChecked = YES;
+        }
+    }
+    
+    SFGeometry *geometry = nil;
+    
+    if(_transform == nil){
+        geometry = [self readWithFilter:filter inType:SF_NONE andExpectedType:expectedType];
+    }else{
+        
+        if(_pending == NULL){
+            _pending = malloc(TRANSFORM_BLOCK_SIZE * 4 * sizeof(double));
+            _pendingDimensions = malloc(TRANSFORM_BLOCK_SIZE * sizeof(uint8_t));
+        }
+        _pendingCount = 0;
+        _pendingLength = 0;
+        
+        _transforming = YES;
+        @try {
+            geometry = [self readWithFilter:filter inType:SF_NONE andExpectedType:expectedType];
+        } @finally {
+            _transforming = NO;
+        }
+        
+    }
+    
+    if(indexedReader != nil){
+        [_limits checkBytes:[indexedReader offset] - offset];
+    }
+    
+    return geometry;
+}
+
+-(NSArray<SFWTValidationIssue *> *) validationIssues{
+    return _issues;
+}
+
+-(SFGeometry *) readWithEnvelope: (SFGeometryEnvelope *) envelope{
+    return [self readWithFilter:nil andEnvelope:envelope andExpectedType:nil];
+}
+
+-(SFGeometry *) readWithFilter: (NSObject<SFGeometryFilter> *) filter andEnvelope: (SFGeometryEnvelope *) envelope andExpectedType: (Class) expectedType{
+    
+    SFGeometry *geometry = nil;
+    
+    if(envelope == nil || _transform != nil || ![self skipDisjointWithEnvelope:envelope]){
+        geometry = [self readWithFilter:filter andExpectedType:expectedType];
+        if(geometry != nil && envelope != nil && (_transform != nil || ![_reader isKindOfClass:[SFWTIndexedTextReader class]])){
+            double bounds[4];
+            if(sfwt_geometry_bounds(geometry, bounds)
+               && ![SFWTGeometryReader envelopeWithMinX:bounds[0] andMinY:bounds[1] andMaxX:bounds[2] andMaxY:bounds[3] intersects:envelope]){
+                geometry = nil;
+            }
+        }
+    }
+    
+    return geometry;
+}
+
+-(NSMutableArray<SFGeometry *> *) readAllWithEnvelope: (SFGeometryEnvelope *) envelope{
+    NSMutableArray<SFGeometry *> *geometries = [NSMutableArray array];
+    while([_reader peekToken] != nil){
+        SFGeometry *geometry = [self readWithEnvelope:envelope];
+        if(geometry != nil){
+            [geometries addObject:geometry];
+        }
+    }
+    return geometries;
+}
+
+-(BOOL) skipDisjointWithEnvelope: (SFGeometryEnvelope *) envelope{
+    
+    if(![_reader isKindOfClass:[SFWTIndexedTextReader class]]){
+        return NO;
+    }
+    SFWTIndexedTextReader *reader = (SFWTIndexedTextReader *) _reader;
+    
+    double window[4];
+    window[0] = [envelope.minX doubleValue];
+    window[1] = [envelope.minY doubleValue];
+    window[2] = [envelope.maxX doubleValue];
+    window[3] = [envelope.maxY doubleValue];
+    
+    NSUInteger start = [reader position];
+    double bounds[4];
+    BOOL skip = sfwt_scan_bounds(reader, bounds, window) == SFWT_SCAN_COMPLETE
+        && (bounds[0] > window[2] || bounds[2] < window[0] || bounds[1] > window[3] || bounds[3] < window[1]);
+    
+    if(!skip){
+        [reader seek:start];
+    }
+    
+    return skip;
+}
+
+-(BOOL) readBounds: (double *) bounds{
+    
+    if(_transform == nil && [_reader isKindOfClass:[SFWTIndexedTextReader class]]){
+        SFWTIndexedTextReader *reader = (SFWTIndexedTextReader *) _reader;
+        NSUInteger start = [reader position];
+        switch(sfwt_scan_bounds(reader, bounds, NULL)){
+            case SFWT_SCAN_COMPLETE:
+                // No coordinates when all members are empty
+                return bounds[0] <= bounds[2];
+            case SFWT_SCAN_EMPTY:
+                [reader skipToken];
+                return NO;
+            default:
+                // Read to report invalid text
+                [reader seek:start];
+                break;
+        }
+    }
+    
+    return sfwt_geometry_bounds([self read], bounds);
+}
+
+/**
+ * Determine if bounds intersect an envelope
+ *
+ * @param minX
+ *            min x
+ * @param minY
+ *            min y
+ * @param maxX
+ *            max x
+ * @param maxY
+ *            max y
+ * @param envelope
+ *            envelope
+ *
+ * @return true if intersecting
+ */
++(BOOL) envelopeWithMinX: (double) minX andMinY: (double) minY andMaxX: (double) maxX andMaxY: (double) maxY intersects: (SFGeometryEnvelope *) envelope{
+    return minX <= [envelope.maxX doubleValue] && maxX >= [envelope.minX doubleValue]
+        && minY <= [envelope.maxY doubleValue] && maxY >= [envelope.minY doubleValue];
 }
 
 -(SFGeometry *) readWithFilter: (NSObject<SFGeometryFilter> *) filter inType: (SFGeometryType) containingType andExpectedType: (Class) expectedType{
@@ -81,6 +543,11 @@
         BOOL hasZ = [geometryTypeInfo hasZ];
         BOOL hasM = [geometryTypeInfo hasM];
         
+        _depth++;
+        if(_limits != nil){
+            [_limits checkDepth:_depth];
+        }
+        
         switch(geometryType){
         
             case SF_GEOMETRY:
@@ -113,13 +580,25 @@
                 geometry = [self readMultiSurfaceWithFilter:filter andHasZ:hasZ andHasM:hasM];
                 break;
             case SF_CIRCULARSTRING:
-                geometry = [self readCircularStringWithFilter:filter andHasZ:hasZ andHasM:hasM];
+                if(_linearizer != nil){
+                    geometry = [self readLinearizedCircularStringWithFilter:filter andHasZ:hasZ andHasM:hasM];
+                }else{
+                    geometry = [self readCircularStringWithFilter:filter andHasZ:hasZ andHasM:hasM];
+                }
                 break;
             case SF_COMPOUNDCURVE:
-                geometry = [self readCompoundCurveWithFilter:filter andHasZ:hasZ andHasM:hasM];
+                if(_linearizer != nil){
+                    geometry = [self readLinearizedCompoundCurveWithFilter:filter andHasZ:hasZ andHasM:hasM];
+                }else{
+                    geometry = [self readCompoundCurveWithFilter:filter andHasZ:hasZ andHasM:hasM];
+                }
                 break;
             case SF_CURVEPOLYGON:
-                geometry = [self readCurvePolygonWithFilter:filter andHasZ:hasZ andHasM:hasM];
+                if(_linearizer != nil){
+                    geometry = [self readLinearizedCurvePolygonWithFilter:filter andHasZ:hasZ andHasM:hasM];
+                }else{
+                    geometry = [self readCurvePolygonWithFilter:filter andHasZ:hasZ andHasM:hasM];
+                }
                 break;
             case SF_CURVE:
                 [NSException raise:@"Unexpected Geometry" format:@"Unexpected Geometry Type of %@ which is abstract", [SFGeometryTypes name:geometryType]];
@@ -139,6 +618,8 @@
                 [NSException raise:@"Unsupported Geometry" format:@"Geometry Type not supported: %@", [SFGeometryTypes name:geometryType]];
         }
         
+        _depth--;
+        
         if(![SFWTGeometryReader filter:filter geometry:geometry inType:containingType]){
             geometry = nil;
         }
@@ -153,6 +634,84 @@
     return geometry;
 }
 
+-(SFWTFlatGeometry *) readFlat{
+    if(_arena == nil){
+        _arena = [[SFWTGeometryArena alloc] init];
+    }
+    return [self readFlatWithArena:_arena];
+}
+
+-(SFWTFlatGeometry *) readFlatWithArena: (SFWTGeometryArena *) arena{
+    SFWTEventReader *eventReader = [[SFWTEventReader alloc] initWithReader:_reader];
+    [eventReader setLimits:_limits];
+    return [SFWTFlatGeometry flatGeometryWithEventReader:eventReader andArena:arena andTransform:_transform];
+}
+
+-(SFWTMemberEnumerator *) memberEnumerator{
+    return [[SFWTMemberEnumerator alloc] initWithReader:_reader];
+}
+
+-(SFGeometry *) readMemberInType: (SFGeometryType) containingType andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    
+    SFGeometry *member = nil;
+    
+    switch(containingType){
+            
+        case SF_POINT:
+        case SF_LINESTRING:
+        case SF_CIRCULARSTRING:
+            member = [self readPointWithHasZ:hasZ andHasM:hasM];
+            break;
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+        case SF_MULTILINESTRING:
+            member = [self readLineStringWithHasZ:hasZ andHasM:hasM];
+            break;
+        case SF_MULTIPOLYGON:
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            member = [self readPolygonWithHasZ:hasZ andHasM:hasM];
+            break;
+        case SF_MULTIPOINT:
+            if([self isLeftParenthesisOrEmpty]){
+                member = [self readPointTextWithHasZ:hasZ andHasM:hasM];
+            }else{
+                member = [self readPointWithHasZ:hasZ andHasM:hasM];
+            }
+            break;
+        case SF_MULTICURVE:
+        case SF_CURVEPOLYGON:
+            if([self isLeftParenthesisOrEmpty]){
+                member = [self readLineStringWithHasZ:hasZ andHasM:hasM];
+            }else{
+                member = [self readWithFilter:nil inType:containingType andExpectedType:[SFCurve class]];
+            }
+            break;
+        case SF_COMPOUNDCURVE:
+            if([self isLeftParenthesisOrEmpty]){
+                member = [self readLineStringWithHasZ:hasZ andHasM:hasM];
+            }else{
+                member = [self readWithFilter:nil inType:containingType andExpectedType:[SFLineString class]];
+            }
+            break;
+        case SF_MULTISURFACE:
+            if([self isLeftParenthesisOrEmpty]){
+                member = [self readPolygonWithHasZ:hasZ andHasM:hasM];
+            }else{
+                member = [self readWithFilter:nil inType:containingType andExpectedType:[SFSurface class]];
+            }
+            break;
+        case SF_GEOMETRYCOLLECTION:
+            member = [self readWithFilter:nil inType:containingType andExpectedType:[SFGeometry class]];
+            break;
+        default:
+            [NSException raise:@"Unsupported Geometry" format:@"Geometry Type does not contain members: %@", [SFGeometryTypes name:containingType]];
+            
+    }
+    
+    return member;
+}
+
 -(SFWTGeometryTypeInfo *) readGeometryType{
     
     SFWTGeometryTypeInfo *geometryInfo = nil;
@@ -250,32 +809,430 @@
 
 -(SFPoint *) readPointWithHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
     
-    double x = [_reader readDouble];
-    double y = [_reader readDouble];
+    double values[4];
+    int dimensions = [self readValues:values withHasZ:hasZ andHasM:hasM];
     
-    SFPoint *point = [SFPoint pointWithHasZ:hasZ andHasM:hasM andXValue:x andYValue:y];
+    if(_transforming && !_holdPoints){
+        [self pendValues:values withDimensions:dimensions];
+        NSMutableArray<SFPoint *> *points = [NSMutableArray arrayWithCapacity:1];
+        [self transformPendingToPoints:points];
+        return [points firstObject];
+    }
     
-    if(hasZ || hasM){
+    return [SFWTGeometryReader pointWithValues:values andDimensions:dimensions];
+}
+
+/**
+ * Read the values of a point, applying the dimension projection and
+ * validation
+ *
+ * @param values
+ *            x, y, z and m values, z and m set when read or padded
+ * @param hasZ
+ *            has z values in the text
+ * @param hasM
+ *            has m values in the text
+ *
+ * @return point dimensions, 1 bit for z values and 2 bit for m values
+ */
+-(int) readValues: (double *) values withHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    
+    _coordinates++;
+    if(_limits != nil){
+        [_limits checkCoordinates:_coordinates];
+        _allocation += [SFWTReaderLimits pointAllocationWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
+        [_limits checkAllocation:_allocation];
+    }
+    
+    values[0] = [_reader readDouble];
+    values[1] = [_reader readDouble];
+    
+    int dimensions = 0;
+    
+    if(_dimensionOptions != SFWT_DIMENSIONS_NONE){
+        dimensions = [self readProjectedValues:values withHasZ:hasZ andHasM:hasM];
+    }else if(hasZ || hasM){
         if(hasZ){
-            [point setZValue:[_reader readDouble]];
+            values[2] = [_reader readDouble];
+            dimensions |= 1;
         }
         
         if(hasM){
-            [point setMValue:[_reader readDouble]];
+            values[3] = [_reader readDouble];
+            dimensions |= 2;
         }
     } else if(![self isCommaOrRightParenthesis]){
         
-        [point setZValue:[_reader readDouble]];
+        values[2] = [_reader readDouble];
+        dimensions |= 1;
         
         if(![self isCommaOrRightParenthesis]){
             
-            [point setMValue:[_reader readDouble]];
+            values[3] = [_reader readDouble];
+            dimensions |= 2;
             
         }
-        
+        
+    }
+    
+    if(_validationRules != SFWT_VALIDATE_NONE){
+        [self validateValues:values withDimensions:dimensions];
+    }
+    
+    return dimensions;
+}
+
+/**
+ * Create a point from read values
+ *
+ * @param values
+ *            x, y, z and m values
+ * @param dimensions
+ *            point dimensions, 1 bit for z values and 2 bit for m values
+ *
+ * @return point
+ */
++(SFPoint *) pointWithValues: (const double *) values andDimensions: (int) dimensions{
+    
+    SFPoint *point = [SFPoint pointWithHasZ:(dimensions & 1) != 0 andHasM:(dimensions & 2) != 0 andXValue:values[0] andYValue:values[1]];
+    if(dimensions & 1){
+        [point setZValue:values[2]];
+    }
+    if(dimensions & 2){
+        [point setMValue:values[3]];
+    }
+    
+    return point;
+}
+
+/**
+ * Get the initial arity of an untagged coordinate sequence, 0 to lock the
+ * arity from the first point or -1 when the sequence is not locked. Tagged
+ * sequences, dimension projection, transforms and validation read each
+ * point with the standard look ahead.
+ *
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ *
+ * @return arity
+ */
+-(int) arityWithHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    BOOL lock = !hasZ && !hasM && _dimensionOptions == SFWT_DIMENSIONS_NONE
+        && _transform == nil && _validationRules == SFWT_VALIDATE_NONE;
+    return lock ? 0 : -1;
+}
+
+/**
+ * Read a point of a coordinate sequence. Once the arity is locked from the
+ * first untagged point, following points read their ordinates without look
+ * ahead. Each token after x and y is read once: an ordinate is kept, while
+ * the ',' or ')' ending the point is held for the following
+ * commaOrRightParenthesis. A point with fewer or more ordinates than the
+ * locked arity is detected from that token and updates the arity, so
+ * filters and the containing geometry see the complete point.
+ *
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ * @param arity
+ *            sequence arity, updated as the arity is locked or changes
+ *
+ * @return point
+ */
+-(SFPoint *) readPointWithHasZ: (BOOL) hasZ andHasM: (BOOL) hasM andArity: (int *) arity{
+    
+    if(*arity <= 0){
+        SFPoint *point = [self readPointWithHasZ:hasZ andHasM:hasM];
+        if(*arity == 0){
+            *arity = 2 + (point.z != nil ? 1 : 0) + (point.m != nil ? 1 : 0);
+        }
+        return point;
+    }
+    
+    _coordinates++;
+    if(_limits != nil){
+        [_limits checkCoordinates:_coordinates];
+        _allocation += [SFWTReaderLimits pointAllocationWithHasZ:*arity > 2 andHasM:*arity > 3];
+        [_limits checkAllocation:_allocation];
+    }
+    
+    double x = [_reader readDouble];
+    double y = [_reader readDouble];
+    
+    SFPoint *point = [SFPoint pointWithHasZ:NO andHasM:NO andXValue:x andYValue:y];
+    
+    int ordinates = 2;
+    double value;
+    while(ordinates < 4 && [self readOrdinate:&value]){
+        if(ordinates == 2){
+            [point setZValue:value];
+        }else{
+            [point setMValue:value];
+        }
+        ordinates++;
+    }
+    *arity = ordinates;
+    
+    return point;
+}
+
+/**
+ * Read the next token of a sequence point as an ordinate. A ',' or ')'
+ * ending the point is consumed and held for the following
+ * commaOrRightParenthesis instead.
+ *
+ * @param value
+ *            ordinate value result
+ *
+ * @return true if an ordinate was read
+ */
+-(BOOL) readOrdinate: (double *) value{
+    
+    if([_reader isKindOfClass:[SFWTIndexedTextReader class]]){
+        SFWTIndexedTextReader *indexedReader = (SFWTIndexedTextReader *) _reader;
+        uint8_t character = [indexedReader peekCharacter];
+        if(character == ',' || character == ')'){
+            [indexedReader skipToken];
+            _separator = character;
+            return NO;
+        }
+        *value = [indexedReader readDouble];
+        return YES;
+    }
+    
+    NSString *token = [_reader readToken];
+    if([token isEqualToString:@","] || [token isEqualToString:@")"]){
+        _separator = [token characterAtIndex:0];
+        return NO;
+    }
+    unichar first = token.length > 0 ? [token characterAtIndex:0] : 0;
+    if(!isdigit(first) && first != '-' && first != '+' && first != '.' && tolower(first) != 'n' && tolower(first) != 'i'){
+        [NSException raise:@"Invalid Token" format:@"Invalid token, expected ',' or ')'. found: '%@'", token];
+    }
+    *value = sfwt_token_double(token);
+    return YES;
+}
+
+/**
+ * Validate the values of a read point
+ *
+ * @param values
+ *            x, y, z and m values
+ * @param dimensions
+ *            point dimensions, 1 bit for z values and 2 bit for m values
+ */
+-(void) validateValues: (const double *) values withDimensions: (int) dimensions{
+    
+    if(_validationRules & SFWT_VALIDATE_FINITE){
+        if(!isfinite(values[0]) || !isfinite(values[1])
+           || ((dimensions & 1) && !isfinite(values[2])) || ((dimensions & 2) && !isfinite(values[3]))){
+            [self addIssueWithRule:SFWT_VALIDATE_FINITE andGeometryType:SF_POINT andMessage:@"Point has a non finite value"];
+        }
+    }
+    
+    if((_validationRules & SFWT_VALIDATE_DIMENSIONS) && _pointDimensions != -2){
+        if(_pointDimensions == -1){
+            _pointDimensions = dimensions;
+        }else if(dimensions != _pointDimensions){
+            // Report once per geometry
+            _pointDimensions = -2;
+            [self addIssueWithRule:SFWT_VALIDATE_DIMENSIONS andGeometryType:SF_POINT andMessage:@"Point dimensions are inconsistent with previous points"];
+        }
+    }
+    
+}
+
+/**
+ * Read the points of a coordinate sequence through the closing right
+ * parenthesis, applying the coordinate transform to the parsed values in
+ * blocks before the points are created
+ *
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ *
+ * @return transformed points
+ */
+-(NSMutableArray<SFPoint *> *) readTransformedPointsWithHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    
+    NSMutableArray<SFPoint *> *points = [NSMutableArray array];
+    
+    double values[4];
+    do {
+        if(_pendingCount == TRANSFORM_BLOCK_SIZE){
+            [self transformPendingToPoints:points];
+        }
+        int dimensions = [self readValues:values withHasZ:hasZ andHasM:hasM];
+        [self pendValues:values withDimensions:dimensions];
+    } while ([self commaOrRightParenthesis]);
+    [self transformPendingToPoints:points];
+    
+    return points;
+}
+
+/**
+ * Pack point values into the block awaiting the coordinate transform. The
+ * block must have room for the point.
+ *
+ * @param values
+ *            x, y, z and m values
+ * @param dimensions
+ *            point dimensions, 1 bit for z values and 2 bit for m values
+ */
+-(void) pendValues: (const double *) values withDimensions: (int) dimensions{
+    
+    double *coordinate = _pending + _pendingLength;
+    *coordinate++ = values[0];
+    *coordinate++ = values[1];
+    if(dimensions & 1){
+        *coordinate++ = values[2];
+    }
+    if(dimensions & 2){
+        *coordinate++ = values[3];
+    }
+    _pendingLength = (int) (coordinate - _pending);
+    _pendingDimensions[_pendingCount++] = dimensions;
+}
+
+/**
+ * Apply the coordinate transform to the pending block in runs of points
+ * sharing a dimension, creating the transformed points
+ *
+ * @param points
+ *            points to add the transformed points to
+ */
+-(void) transformPendingToPoints: (NSMutableArray<SFPoint *> *) points{
+    
+    double *coordinate = _pending;
+    int index = 0;
+    while(index < _pendingCount){
+        
+        int dimensions = _pendingDimensions[index];
+        int end = index + 1;
+        while(end < _pendingCount && _pendingDimensions[end] == dimensions){
+            end++;
+        }
+        int dimension = 2 + (dimensions & 1) + ((dimensions & 2) >> 1);
+        _transform(coordinate, end - index, dimension);
+        
+        double values[4];
+        for(; index < end; index++){
+            values[0] = *coordinate++;
+            values[1] = *coordinate++;
+            if(dimensions & 1){
+                values[2] = *coordinate++;
+            }
+            if(dimensions & 2){
+                values[3] = *coordinate++;
+            }
+            [points addObject:[SFWTGeometryReader pointWithValues:values andDimensions:dimensions]];
+        }
+        
+    }
+    
+    _pendingCount = 0;
+    _pendingLength = 0;
+}
+
+/**
+ * Read the remaining point values, applying the dimension projection
+ *
+ * @param values
+ *            x, y, z and m values, z and m set when kept or padded
+ * @param hasZ
+ *            has z values in the text
+ * @param hasM
+ *            has m values in the text
+ *
+ * @return projected point dimensions, 1 bit for z values and 2 bit for m
+ *         values
+ */
+-(int) readProjectedValues: (double *) values withHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    
+    BOOL dropZ = (_dimensionOptions & SFWT_DIMENSIONS_DROP_Z) != 0;
+    BOOL dropM = (_dimensionOptions & SFWT_DIMENSIONS_DROP_M) != 0;
+    
+    BOOL textZ = hasZ;
+    BOOL textM = hasM;
+    double z = _padValue;
+    double m = _padValue;
+    
+    if(hasZ || hasM){
+        if(hasZ){
+            z = [self readValueOrSkip:dropZ withDefault:z];
+        }
+        if(hasM){
+            m = [self readValueOrSkip:dropM withDefault:m];
+        }
+    } else if(![self isCommaOrRightParenthesis]){
+        textZ = YES;
+        z = [self readValueOrSkip:dropZ withDefault:z];
+        if(![self isCommaOrRightParenthesis]){
+            textM = YES;
+            m = [self readValueOrSkip:dropM withDefault:m];
+        }
+    }
+    
+    BOOL keepZ = textZ && !dropZ;
+    BOOL keepM = textM && !dropM;
+    BOOL pointHasZ = keepZ || (_dimensionOptions & SFWT_DIMENSIONS_PAD_Z) != 0;
+    BOOL pointHasM = keepM || (_dimensionOptions & SFWT_DIMENSIONS_PAD_M) != 0;
+    
+    values[2] = keepZ ? z : _padValue;
+    values[3] = keepM ? m : _padValue;
+    
+    return (pointHasZ ? 1 : 0) | (pointHasM ? 2 : 0);
+}
+
+/**
+ * Read the next value, or skip its token without parsing
+ *
+ * @param skip
+ *            true to skip
+ * @param value
+ *            value returned when skipped
+ *
+ * @return value
+ */
+-(double) readValueOrSkip: (BOOL) skip withDefault: (double) value{
+    if(skip){
+        if([_reader isKindOfClass:[SFWTIndexedTextReader class]]){
+            [(SFWTIndexedTextReader *) _reader skipToken];
+        }else{
+            [_reader readToken];
+        }
+    }else{
+        value = [_reader readDouble];
     }
-    
-    return point;
+    return value;
+}
+
+/**
+ * Project the z dimension of a read geometry
+ *
+ * @param hasZ
+ *            has z values in the text
+ *
+ * @return has z values in the geometry
+ */
+-(BOOL) projectZ: (BOOL) hasZ{
+    return (hasZ && (_dimensionOptions & SFWT_DIMENSIONS_DROP_Z) == 0) || (_dimensionOptions & SFWT_DIMENSIONS_PAD_Z) != 0;
+}
+
+/**
+ * Project the m dimension of a read geometry
+ *
+ * @param hasM
+ *            has m values in the text
+ *
+ * @return has m values in the geometry
+ */
+-(BOOL) projectM: (BOOL) hasM{
+    return (hasM && (_dimensionOptions & SFWT_DIMENSIONS_DROP_M) == 0) || (_dimensionOptions & SFWT_DIMENSIONS_PAD_M) != 0;
 }
 
 -(SFLineString *) readLineStringWithHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
@@ -283,19 +1240,54 @@
 }
 
 -(SFLineString *) readLineStringWithFilter: (NSObject<SFGeometryFilter> *) filter andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    return [self readLineStringWithFilter:filter andHasZ:hasZ andHasM:hasM inType:SF_NONE];
+}
+
+/**
+ * Read a Line String, validated as a ring of polygon types
+ *
+ * @param filter
+ *            geometry filter
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ * @param containingType
+ *            containing geometry type
+ *
+ * @return line string
+ */
+-(SFLineString *) readLineStringWithFilter: (NSObject<SFGeometryFilter> *) filter andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM inType: (SFGeometryType) containingType{
     
     SFLineString *lineString = nil;
     
     if([self leftParenthesisOrEmpty]){
         
-        lineString = [SFLineString lineStringWithHasZ:hasZ andHasM:hasM];
+        lineString = [SFLineString lineStringWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
         
-        do {
-            SFPoint *point = [self readPointWithHasZ:hasZ andHasM:hasM];
-            if([SFWTGeometryReader filter:filter geometry:point inType:SF_LINESTRING]){
-                [lineString addPoint:point];
+        if(_transforming){
+            for(SFPoint *point in [self readTransformedPointsWithHasZ:hasZ andHasM:hasM]){
+                if([SFWTGeometryReader filter:filter geometry:point inType:SF_LINESTRING]){
+                    [lineString addPoint:point];
+                }
             }
-        } while ([self commaOrRightParenthesis]);
+        }else{
+            SFPoint *point = nil;
+            int arity = [self arityWithHasZ:hasZ andHasM:hasM];
+            do {
+                point = [self readPointWithHasZ:hasZ andHasM:hasM andArity:&arity];
+                if([SFWTGeometryReader filter:filter geometry:point inType:SF_LINESTRING]){
+                    [lineString addPoint:point];
+                }
+            } while ([self commaOrRightParenthesis]);
+        }
+        
+        if(_validationRules != SFWT_VALIDATE_NONE){
+            [self validateNumPoints:[lineString numPoints] ofType:SF_LINESTRING inType:containingType];
+            if(containingType == SF_POLYGON || containingType == SF_TRIANGLE || containingType == SF_CURVEPOLYGON){
+                [self validateRing:lineString inType:containingType];
+            }
+        }
         
     }
     
@@ -312,10 +1304,10 @@
     
     if([self leftParenthesisOrEmpty]){
         
-        polygon = [SFPolygon polygonWithHasZ:hasZ andHasM:hasM];
+        polygon = [SFPolygon polygonWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
         
         do {
-            SFLineString *ring = [self readLineStringWithFilter:filter andHasZ:hasZ andHasM:hasM];
+            SFLineString *ring = [self readLineStringWithFilter:filter andHasZ:hasZ andHasM:hasM inType:SF_POLYGON];
             if([SFWTGeometryReader filter:filter geometry:ring inType:SF_POLYGON]){
                 [polygon addRing:ring];
             }
@@ -336,23 +1328,79 @@
     
     if([self leftParenthesisOrEmpty]){
         
-        multiPoint = [SFMultiPoint multiPointWithHasZ:hasZ andHasM:hasM];
+        multiPoint = [SFMultiPoint multiPointWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
         
-        do {
-            SFPoint *point = nil;
-            if([self isLeftParenthesisOrEmpty]){
-                point = [self readPointTextWithHasZ:hasZ andHasM:hasM];
+        if(_transforming){
+            [self readTransformedMultiPoint:multiPoint withFilter:filter andHasZ:hasZ andHasM:hasM];
+        }else{
+            do {
+                SFPoint *point = nil;
+                if([self isLeftParenthesisOrEmpty]){
+                    point = [self readPointTextWithHasZ:hasZ andHasM:hasM];
+                }else{
+                    point = [self readPointWithHasZ:hasZ andHasM:hasM];
+                }
+                if([SFWTGeometryReader filter:filter geometry:point inType:SF_MULTIPOINT]){
+                    [multiPoint addPoint:point];
+                }
+            } while ([self commaOrRightParenthesis]);
+        }
+        
+    }
+    
+    return multiPoint;
+}
+
+/**
+ * Read the points of a Multi Point, applying the coordinate transform to
+ * the parsed values in blocks before the points are created
+ *
+ * @param multiPoint
+ *            multi point
+ * @param filter
+ *            geometry filter
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ */
+-(void) readTransformedMultiPoint: (SFMultiPoint *) multiPoint withFilter: (NSObject<SFGeometryFilter> *) filter andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    
+    NSMutableArray<SFPoint *> *points = [NSMutableArray array];
+    
+    double values[4];
+    BOOL more = YES;
+    while(more){
+        
+        BOOL empty = NO;
+        if([self isLeftParenthesisOrEmpty]){
+            if([self leftParenthesisOrEmpty]){
+                [self pendValues:values withDimensions:[self readValues:values withHasZ:hasZ andHasM:hasM]];
+                [self rightParenthesis];
             }else{
-                point = [self readPointWithHasZ:hasZ andHasM:hasM];
+                empty = YES;
+            }
+        }else{
+            [self pendValues:values withDimensions:[self readValues:values withHasZ:hasZ andHasM:hasM]];
+        }
+        more = [self commaOrRightParenthesis];
+        
+        if(empty || !more || _pendingCount == TRANSFORM_BLOCK_SIZE){
+            [self transformPendingToPoints:points];
+            for(SFPoint *point in points){
+                if([SFWTGeometryReader filter:filter geometry:point inType:SF_MULTIPOINT]){
+                    [multiPoint addPoint:point];
+                }
             }
-            if([SFWTGeometryReader filter:filter geometry:point inType:SF_MULTIPOINT]){
-                [multiPoint addPoint:point];
+            [points removeAllObjects];
+            // Empty members keep their position after the pending points
+            if(empty && [SFWTGeometryReader filter:filter geometry:nil inType:SF_MULTIPOINT]){
+                [multiPoint addPoint:nil];
             }
-        } while ([self commaOrRightParenthesis]);
+        }
         
     }
     
-    return multiPoint;
 }
 
 -(SFMultiLineString *) readMultiLineStringWithHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
@@ -365,7 +1413,7 @@
     
     if([self leftParenthesisOrEmpty]){
         
-        multiLineString = [SFMultiLineString multiLineStringWithHasZ:hasZ andHasM:hasM];
+        multiLineString = [SFMultiLineString multiLineStringWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
         
         do {
             SFLineString *lineString = [self readLineStringWithFilter:filter andHasZ:hasZ andHasM:hasM];
@@ -389,7 +1437,7 @@
     
     if([self leftParenthesisOrEmpty]){
         
-        multiPolygon = [SFMultiPolygon multiPolygonWithHasZ:hasZ andHasM:hasM];
+        multiPolygon = [SFMultiPolygon multiPolygonWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
         
         do {
             SFPolygon *polygon = [self readPolygonWithFilter:filter andHasZ:hasZ andHasM:hasM];
@@ -413,7 +1461,7 @@
     
     if([self leftParenthesisOrEmpty]){
         
-        geometryCollection = [SFGeometryCollection geometryCollectionWithHasZ:hasZ andHasM:hasM];
+        geometryCollection = [SFGeometryCollection geometryCollectionWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
         
         do {
             SFGeometry *geometry = [self readWithFilter:filter inType:SF_GEOMETRYCOLLECTION andExpectedType:[SFGeometry class]];
@@ -433,7 +1481,11 @@
      
      if([self leftParenthesisOrEmpty]){
          
-         multiCurve = [SFGeometryCollection geometryCollectionWithHasZ:hasZ andHasM:hasM];
+         if(_linearizer != nil){
+             multiCurve = [SFMultiLineString multiLineStringWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
+         }else{
+             multiCurve = [SFGeometryCollection geometryCollectionWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
+         }
          
          do {
              SFCurve *curve = nil;
@@ -461,7 +1513,11 @@
     
     if([self leftParenthesisOrEmpty]){
         
-        multiSurface = [SFGeometryCollection geometryCollectionWithHasZ:hasZ andHasM:hasM];
+        if(_linearizer != nil){
+            multiSurface = [SFMultiPolygon multiPolygonWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
+        }else{
+            multiSurface = [SFGeometryCollection geometryCollectionWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
+        }
         
         do {
             SFSurface *surface = nil;
@@ -474,7 +1530,14 @@
                 surface = (SFSurface *)[self readWithFilter:filter inType:SF_MULTISURFACE andExpectedType:[SFSurface class]];
             }
             if(surface != nil){
-                [multiSurface addGeometry:surface];
+                if(_linearizer != nil && [surface isKindOfClass:[SFPolyhedralSurface class]]){
+                    // Flatten the surface polygons into the multi polygon
+                    for(SFPolygon *polygon in [(SFPolyhedralSurface *) surface polygons]){
+                        [multiSurface addGeometry:polygon];
+                    }
+                }else{
+                    [multiSurface addGeometry:surface];
+                }
             }
         } while ([self commaOrRightParenthesis]);
         
@@ -493,14 +1556,28 @@
     
     if([self leftParenthesisOrEmpty]){
         
-        circularString = [SFCircularString circularStringWithHasZ:hasZ andHasM:hasM];
+        circularString = [SFCircularString circularStringWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
         
-        do {
-            SFPoint *point = [self readPointWithHasZ:hasZ andHasM:hasM];
-            if([SFWTGeometryReader filter:filter geometry:point inType:SF_CIRCULARSTRING]){
-                [circularString addPoint:point];
+        if(_transforming){
+            for(SFPoint *point in [self readTransformedPointsWithHasZ:hasZ andHasM:hasM]){
+                if([SFWTGeometryReader filter:filter geometry:point inType:SF_CIRCULARSTRING]){
+                    [circularString addPoint:point];
+                }
             }
-        } while ([self commaOrRightParenthesis]);
+        }else{
+            SFPoint *point = nil;
+            int arity = [self arityWithHasZ:hasZ andHasM:hasM];
+            do {
+                point = [self readPointWithHasZ:hasZ andHasM:hasM andArity:&arity];
+                if([SFWTGeometryReader filter:filter geometry:point inType:SF_CIRCULARSTRING]){
+                    [circularString addPoint:point];
+                }
+            } while ([self commaOrRightParenthesis]);
+        }
+        
+        if(_validationRules != SFWT_VALIDATE_NONE){
+            [self validateNumPoints:[circularString numPoints] ofType:SF_CIRCULARSTRING inType:SF_NONE];
+        }
         
     }
     
@@ -517,7 +1594,7 @@
     
     if([self leftParenthesisOrEmpty]){
         
-        compoundCurve = [SFCompoundCurve compoundCurveWithHasZ:hasZ andHasM:hasM];
+        compoundCurve = [SFCompoundCurve compoundCurveWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
         
         do {
             SFLineString *lineString = nil;
@@ -549,17 +1626,20 @@
     
     if([self leftParenthesisOrEmpty]){
         
-        curvePolygon = [SFCurvePolygon curvePolygonWithHasZ:hasZ andHasM:hasM];
+        curvePolygon = [SFCurvePolygon curvePolygonWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
         
         do {
             SFCurve *ring = nil;
             if([self isLeftParenthesisOrEmpty]){
-                ring = [self readLineStringWithFilter:filter andHasZ:hasZ andHasM:hasM];
+                ring = [self readLineStringWithFilter:filter andHasZ:hasZ andHasM:hasM inType:SF_CURVEPOLYGON];
                 if(![SFWTGeometryReader filter:filter geometry:ring inType:SF_CURVEPOLYGON]){
                     ring = nil;
                 }
             }else{
                 ring = (SFCurve *)[self readWithFilter:filter inType:SF_CURVEPOLYGON andExpectedType:[SFCurve class]];
+                if(ring != nil && _validationRules != SFWT_VALIDATE_NONE){
+                    [self validateRing:ring inType:SF_CURVEPOLYGON];
+                }
             }
             if(ring != nil){
                 [curvePolygon addRing:ring];
@@ -571,6 +1651,276 @@
     return curvePolygon;
 }
 
+/**
+ * Read a Circular String linearized into a Line String
+ *
+ * @param filter
+ *            geometry filter
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ *
+ * @return line string
+ */
+-(SFLineString *) readLinearizedCircularStringWithFilter: (NSObject<SFGeometryFilter> *) filter andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    
+    SFLineString *lineString = nil;
+    
+    if([self leftParenthesisOrEmpty]){
+        
+        lineString = [SFLineString lineStringWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
+        [self readLinearizedArcsWithFilter:filter andHasZ:hasZ andHasM:hasM toLineString:lineString];
+        
+    }
+    
+    return lineString;
+}
+
+/**
+ * Read the Circular String control points following the left parenthesis
+ * and append the linearized points to the line string, skipping the first
+ * point when the line string already ends with the shared start point
+ *
+ * @param filter
+ *            geometry filter
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ * @param lineString
+ *            line string to append to
+ */
+-(void) readLinearizedArcsWithFilter: (NSObject<SFGeometryFilter> *) filter andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM toLineString: (SFLineString *) lineString{
+    
+    // Hold the control points from the coordinate transform, the
+    // linearized points are transformed instead
+    NSMutableArray<SFPoint *> *controlPoints = [NSMutableArray array];
+    _holdPoints = YES;
+    @try {
+        do {
+            SFPoint *point = [self readPointWithHasZ:hasZ andHasM:hasM];
+            if([SFWTGeometryReader filter:filter geometry:point inType:SF_CIRCULARSTRING]){
+                [controlPoints addObject:point];
+            }
+        } while ([self commaOrRightParenthesis]);
+    } @finally {
+        _holdPoints = NO;
+    }
+    
+    int numPoints = (int) controlPoints.count;
+    if(_validationRules != SFWT_VALIDATE_NONE){
+        [self validateNumPoints:numPoints ofType:SF_CIRCULARSTRING inType:SF_NONE];
+    }
+    
+    int dimensions = ([self projectZ:hasZ] ? 1 : 0) | ([self projectM:hasM] ? 2 : 0);
+    NSMutableArray<SFPoint *> *points = [NSMutableArray array];
+    void (^addValues)(const double *) = ^(const double *values){
+        if(self->_transforming){
+            if(self->_pendingCount == TRANSFORM_BLOCK_SIZE){
+                [self transformPendingToPoints:points];
+            }
+            [self pendValues:values withDimensions:dimensions];
+        }else{
+            [points addObject:[SFWTGeometryReader pointWithValues:values andDimensions:dimensions]];
+        }
+    };
+    
+    int index = 0;
+    double arc[3][4];
+    for(int i = 0; i < numPoints; i++){
+        SFPoint *point = controlPoints[i];
+        double *values = arc[MIN(i - index, 2)];
+        values[0] = [point.x doubleValue];
+        values[1] = [point.y doubleValue];
+        values[2] = point.z != nil ? [point.z doubleValue] : NAN;
+        values[3] = point.m != nil ? [point.m doubleValue] : NAN;
+        if(i == 0){
+            addValues(values);
+        }else if(i - index == 2){
+            [_linearizer linearizeArcWithStart:arc[0] andMiddle:arc[1] andEnd:arc[2] usingBlock:addValues];
+            memcpy(arc[0], arc[2], sizeof(arc[0]));
+            index = i;
+        }
+    }
+    
+    // Incomplete trailing arc points are kept as line segments
+    if(numPoints - index == 2){
+        addValues(arc[1]);
+    }
+    
+    if(_transforming){
+        [self transformPendingToPoints:points];
+    }
+    NSUInteger start = [lineString numPoints] > 0 ? 1 : 0;
+    for(NSUInteger i = start; i < points.count; i++){
+        [lineString addPoint:points[i]];
+    }
+    
+}
+
+/**
+ * Read a Compound Curve linearized into a single Line String
+ *
+ * @param filter
+ *            geometry filter
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ *
+ * @return line string
+ */
+-(SFLineString *) readLinearizedCompoundCurveWithFilter: (NSObject<SFGeometryFilter> *) filter andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    
+    SFLineString *compoundLineString = nil;
+    
+    if([self leftParenthesisOrEmpty]){
+        
+        compoundLineString = [SFLineString lineStringWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
+        
+        do {
+            if(filter == nil){
+                // Append segment points directly, there is no filter to see the segments
+                [self readLinearizedSegmentToLineString:compoundLineString withHasZ:hasZ andHasM:hasM];
+                continue;
+            }
+            SFLineString *lineString = nil;
+            if([self isLeftParenthesisOrEmpty]){
+                lineString = [self readLineStringWithFilter:filter andHasZ:hasZ andHasM:hasM];
+                if(![SFWTGeometryReader filter:filter geometry:lineString inType:SF_COMPOUNDCURVE]){
+                    lineString = nil;
+                }
+            }else{
+                lineString = (SFLineString *)[self readWithFilter:filter inType:SF_COMPOUNDCURVE andExpectedType:[SFLineString class]];
+            }
+            if(lineString != nil){
+                // Segments share end points, skip each repeated start point
+                int start = [compoundLineString numPoints] > 0 ? 1 : 0;
+                int numPoints = [lineString numPoints];
+                for(int i = start; i < numPoints; i++){
+                    [compoundLineString addPoint:[lineString pointAtIndex:i]];
+                }
+            }
+        } while ([self commaOrRightParenthesis]);
+        
+    }
+    
+    return compoundLineString;
+}
+
+/**
+ * Read a Compound Curve segment, an untagged or tagged Line String or a
+ * tagged Circular String, appending its linearized points to the line
+ * string. Segments share end points, so each repeated start point is
+ * skipped.
+ *
+ * @param lineString
+ *            line string to append to
+ * @param hasZ
+ *            compound curve has z values
+ * @param hasM
+ *            compound curve has m values
+ */
+-(void) readLinearizedSegmentToLineString: (SFLineString *) lineString withHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    
+    SFGeometryType geometryType = SF_LINESTRING;
+    BOOL tagged = ![self isLeftParenthesisOrEmpty];
+    if(tagged){
+        SFWTGeometryTypeInfo *geometryTypeInfo = [self readGeometryType];
+        if(geometryTypeInfo == nil){
+            return;
+        }
+        geometryType = [geometryTypeInfo geometryType];
+        hasZ = [geometryTypeInfo hasZ];
+        hasM = [geometryTypeInfo hasM];
+        if(geometryType != SF_LINESTRING && geometryType != SF_CIRCULARSTRING){
+            [NSException raise:@"Unexpected Geometry" format:@"Unexpected Geometry Type of %@ in %@", [SFGeometryTypes name:geometryType], [SFGeometryTypes name:SF_COMPOUNDCURVE]];
+        }
+        _depth++;
+        if(_limits != nil){
+            [_limits checkDepth:_depth];
+        }
+    }
+    
+    if([self leftParenthesisOrEmpty]){
+        
+        if(geometryType == SF_CIRCULARSTRING){
+            [self readLinearizedArcsWithFilter:nil andHasZ:hasZ andHasM:hasM toLineString:lineString];
+        }else{
+            int start = [lineString numPoints] > 0 ? 1 : 0;
+            int numPoints = 0;
+            if(_transforming){
+                for(SFPoint *point in [self readTransformedPointsWithHasZ:hasZ andHasM:hasM]){
+                    if(numPoints++ >= start){
+                        [lineString addPoint:point];
+                    }
+                }
+            }else{
+                int arity = [self arityWithHasZ:hasZ andHasM:hasM];
+                do {
+                    SFPoint *point = [self readPointWithHasZ:hasZ andHasM:hasM andArity:&arity];
+                    if(numPoints++ >= start){
+                        [lineString addPoint:point];
+                    }
+                } while ([self commaOrRightParenthesis]);
+            }
+            if(_validationRules != SFWT_VALIDATE_NONE){
+                [self validateNumPoints:numPoints ofType:SF_LINESTRING inType:SF_NONE];
+            }
+        }
+        
+    }
+    
+    if(tagged){
+        _depth--;
+    }
+    
+}
+
+/**
+ * Read a Curve Polygon linearized into a Polygon
+ *
+ * @param filter
+ *            geometry filter
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ *
+ * @return polygon
+ */
+-(SFPolygon *) readLinearizedCurvePolygonWithFilter: (NSObject<SFGeometryFilter> *) filter andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    
+    SFPolygon *polygon = nil;
+    
+    if([self leftParenthesisOrEmpty]){
+        
+        polygon = [SFPolygon polygonWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
+        
+        do {
+            SFLineString *ring = nil;
+            if([self isLeftParenthesisOrEmpty]){
+                ring = [self readLineStringWithFilter:filter andHasZ:hasZ andHasM:hasM inType:SF_CURVEPOLYGON];
+                if(![SFWTGeometryReader filter:filter geometry:ring inType:SF_CURVEPOLYGON]){
+                    ring = nil;
+                }
+            }else{
+                ring = (SFLineString *)[self readWithFilter:filter inType:SF_CURVEPOLYGON andExpectedType:[SFLineString class]];
+                if(ring != nil && _validationRules != SFWT_VALIDATE_NONE){
+                    [self validateRing:ring inType:SF_CURVEPOLYGON];
+                }
+            }
+            if(ring != nil){
+                [polygon addRing:ring];
+            }
+        } while ([self commaOrRightParenthesis]);
+        
+    }
+    
+    return polygon;
+}
+
 -(SFPolyhedralSurface *) readPolyhedralSurfaceWithHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
     return [self readPolyhedralSurfaceWithFilter:nil andHasZ:hasZ andHasM:hasM];
 }
@@ -581,7 +1931,7 @@
     
     if([self leftParenthesisOrEmpty]){
         
-        polyhedralSurface = [SFPolyhedralSurface polyhedralSurfaceWithHasZ:hasZ andHasM:hasM];
+        polyhedralSurface = [SFPolyhedralSurface polyhedralSurfaceWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
         
         do {
             SFPolygon *polygon = [self readPolygonWithFilter:filter andHasZ:hasZ andHasM:hasM];
@@ -605,7 +1955,7 @@
     
     if([self leftParenthesisOrEmpty]){
         
-        tin = [SFTIN tinWithHasZ:hasZ andHasM:hasM];
+        tin = [SFTIN tinWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
         
         do {
             SFPolygon *polygon = [self readPolygonWithFilter:filter andHasZ:hasZ andHasM:hasM];
@@ -629,10 +1979,10 @@
     
     if([self leftParenthesisOrEmpty]){
         
-        triangle = [SFTriangle triangleWithHasZ:hasZ andHasM:hasM];
+        triangle = [SFTriangle triangleWithHasZ:[self projectZ:hasZ] andHasM:[self projectM:hasM]];
         
         do {
-            SFLineString *ring = [self readLineStringWithFilter:filter andHasZ:hasZ andHasM:hasM];
+            SFLineString *ring = [self readLineStringWithFilter:filter andHasZ:hasZ andHasM:hasM inType:SF_TRIANGLE];
             if([SFWTGeometryReader filter:filter geometry:ring inType:SF_TRIANGLE]){
                 [triangle addRing:ring];
             }
@@ -643,13 +1993,101 @@
     return triangle;
 }
 
+/**
+ * Validate the point count of a line string or circular string
+ *
+ * @param numPoints
+ *            number of points
+ * @param geometryType
+ *            line string or circular string geometry type
+ * @param containingType
+ *            containing geometry type
+ */
+-(void) validateNumPoints: (int) numPoints ofType: (SFGeometryType) geometryType inType: (SFGeometryType) containingType{
+    
+    if(_validationRules & SFWT_VALIDATE_MIN_POINTS){
+        
+        if(geometryType == SF_CIRCULARSTRING){
+            if(numPoints < 3 || numPoints % 2 == 0){
+                [self addIssueWithRule:SFWT_VALIDATE_MIN_POINTS andGeometryType:geometryType andMessage:[NSString stringWithFormat:@"Circular String requires an odd number of at least 3 points, found %d", numPoints]];
+            }
+        }else if(containingType == SF_TRIANGLE){
+            if(numPoints != 4){
+                [self addIssueWithRule:SFWT_VALIDATE_MIN_POINTS andGeometryType:containingType andMessage:[NSString stringWithFormat:@"Triangle ring requires 4 points, found %d", numPoints]];
+            }
+        }else if(containingType == SF_POLYGON || containingType == SF_CURVEPOLYGON){
+            if(numPoints < 4){
+                [self addIssueWithRule:SFWT_VALIDATE_MIN_POINTS andGeometryType:containingType andMessage:[NSString stringWithFormat:@"Ring requires at least 4 points, found %d", numPoints]];
+            }
+        }else if(numPoints < 2){
+            [self addIssueWithRule:SFWT_VALIDATE_MIN_POINTS andGeometryType:geometryType andMessage:[NSString stringWithFormat:@"Line String requires at least 2 points, found %d", numPoints]];
+        }
+        
+    }
+    
+}
+
+/**
+ * Validate a ring is closed
+ *
+ * @param ring
+ *            ring curve
+ * @param containingType
+ *            containing geometry type
+ */
+-(void) validateRing: (SFCurve *) ring inType: (SFGeometryType) containingType{
+    
+    if(_validationRules & SFWT_VALIDATE_CLOSED_RINGS){
+        
+        SFPoint *start = [ring startPoint];
+        SFPoint *end = [ring endPoint];
+        if(start != nil && end != nil
+           && ([start.x doubleValue] != [end.x doubleValue] || [start.y doubleValue] != [end.y doubleValue]
+               || (start.z != nil && end.z != nil && [start.z doubleValue] != [end.z doubleValue]))){
+            [self addIssueWithRule:SFWT_VALIDATE_CLOSED_RINGS andGeometryType:containingType andMessage:@"Ring is not closed"];
+        }
+        
+    }
+    
+}
+
+/**
+ * Add a validation issue, raising it when failing fast
+ *
+ * @param rule
+ *            violated rule
+ * @param geometryType
+ *            geometry type
+ * @param message
+ *            violation description
+ */
+-(void) addIssueWithRule: (SFWTValidationRules) rule andGeometryType: (SFGeometryType) geometryType andMessage: (NSString *) message{
+    
+    NSUInteger position = NSNotFound;
+    if([_reader isKindOfClass:[SFWTIndexedTextReader class]]){
+        position = [(SFWTIndexedTextReader *) _reader offset];
+    }
+    
+    SFWTValidationIssue *issue = [[SFWTValidationIssue alloc] initWithRule:rule andGeometryType:geometryType andPosition:position andMessage:message];
+    if(_validationFailFast){
+        @throw [NSException exceptionWithName:SFWT_VALIDATION_FAILED reason:[issue description] userInfo:@{SFWT_VALIDATION_ISSUE_KEY: issue}];
+    }
+    [_issues addObject:issue];
+    
+}
+
 /**
  * Read a left parenthesis or empty set
  *
  * @return true if not empty
  */
 -(BOOL) leftParenthesisOrEmpty{
-    return [SFWTGeometryReader leftParenthesisOrEmpty:_reader];
+    BOOL nonEmpty = [SFWTGeometryReader leftParenthesisOrEmpty:_reader];
+    if(nonEmpty && _limits != nil){
+        _allocation += [SFWTReaderLimits containerAllocation];
+        [_limits checkAllocation:_allocation];
+    }
+    return nonEmpty;
 }
 
 /**
@@ -658,6 +2096,12 @@
  * @return true if a comma
  */
 -(BOOL) commaOrRightParenthesis{
+    if(_separator != 0){
+        // Separator already read with the ordinates of a sequence point
+        BOOL comma = _separator == ',';
+        _separator = 0;
+        return comma;
+    }
     return [SFWTGeometryReader commaOrRightParenthesis:_reader];
 }
 
@@ -712,6 +2156,11 @@
     return [geometryReader readGeometryType];
 }
 
++(SFGeometry *) readMemberWithReader: (SFTextReader *) reader inType: (SFGeometryType) containingType andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    SFWTGeometryReader *geometryReader = [[SFWTGeometryReader alloc] initWithReader:reader];
+    return [geometryReader readMemberInType:containingType andHasZ:hasZ andHasM:hasM];
+}
+
 +(SFPoint *) readPointTextWithReader: (SFTextReader *) reader andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
     SFWTGeometryReader *geometryReader = [[SFWTGeometryReader alloc] initWithReader:reader];
     return [geometryReader readPointTextWithHasZ:hasZ andHasM:hasM];
@@ -861,6 +2310,12 @@
  */
 +(BOOL) leftParenthesisOrEmpty: (SFTextReader *) reader{
     
+    if([reader isKindOfClass:[SFWTIndexedTextReader class]]
+       && [(SFWTIndexedTextReader *)reader peekCharacter] == '('){
+        [(SFWTIndexedTextReader *)reader skipToken];
+        return YES;
+    }
+    
     BOOL nonEmpty;
     
     NSString *token = [reader readToken];
@@ -886,6 +2341,15 @@
  */
 +(BOOL) commaOrRightParenthesis: (SFTextReader *) reader{
     
+    if([reader isKindOfClass:[SFWTIndexedTextReader class]]){
+        SFWTIndexedTextReader *indexedReader = (SFWTIndexedTextReader *) reader;
+        uint8_t character = [indexedReader peekCharacter];
+        if(character == ',' || character == ')'){
+            [indexedReader skipToken];
+            return character == ',';
+        }
+    }
+    
     BOOL comma;
     
     NSString *token = [reader readToken];
@@ -909,6 +2373,11 @@
  *            text reader
  */
 +(void) rightParenthesis: (SFTextReader *) reader{
+    if([reader isKindOfClass:[SFWTIndexedTextReader class]]
+       && [(SFWTIndexedTextReader *)reader peekCharacter] == ')'){
+        [(SFWTIndexedTextReader *)reader skipToken];
+        return;
+    }
     NSString *token = [reader readToken];
     if (![token isEqualToString:@")"]) {
         [NSException raise:@"Invalid Token" format:@"Invalid token, expected ')'. found: '%@'", token];
@@ -923,6 +2392,10 @@
  * @return true if a left parenthesis or empty
  */
 +(BOOL) isLeftParenthesisOrEmpty: (SFTextReader *) reader{
+    if([reader isKindOfClass:[SFWTIndexedTextReader class]]
+       && [(SFWTIndexedTextReader *)reader peekCharacter] == '('){
+        return YES;
+    }
     NSString *token = [[reader peekToken] uppercaseString];
     return [token isEqualToString:@"EMPTY"] || [token isEqualToString:@"("];
 }
@@ -935,6 +2408,10 @@
  * @return true if a comma
  */
 +(BOOL) isCommaOrRightParenthesis: (SFTextReader *) reader{
+    if([reader isKindOfClass:[SFWTIndexedTextReader class]]){
+        uint8_t character = [(SFWTIndexedTextReader *)reader peekCharacter];
+        return character == ',' || character == ')';
+    }
     NSString *token = [reader peekToken];
     return [token isEqualToString:@","] || [token isEqualToString:@")"];
 }
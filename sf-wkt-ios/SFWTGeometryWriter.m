@@ -7,6 +7,7 @@
 //
 
 #import <SimpleFeaturesWKT/SFWTGeometryWriter.h>
+#import <xlocale.h>
 
 @interface SFWTGeometryWriter()
 
@@ -21,10 +22,12 @@
 
 static double DECIMAL_NUMBER_INFINITY;
 static double DECIMAL_NUMBER_NEGATIVE_INFINITY;
+static locale_t C_LOCALE;
 
 +(void) initialize{
     DECIMAL_NUMBER_INFINITY = [[[NSDecimalNumber alloc] initWithDouble:INFINITY] doubleValue];
     DECIMAL_NUMBER_NEGATIVE_INFINITY = [[[NSDecimalNumber alloc] initWithDouble:-INFINITY] doubleValue];
+    C_LOCALE = newlocale(LC_ALL_MASK, "C", NULL);
 }
 
 +(NSString *) writeGeometry: (SFGeometry *) geometry{
@@ -589,17 +592,30 @@ static double DECIMAL_NUMBER_NEGATIVE_INFINITY;
     if(value == nil){
         [string appendString:@"NaN"];
     }else{
-        double doubleValue = [value doubleValue];
-        if(isnan(doubleValue)){
-            [string appendString:@"NaN"];
-        }else if(doubleValue >= DECIMAL_NUMBER_INFINITY){
-            [string appendString:@"infinity"];
-        }else if(doubleValue <= DECIMAL_NUMBER_NEGATIVE_INFINITY){
-            [string appendString:@"-infinity"];
-        }else{
-            [string appendFormat:@"%@", [NSNumber numberWithDouble:doubleValue]];
+        char buffer[SFWT_VALUE_BUFFER_SIZE];
+        [self formatValue:[value doubleValue] toBuffer:buffer];
+        CFStringAppendCString((__bridge CFMutableStringRef) string, buffer, kCFStringEncodingASCII);
+    }
+}
+
++(int) formatValue: (double) value toBuffer: (char *) buffer{
+    int length = 0;
+    if(isnan(value)){
+        length = (int) strlcpy(buffer, "NaN", SFWT_VALUE_BUFFER_SIZE);
+    }else if(value >= DECIMAL_NUMBER_INFINITY || value == INFINITY){
+        length = (int) strlcpy(buffer, "infinity", SFWT_VALUE_BUFFER_SIZE);
+    }else if(value <= DECIMAL_NUMBER_NEGATIVE_INFINITY || value == -INFINITY){
+        length = (int) strlcpy(buffer, "-infinity", SFWT_VALUE_BUFFER_SIZE);
+    }else{
+        // Shortest round trip precision, matching NSNumber descriptions
+        for(int precision = 15; precision <= 17; precision++){
+            length = snprintf_l(buffer, SFWT_VALUE_BUFFER_SIZE, C_LOCALE, "%.*g", precision, value);
+            if(precision == 17 || strtod_l(buffer, NULL, C_LOCALE) == value){
+                break;
+            }
         }
     }
+    return length;
 }
 
 /**
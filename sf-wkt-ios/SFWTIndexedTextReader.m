@@ -0,0 +1,305 @@
+//
+//  SFWTIndexedTextReader.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+#import <xlocale.h>
+
+/**
+ * Exact powers of ten representable as doubles
+ */
+static const double sfwt_powers_of_ten[] = {
+    1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/**
+ * Largest mantissa exactly representable as a double
+ */
+static const uint64_t SFWT_MAX_EXACT_MANTISSA = 1ULL << 53;
+
+/**
+ * Longest number token parsed by the standard library fallback
+ */
+#define SFWT_MAX_PARSE_LENGTH 64
+
+/**
+ * Determine if the character is a word (non punctuation token) character
+ *
+ * @param c
+ *            character
+ * @return true if a word character
+ */
+static inline BOOL sfwt_is_word(uint8_t c){
+    return (c >= '0' && c <= '9') || ((c | 0x20) >= 'a' && (c | 0x20) <= 'z')
+        || c == '-' || c == '.' || c == '+';
+}
+
+/**
+ * Parse a decimal number exactly when the mantissa and power of ten are
+ * both exactly representable (Clinger's fast path)
+ *
+ * @param p
+ *            token start
+ * @param end
+ *            token end
+ * @param value
+ *            parsed value
+ * @return true if parsed
+ */
+static BOOL sfwt_parse_fast(const uint8_t *p, const uint8_t *end, double *value){
+
+    BOOL negative = NO;
+    if(p < end && (*p == '-' || *p == '+')){
+        negative = *p == '-';
+        p++;
+    }
+
+    uint64_t mantissa = 0;
+    int significant = 0;
+    int exponent = 0;
+    BOOL digits = NO;
+
+    for(; p < end && *p >= '0' && *p <= '9'; p++){
+        digits = YES;
+        if(mantissa != 0 || *p != '0'){
+            if(++significant > 19){
+                return NO;
+            }
+            mantissa = mantissa * 10 + (*p - '0');
+        }
+    }
+
+    if(p < end && *p == '.'){
+        for(p++; p < end && *p >= '0' && *p <= '9'; p++){
+            digits = YES;
+            if(mantissa != 0 || *p != '0'){
+                if(++significant > 19){
+                    return NO;
+                }
+                mantissa = mantissa * 10 + (*p - '0');
+            }
+            exponent--;
+        }
+    }
+
+    if(!digits){
+        return NO;
+    }
+
+    if(p < end && (*p == 'e' || *p == 'E')){
+        p++;
+        BOOL negativeExponent = NO;
+        if(p < end && (*p == '-' || *p == '+')){
+            negativeExponent = *p == '-';
+            p++;
+        }
+        if(p == end){
+            return NO;
+        }
+        int exponentValue = 0;
+        for(; p < end && *p >= '0' && *p <= '9'; p++){
+            if(exponentValue > 1000){
+                return NO;
+            }
+            exponentValue = exponentValue * 10 + (*p - '0');
+        }
+        exponent += negativeExponent ? -exponentValue : exponentValue;
+    }
+
+    if(p != end || mantissa > SFWT_MAX_EXACT_MANTISSA || exponent < -22 || exponent > 22){
+        return NO;
+    }
+
+    double result = (double) mantissa;
+    if(exponent < 0){
+        result /= sfwt_powers_of_ten[-exponent];
+    }else{
+        result *= sfwt_powers_of_ten[exponent];
+    }
+    *value = negative ? -result : result;
+
+    return YES;
+}
+
+/**
+ * C locale for number parsing
+ */
+static locale_t sfwt_c_locale(void){
+    static locale_t locale;
+    static dispatch_once_t once;
+    dispatch_once(&once, ^{
+        locale = newlocale(LC_ALL_MASK, "C", NULL);
+    });
+    return locale;
+}
+
+@interface SFWTIndexedTextReader()
+
+/**
+ * Structural index
+ */
+@property (nonatomic, strong) SFWTStructuralIndex *structuralIndex;
+
+@end
+
+@implementation SFWTIndexedTextReader{
+    const uint8_t *_bytes;
+    NSUInteger _length;
+    const uint32_t *_positions;
+    NSUInteger _count;
+    NSUInteger _next;
+}
+
++(SFTextReader *) readerWithText: (NSString *) text{
+    SFWTStructuralIndex *index = [[SFWTStructuralIndex alloc] initWithText:text];
+    SFTextReader *reader = nil;
+    if([index isASCII]){
+        reader = [[SFWTIndexedTextReader alloc] initWithIndex:index andText:text];
+    }else{
+        reader = [[SFTextReader alloc] initWithText:text];
+    }
+    return reader;
+}
+
+-(instancetype) initWithText: (NSString *) text{
+    return [self initWithIndex:[[SFWTStructuralIndex alloc] initWithText:text] andText:text];
+}
+
+-(instancetype) initWithIndex: (SFWTStructuralIndex *) index andText: (NSString *) text{
+    self = [super initWithText:text];
+    if(self != nil){
+        _structuralIndex = index;
+        _bytes = [index bytes];
+        _length = [index length];
+        _positions = [index positions];
+        _count = [index count];
+        _next = 0;
+    }
+    return self;
+}
+
+-(SFWTStructuralIndex *) index{
+    return _structuralIndex;
+}
+
+-(NSUInteger) position{
+    return _next;
+}
+
+-(NSUInteger) offset{
+    return _next < _count ? _positions[_next] : _length;
+}
+
+-(void) seek: (NSUInteger) position{
+    _next = MIN(position, _count);
+}
+
+-(uint8_t) peekCharacter{
+    return _next < _count ? _bytes[_positions[_next]] : 0;
+}
+
+-(void) skipToken{
+    if(_next < _count){
+        _next++;
+    }
+}
+
+-(NSString *) readToken{
+    NSString *token = [self peekToken];
+    [self skipToken];
+    return token;
+}
+
+-(NSString *) peekToken{
+
+    NSString *token = nil;
+
+    if(_next < _count){
+
+        NSUInteger start = _positions[_next];
+        uint8_t c = _bytes[start];
+
+        switch(c){
+            case '(':
+                token = @"(";
+                break;
+            case ')':
+                token = @")";
+                break;
+            case ',':
+                token = @",";
+                break;
+            default:
+                {
+                    NSUInteger end = [self tokenEnd:start];
+                    token = [[NSString alloc] initWithBytes:_bytes + start length:end - start encoding:NSUTF8StringEncoding];
+                    if(token == nil){
+                        token = [[NSString alloc] initWithBytes:_bytes + start length:end - start encoding:NSISOLatin1StringEncoding];
+                    }
+                }
+                break;
+        }
+
+    }
+
+    return token;
+}
+
+-(double) readDouble{
+
+    if(_next >= _count){
+        [NSException raise:@"Invalid Token" format:@"Invalid token, expected double. found end of text"];
+    }
+
+    NSUInteger start = _positions[_next];
+    NSUInteger end = [self tokenEnd:start];
+    const uint8_t *tokenStart = _bytes + start;
+    const uint8_t *tokenEnd = _bytes + end;
+
+    double value;
+    if(!sfwt_parse_fast(tokenStart, tokenEnd, &value)){
+        // The bytes are not null terminated, parse a bounded copy. Hex
+        // tokens, which strtod accepts, are left to the standard reader.
+        char buffer[SFWT_MAX_PARSE_LENGTH + 1];
+        NSUInteger length = end - start;
+        BOOL parsed = NO;
+        if(length <= SFWT_MAX_PARSE_LENGTH && memchr(tokenStart, 'x', length) == NULL && memchr(tokenStart, 'X', length) == NULL){
+            memcpy(buffer, tokenStart, length);
+            buffer[length] = '\0';
+            char *parseEnd = NULL;
+            value = strtod_l(buffer, &parseEnd, sfwt_c_locale());
+            parsed = parseEnd == buffer + length;
+        }
+        if(!parsed){
+            // Match the standard reader for anything that is not a plain number
+            value = [[self peekToken] doubleValue];
+        }
+    }
+    _next++;
+
+    return value;
+}
+
+/**
+ * Get the end byte position of the token starting at the position
+ *
+ * @param start
+ *            token start byte position
+ * @return token end byte position (exclusive)
+ */
+-(NSUInteger) tokenEnd: (NSUInteger) start{
+    NSUInteger end = start + 1;
+    if(sfwt_is_word(_bytes[start])){
+        while(end < _length && sfwt_is_word(_bytes[end])){
+            end++;
+        }
+    }
+    return end;
+}
+
+@end
@@ -0,0 +1,401 @@
+//
+//  SFWTLazyGeometry.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTLazyGeometry.h>
+#import <SimpleFeaturesWKT/SFWTGeometryReader.h>
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+
+@interface SFWTLazyGeometry()
+
+/**
+ * Text reader over the shared structural index
+ */
+@property (nonatomic, strong) SFWTIndexedTextReader *reader;
+
+/**
+ * Cached members, NSNull when not yet parsed
+ */
+@property (nonatomic, strong) NSMutableArray *members;
+
+/**
+ * Cached lazy members, NSNull when not yet created
+ */
+@property (nonatomic, strong) NSMutableArray *lazyMembers;
+
+/**
+ * Cached full geometry
+ */
+@property (nonatomic, strong) SFGeometry *parsedGeometry;
+
+@end
+
+@implementation SFWTLazyGeometry{
+    SFGeometryType _geometryType;
+    BOOL _hasZ;
+    BOOL _hasM;
+    NSUInteger _tag;
+    NSUInteger _start;
+    NSUInteger *_memberStarts;
+    int _numMembers;
+    BOOL _coordinate;
+}
+
++(SFWTLazyGeometry *) lazyGeometryWithText: (NSString *) text{
+    return [self lazyGeometryWithIndex:[[SFWTStructuralIndex alloc] initWithText:text] andText:text];
+}
+
++(SFWTLazyGeometry *) lazyGeometryWithIndex: (SFWTStructuralIndex *) index andText: (NSString *) text{
+    if(![index isASCII]){
+        // Index positions do not tokenize non ASCII text, parse with a plain reader
+        SFGeometry *geometry = [SFWTGeometryReader readGeometryWithReader:[[SFTextReader alloc] initWithText:text]];
+        return geometry != nil && ![geometry isEmpty] ? [[SFWTLazyGeometry alloc] initWithGeometry:geometry] : nil;
+    }
+    SFWTIndexedTextReader *reader = [[SFWTIndexedTextReader alloc] initWithIndex:index andText:text];
+    return [self lazyGeometryWithReader:reader atPosition:0 inType:SF_NONE andHasZ:NO andHasM:NO];
+}
+
+/**
+ * Create a lazy geometry at a token position
+ *
+ * @param reader
+ *            indexed text reader
+ * @param position
+ *            token position of the geometry
+ * @param containingType
+ *            containing geometry type, SF_NONE for a top level geometry
+ * @param hasZ
+ *            containing geometry has z values
+ * @param hasM
+ *            containing geometry has m values
+ *
+ * @return lazy geometry, nil if empty
+ */
++(SFWTLazyGeometry *) lazyGeometryWithReader: (SFWTIndexedTextReader *) reader atPosition: (NSUInteger) position inType: (SFGeometryType) containingType andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+
+    [reader seek:position];
+
+    SFGeometryType geometryType = SF_NONE;
+    NSUInteger tag = NSNotFound;
+
+    if(containingType != SF_NONE && [SFWTGeometryReader isLeftParenthesisOrEmpty:reader]){
+        // Untagged member, typed by the containing geometry
+        switch(containingType){
+            case SF_POLYGON:
+            case SF_TRIANGLE:
+            case SF_MULTILINESTRING:
+            case SF_MULTICURVE:
+            case SF_COMPOUNDCURVE:
+            case SF_CURVEPOLYGON:
+                geometryType = SF_LINESTRING;
+                break;
+            case SF_MULTIPOLYGON:
+            case SF_POLYHEDRALSURFACE:
+            case SF_TIN:
+            case SF_MULTISURFACE:
+                geometryType = SF_POLYGON;
+                break;
+            case SF_MULTIPOINT:
+                geometryType = SF_POINT;
+                break;
+            default:
+                [NSException raise:@"Unexpected Geometry" format:@"Expected a geometry type within %@", [SFGeometryTypes name:containingType]];
+        }
+    }else if(containingType == SF_POINT || containingType == SF_LINESTRING
+             || containingType == SF_CIRCULARSTRING || containingType == SF_MULTIPOINT){
+        // Coordinate member, a point without parentheses
+        return [[SFWTLazyGeometry alloc] initWithReader:reader atCoordinate:position andHasZ:hasZ andHasM:hasM];
+    }else if(containingType == SF_NONE || containingType == SF_GEOMETRYCOLLECTION
+             || containingType == SF_MULTICURVE || containingType == SF_COMPOUNDCURVE
+             || containingType == SF_CURVEPOLYGON || containingType == SF_MULTISURFACE){
+        tag = position;
+        SFWTGeometryTypeInfo *geometryTypeInfo = [SFWTGeometryReader readGeometryTypeWithReader:reader];
+        if(geometryTypeInfo == nil){
+            return nil;
+        }
+        geometryType = [geometryTypeInfo geometryType];
+        hasZ = [geometryTypeInfo hasZ];
+        hasM = [geometryTypeInfo hasM];
+    }else{
+        [NSException raise:@"Unexpected Geometry" format:@"Unexpected member of %@", [SFGeometryTypes name:containingType]];
+    }
+
+    NSUInteger start = [reader position];
+    if(![SFWTGeometryReader leftParenthesisOrEmpty:reader]){
+        return nil;
+    }
+
+    return [[SFWTLazyGeometry alloc] initWithReader:reader atTag:tag andPosition:start andType:geometryType andHasZ:hasZ andHasM:hasM];
+}
+
+/**
+ * Initializer
+ *
+ * @param reader
+ *            indexed text reader
+ * @param tag
+ *            token position of the geometry type tag, NSNotFound if untagged
+ * @param start
+ *            token position of the geometry left parenthesis
+ * @param geometryType
+ *            geometry type
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ */
+-(instancetype) initWithReader: (SFWTIndexedTextReader *) reader atTag: (NSUInteger) tag andPosition: (NSUInteger) start andType: (SFGeometryType) geometryType andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    self = [super init];
+    if(self != nil){
+        _reader = reader;
+        _tag = tag;
+        _start = start;
+        _geometryType = geometryType;
+        _hasZ = hasZ;
+        _hasM = hasM;
+        [self indexMembers];
+        [self initMembers];
+    }
+    return self;
+}
+
+/**
+ * Initializer for a coordinate member, a point of a line string, circular
+ * string or multi point without parentheses
+ *
+ * @param reader
+ *            indexed text reader
+ * @param start
+ *            token position of the coordinate
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ */
+-(instancetype) initWithReader: (SFWTIndexedTextReader *) reader atCoordinate: (NSUInteger) start andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    self = [super init];
+    if(self != nil){
+        _reader = reader;
+        _tag = NSNotFound;
+        _start = start;
+        _geometryType = SF_POINT;
+        _hasZ = hasZ;
+        _hasM = hasM;
+        _coordinate = YES;
+        _memberStarts = malloc(sizeof(NSUInteger));
+        _memberStarts[0] = start;
+        _numMembers = 1;
+        [self initMembers];
+    }
+    return self;
+}
+
+/**
+ * Initializer for a geometry already parsed from non ASCII text
+ *
+ * @param geometry
+ *            parsed geometry
+ */
+-(instancetype) initWithGeometry: (SFGeometry *) geometry{
+    self = [super init];
+    if(self != nil){
+        _tag = NSNotFound;
+        _geometryType = geometry.geometryType;
+        _hasZ = geometry.hasZ;
+        _hasM = geometry.hasM;
+        _parsedGeometry = geometry;
+        _members = [SFWTLazyGeometry membersOfGeometry:geometry];
+        _numMembers = (int) _members.count;
+        _lazyMembers = [NSMutableArray arrayWithCapacity:_numMembers];
+        for(int i = 0; i < _numMembers; i++){
+            [_lazyMembers addObject:[NSNull null]];
+        }
+    }
+    return self;
+}
+
+/**
+ * Initialize the member caches as not yet parsed
+ */
+-(void) initMembers{
+    _members = [NSMutableArray arrayWithCapacity:_numMembers];
+    _lazyMembers = [NSMutableArray arrayWithCapacity:_numMembers];
+    for(int i = 0; i < _numMembers; i++){
+        [_members addObject:[NSNull null]];
+        [_lazyMembers addObject:[NSNull null]];
+    }
+}
+
+/**
+ * Get the members of a parsed geometry, matching the members indexed from
+ * the text
+ *
+ * @param geometry
+ *            parsed geometry
+ *
+ * @return members
+ */
++(NSMutableArray *) membersOfGeometry: (SFGeometry *) geometry{
+    NSArray *members = nil;
+    if([geometry isKindOfClass:[SFPoint class]]){
+        members = @[geometry];
+    }else if([geometry isKindOfClass:[SFLineString class]]){
+        members = ((SFLineString *) geometry).points;
+    }else if([geometry isKindOfClass:[SFCurvePolygon class]]){
+        members = ((SFCurvePolygon *) geometry).rings;
+    }else if([geometry isKindOfClass:[SFCompoundCurve class]]){
+        members = ((SFCompoundCurve *) geometry).lineStrings;
+    }else if([geometry isKindOfClass:[SFPolyhedralSurface class]]){
+        members = ((SFPolyhedralSurface *) geometry).polygons;
+    }else if([geometry isKindOfClass:[SFGeometryCollection class]]){
+        members = ((SFGeometryCollection *) geometry).geometries;
+    }
+    return members != nil ? [NSMutableArray arrayWithArray:members] : [NSMutableArray array];
+}
+
+-(void) dealloc{
+    free(_memberStarts);
+}
+
+-(SFGeometryType) geometryType{
+    return _geometryType;
+}
+
+-(BOOL) hasZ{
+    return _hasZ;
+}
+
+-(BOOL) hasM{
+    return _hasM;
+}
+
+-(int) numMembers{
+    return _numMembers;
+}
+
+-(SFGeometry *) memberAtIndex: (int) index{
+
+    [self validateIndex:index];
+
+    id member = [_members objectAtIndex:index];
+    if(member == [NSNull null]){
+        [_reader seek:_memberStarts[index]];
+        member = [SFWTGeometryReader readMemberWithReader:_reader inType:_geometryType andHasZ:_hasZ andHasM:_hasM];
+        [_members replaceObjectAtIndex:index withObject:member != nil ? member : [NSNull null]];
+    }
+
+    return member != [NSNull null] ? member : nil;
+}
+
+-(SFWTLazyGeometry *) lazyMemberAtIndex: (int) index{
+
+    [self validateIndex:index];
+
+    id member = [_lazyMembers objectAtIndex:index];
+    if(member == [NSNull null] && _reader == nil){
+        member = [[SFWTLazyGeometry alloc] initWithGeometry:[_members objectAtIndex:index]];
+        [_lazyMembers replaceObjectAtIndex:index withObject:member];
+    }else if(member == [NSNull null]){
+        SFWTIndexedTextReader *reader = [[SFWTIndexedTextReader alloc] initWithIndex:[_reader index] andText:[_reader text]];
+        member = [SFWTLazyGeometry lazyGeometryWithReader:reader atPosition:_memberStarts[index] inType:_geometryType andHasZ:_hasZ andHasM:_hasM];
+        if(member != nil){
+            [_lazyMembers replaceObjectAtIndex:index withObject:member];
+        }
+    }
+
+    return member != [NSNull null] ? member : nil;
+}
+
+-(SFGeometry *) geometry{
+    if(_parsedGeometry == nil){
+        SFWTGeometryReader *geometryReader = [[SFWTGeometryReader alloc] initWithReader:_reader];
+        if(_tag != NSNotFound){
+            [_reader seek:_tag];
+            _parsedGeometry = [geometryReader read];
+        }else{
+            [_reader seek:_start];
+            switch(_geometryType){
+                case SF_POINT:
+                    if(_coordinate){
+                        _parsedGeometry = [geometryReader readPointWithHasZ:_hasZ andHasM:_hasM];
+                    }else{
+                        _parsedGeometry = [geometryReader readPointTextWithHasZ:_hasZ andHasM:_hasM];
+                    }
+                    break;
+                case SF_LINESTRING:
+                    _parsedGeometry = [geometryReader readLineStringWithHasZ:_hasZ andHasM:_hasM];
+                    break;
+                default:
+                    _parsedGeometry = [geometryReader readPolygonWithHasZ:_hasZ andHasM:_hasM];
+                    break;
+            }
+        }
+    }
+    return _parsedGeometry;
+}
+
+/**
+ * Index the token positions of the members within the geometry parentheses
+ */
+-(void) indexMembers{
+
+    SFWTStructuralIndex *index = [_reader index];
+    NSUInteger count = [index count];
+
+    int capacity = 8;
+    _memberStarts = malloc(capacity * sizeof(NSUInteger));
+    _numMembers = 0;
+
+    int open = 0;
+    BOOL memberStart = YES;
+    BOOL closed = NO;
+
+    for(NSUInteger i = _start + 1; i < count && !closed; i++){
+
+        uint8_t c = [index characterAtIndex:i];
+
+        if(memberStart && !(c == ')' && open == 0)){
+            if(_numMembers == capacity){
+                capacity *= 2;
+                _memberStarts = reallocf(_memberStarts, capacity * sizeof(NSUInteger));
+            }
+            _memberStarts[_numMembers++] = i;
+            memberStart = NO;
+        }
+
+        if(c == '('){
+            open++;
+        }else if(c == ')'){
+            if(open == 0){
+                closed = YES;
+            }else{
+                open--;
+            }
+        }else if(c == ',' && open == 0){
+            memberStart = YES;
+        }
+
+    }
+
+    if(!closed){
+        [NSException raise:@"Invalid Token" format:@"Invalid token, expected ')' closing %@", [SFGeometryTypes name:_geometryType]];
+    }
+}
+
+/**
+ * Validate a member index
+ *
+ * @param index
+ *            member index
+ */
+-(void) validateIndex: (int) index{
+    if(index < 0 || index >= _numMembers){
+        [NSException raise:NSRangeException format:@"Member index %d out of bounds for %d members", index, _numMembers];
+    }
+}
+
+@end
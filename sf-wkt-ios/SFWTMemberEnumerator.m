@@ -0,0 +1,92 @@
+//
+//  SFWTMemberEnumerator.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTMemberEnumerator.h>
+#import <SimpleFeaturesWKT/SFWTGeometryReader.h>
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+
+@interface SFWTMemberEnumerator()
+
+/**
+ * Text Reader
+ */
+@property (nonatomic, strong) SFTextReader *reader;
+
+/**
+ * Geometry reader over the text reader
+ */
+@property (nonatomic, strong) SFWTGeometryReader *geometryReader;
+
+@end
+
+@implementation SFWTMemberEnumerator{
+    SFGeometryType _geometryType;
+    BOOL _hasZ;
+    BOOL _hasM;
+    int _count;
+    BOOL _done;
+}
+
+-(instancetype) initWithText: (NSString *) text{
+    return [self initWithReader:[SFWTIndexedTextReader readerWithText:text]];
+}
+
+-(instancetype) initWithReader: (SFTextReader *) reader{
+    self = [super init];
+    if(self != nil){
+        _reader = reader;
+        _geometryReader = [[SFWTGeometryReader alloc] initWithReader:reader];
+        _geometryType = SF_NONE;
+        _count = 0;
+        _done = YES;
+        SFWTGeometryTypeInfo *geometryTypeInfo = [SFWTGeometryReader readGeometryTypeWithReader:reader];
+        if(geometryTypeInfo != nil){
+            _geometryType = [geometryTypeInfo geometryType];
+            _hasZ = [geometryTypeInfo hasZ];
+            _hasM = [geometryTypeInfo hasM];
+            _done = ![SFWTGeometryReader leftParenthesisOrEmpty:reader];
+        }
+    }
+    return self;
+}
+
+-(SFGeometryType) geometryType{
+    return _geometryType;
+}
+
+-(BOOL) hasZ{
+    return _hasZ;
+}
+
+-(BOOL) hasM{
+    return _hasM;
+}
+
+-(int) count{
+    return _count;
+}
+
+-(SFGeometry *) nextObject{
+
+    SFGeometry *member = nil;
+
+    while(member == nil && !_done){
+        @autoreleasepool {
+            if(_count > 0 && ![SFWTGeometryReader commaOrRightParenthesis:_reader]){
+                _done = YES;
+            }else{
+                member = [_geometryReader readMemberInType:_geometryType andHasZ:_hasZ andHasM:_hasM];
+                _count++;
+            }
+        }
+    }
+
+    return member;
+}
+
+@end
@@ -0,0 +1,217 @@
+//
+//  SFWTQuantizedReader.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTQuantizedReader.h>
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+
+/**
+ * Number of quantized values staged before appending to the output
+ */
+#define SFWT_QUANTIZED_STAGE_SIZE 512
+
+@interface SFWTQuantizedReader()
+
+/**
+ * Event reader
+ */
+@property (nonatomic, strong) SFWTEventReader *eventReader;
+
+@end
+
+@implementation SFWTQuantizedReader{
+    int64_t _stage[SFWT_QUANTIZED_STAGE_SIZE];
+    int _staged;
+    SFGeometryType _geometryType;
+    int _numParts;
+    NSUInteger _numPoints;
+    NSUInteger _numDropped;
+}
+
+-(instancetype) initWithText: (NSString *) text{
+    return [self initWithReader:[SFWTIndexedTextReader readerWithText:text]];
+}
+
+-(instancetype) initWithReader: (SFTextReader *) reader{
+    self = [super init];
+    if(self != nil){
+        _eventReader = [[SFWTEventReader alloc] initWithReader:reader];
+        _scaleX = 1.0;
+        _scaleY = 1.0;
+        _offsetX = 0.0;
+        _offsetY = 0.0;
+        _width = SFWT_QUANTIZED_INT32;
+        _dropDuplicates = NO;
+        _geometryType = SF_NONE;
+    }
+    return self;
+}
+
+-(void) setScale: (double) scale andOffsetX: (double) offsetX andOffsetY: (double) offsetY{
+    _scaleX = scale;
+    _scaleY = scale;
+    _offsetX = offsetX;
+    _offsetY = offsetY;
+}
+
+-(void) setGridWithEnvelope: (SFGeometryEnvelope *) envelope andExtent: (int64_t) extent{
+    double minX = [envelope.minX doubleValue];
+    double minY = [envelope.minY doubleValue];
+    double width = [envelope.maxX doubleValue] - minX;
+    double height = [envelope.maxY doubleValue] - minY;
+    if(!(width > 0) || !(height > 0) || extent <= 0){
+        [NSException raise:@"Invalid Grid" format:@"Grid envelope must have a positive width and height and the extent must be positive. width: %f, height: %f, extent: %lld", width, height, extent];
+    }
+    _scaleX = extent / width;
+    _scaleY = extent / height;
+    _offsetX = minX;
+    _offsetY = minY;
+}
+
+-(BOOL) readToCoordinates: (NSMutableData *) coordinates andCounts: (NSMutableData *) counts{
+
+    [_eventReader setLimits:_limits];
+
+    _numParts = 0;
+    _numPoints = 0;
+    _numDropped = 0;
+    _staged = 0;
+
+    SFWTEventType event = [_eventReader next];
+    if(event == SFWT_EVENT_NONE){
+        _geometryType = SF_NONE;
+        return NO;
+    }
+    _geometryType = [_eventReader geometryType];
+    if(![SFWTQuantizedReader isSupportedGeometryType:_geometryType]){
+        [_eventReader skipGeometry];
+        [NSException raise:@"Unsupported Geometry" format:@"Geometry Type parts are not representable by flat part counts: %@", [SFGeometryTypes name:_geometryType]];
+    }
+
+    double max = _width == SFWT_QUANTIZED_INT32 ? (double) INT32_MAX : 9223372036854774784.0;
+    double min = _width == SFWT_QUANTIZED_INT32 ? (double) INT32_MIN : (double) INT64_MIN;
+
+    BOOL inPart = NO;
+    uint32_t partPoints = 0;
+    int64_t previousX = 0;
+    int64_t previousY = 0;
+
+    while(event != SFWT_EVENT_NONE){
+
+        if(event == SFWT_EVENT_COORDINATE){
+
+            double x = round(([_eventReader x] - _offsetX) * _scaleX);
+            double y = round(([_eventReader y] - _offsetY) * _scaleY);
+            if(!(x >= min && x <= max && y >= min && y <= max)){
+                [NSException raise:@"Invalid Value" format:@"Coordinate does not quantize within the integer width. x: %f, y: %f", [_eventReader x], [_eventReader y]];
+            }
+            int64_t qx = (int64_t) x;
+            int64_t qy = (int64_t) y;
+
+            if(inPart && _dropDuplicates && qx == previousX && qy == previousY){
+                _numDropped++;
+            }else{
+                if(_staged == SFWT_QUANTIZED_STAGE_SIZE){
+                    [self flushToCoordinates:coordinates];
+                }
+                _stage[_staged++] = qx;
+                _stage[_staged++] = qy;
+                previousX = qx;
+                previousY = qy;
+                partPoints++;
+                _numPoints++;
+            }
+            inPart = YES;
+
+        }else if(event == SFWT_EVENT_END_GEOMETRY){
+
+            if(inPart){
+                [counts appendBytes:&partPoints length:sizeof(uint32_t)];
+                _numParts++;
+                inPart = NO;
+                partPoints = 0;
+            }
+            if([_eventReader depth] == 1){
+                break;
+            }
+
+        }
+
+        event = [_eventReader next];
+    }
+
+    [self flushToCoordinates:coordinates];
+
+    return YES;
+}
+
+-(SFGeometryType) geometryType{
+    return _geometryType;
+}
+
+-(int) numParts{
+    return _numParts;
+}
+
+-(NSUInteger) numPoints{
+    return _numPoints;
+}
+
+-(NSUInteger) numDropped{
+    return _numDropped;
+}
+
+/**
+ * Determine if the geometry type parts map one to one onto flat part
+ * counts. Nested polygons and collections would lose their grouping and
+ * curves would lose their arc control point semantics.
+ *
+ * @param geometryType
+ *            geometry type
+ *
+ * @return true if supported
+ */
++(BOOL) isSupportedGeometryType: (SFGeometryType) geometryType{
+    BOOL supported = NO;
+    switch(geometryType){
+        case SF_POINT:
+        case SF_LINESTRING:
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+        case SF_MULTIPOINT:
+        case SF_MULTILINESTRING:
+            supported = YES;
+            break;
+        default:
+            break;
+    }
+    return supported;
+}
+
+/**
+ * Append the staged values to the coordinates in the integer width
+ *
+ * @param coordinates
+ *            quantized coordinate output
+ */
+-(void) flushToCoordinates: (NSMutableData *) coordinates{
+    if(_staged > 0){
+        if(_width == SFWT_QUANTIZED_INT64){
+            [coordinates appendBytes:_stage length:_staged * sizeof(int64_t)];
+        }else{
+            NSUInteger length = [coordinates length];
+            [coordinates increaseLengthBy:_staged * sizeof(int32_t)];
+            int32_t *values = (int32_t *) ((uint8_t *) [coordinates mutableBytes] + length);
+            for(int i = 0; i < _staged; i++){
+                values[i] = (int32_t) _stage[i];
+            }
+        }
+        _staged = 0;
+    }
+}
+
+@end
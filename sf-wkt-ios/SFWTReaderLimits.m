@@ -0,0 +1,107 @@
+//
+//  SFWTReaderLimits.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTReaderLimits.h>
+
+NSString * const SFWT_LIMIT_EXCEEDED = @"Limit Exceeded";
+
+/**
+ * Approximate point object size
+ */
+static NSUInteger const POINT_ALLOCATION = 48;
+
+/**
+ * Approximate decimal number ordinate size
+ */
+static NSUInteger const ORDINATE_ALLOCATION = 32;
+
+/**
+ * Approximate mutable array slot size
+ */
+static NSUInteger const SLOT_ALLOCATION = 8;
+
+/**
+ * Approximate geometry container size, object and backing array
+ */
+static NSUInteger const CONTAINER_ALLOCATION = 112;
+
+@implementation SFWTReaderLimits
+
++(SFWTReaderLimits *) limits{
+    return [[SFWTReaderLimits alloc] init];
+}
+
++(SFWTReaderLimits *) limitsWithMaxDepth: (int) maxDepth andMaxCoordinates: (NSUInteger) maxCoordinates andMaxBytes: (NSUInteger) maxBytes andMaxAllocation: (NSUInteger) maxAllocation{
+    return [[SFWTReaderLimits alloc] initWithMaxDepth:maxDepth andMaxCoordinates:maxCoordinates andMaxBytes:maxBytes andMaxAllocation:maxAllocation];
+}
+
+-(instancetype) init{
+    return [self initWithMaxDepth:0 andMaxCoordinates:0 andMaxBytes:0 andMaxAllocation:0];
+}
+
+-(instancetype) initWithMaxDepth: (int) maxDepth andMaxCoordinates: (NSUInteger) maxCoordinates andMaxBytes: (NSUInteger) maxBytes andMaxAllocation: (NSUInteger) maxAllocation{
+    self = [super init];
+    if(self != nil){
+        _maxDepth = maxDepth;
+        _maxCoordinates = maxCoordinates;
+        _maxBytes = maxBytes;
+        _maxAllocation = maxAllocation;
+    }
+    return self;
+}
+
+-(void) checkDepth: (int) depth{
+    if(_maxDepth > 0 && depth > _maxDepth){
+        [NSException raise:SFWT_LIMIT_EXCEEDED format:@"Geometry nesting depth of %d exceeds the max depth of %d", depth, _maxDepth];
+    }
+}
+
+-(void) checkCoordinates: (NSUInteger) coordinates{
+    if(_maxCoordinates > 0 && coordinates > _maxCoordinates){
+        [NSException raise:SFWT_LIMIT_EXCEEDED format:@"Coordinate count of %lu exceeds the max coordinates of %lu", (unsigned long)coordinates, (unsigned long)_maxCoordinates];
+    }
+}
+
+-(void) checkText: (NSString *) text{
+    if(_maxBytes > 0 && text != nil){
+        // Each UTF-16 character is at least one and at most three UTF-8 bytes
+        NSUInteger length = [text length];
+        if(length > _maxBytes || length * 3 > _maxBytes){
+            [self checkBytes:[text lengthOfBytesUsingEncoding:NSUTF8StringEncoding]];
+        }
+    }
+}
+
+-(void) checkBytes: (NSUInteger) bytes{
+    if(_maxBytes > 0 && bytes > _maxBytes){
+        [NSException raise:SFWT_LIMIT_EXCEEDED format:@"Input size of %lu bytes exceeds the max bytes of %lu", (unsigned long)bytes, (unsigned long)_maxBytes];
+    }
+}
+
+-(void) checkAllocation: (NSUInteger) allocation{
+    if(_maxAllocation > 0 && allocation > _maxAllocation){
+        [NSException raise:SFWT_LIMIT_EXCEEDED format:@"Approximate allocation of %lu bytes exceeds the max allocation of %lu", (unsigned long)allocation, (unsigned long)_maxAllocation];
+    }
+}
+
++(NSUInteger) pointAllocationWithHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    NSUInteger ordinates = 2;
+    if(hasZ){
+        ordinates++;
+    }
+    if(hasM){
+        ordinates++;
+    }
+    return POINT_ALLOCATION + ordinates * ORDINATE_ALLOCATION + SLOT_ALLOCATION;
+}
+
++(NSUInteger) containerAllocation{
+    return CONTAINER_ALLOCATION;
+}
+
+@end
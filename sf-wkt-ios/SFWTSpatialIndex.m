@@ -0,0 +1,435 @@
+//
+//  SFWTSpatialIndex.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTSpatialIndex.h>
+#import <SimpleFeaturesWKT/SFWTGeometryReader.h>
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+
+int const SFWT_SPATIAL_INDEX_DEFAULT_NODE_CAPACITY = 16;
+
+/**
+ * Spatial index magic
+ */
+static const char MAGIC[8] = {'S', 'F', 'W', 'T', 'S', 'I', 'D', 'X'};
+
+/**
+ * Spatial index version
+ */
+static uint32_t const VERSION = 1;
+
+/**
+ * Byte order mark, read back as a different value on other byte orders
+ */
+static uint32_t const BYTE_ORDER_MARK = 0x01020304;
+
+/**
+ * Spatial index header
+ */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrderMark;
+    uint32_t nodeCapacity;
+    uint32_t reserved;
+    uint64_t numRecords;
+    uint64_t numNodes;
+    uint64_t textLength;
+    uint64_t reserved2[2];
+} SFWTSpatialHeader;
+
+/**
+ * Indexed record, bounds first for the shared STR sort
+ */
+typedef struct {
+    double bounds[4];
+    uint64_t location;
+    uint64_t length;
+    uint64_t record;
+} SFWTSpatialRecord;
+
+/**
+ * Tree node, bounds first for the shared STR sort. Leaf node children are
+ * records, other node children are nodes.
+ */
+typedef struct {
+    double bounds[4];
+    uint32_t first;
+    uint32_t count;
+    uint32_t leaf;
+    uint32_t reserved;
+} SFWTSpatialNode;
+
+static int sfwt_compare_center_x(const void *a, const void *b){
+    const double *first = a;
+    const double *second = b;
+    double difference = (first[0] + first[2]) - (second[0] + second[2]);
+    return difference < 0 ? -1 : (difference > 0 ? 1 : 0);
+}
+
+static int sfwt_compare_center_y(const void *a, const void *b){
+    const double *first = a;
+    const double *second = b;
+    double difference = (first[1] + first[3]) - (second[1] + second[3]);
+    return difference < 0 ? -1 : (difference > 0 ? 1 : 0);
+}
+
+/**
+ * Sort-Tile-Recursive order: sort by center x, then sort each vertical
+ * slice of tiles by center y
+ */
+static void sfwt_str_sort(void *items, size_t count, size_t size, uint32_t nodeCapacity){
+    qsort(items, count, size, sfwt_compare_center_x);
+    size_t leaves = (count + nodeCapacity - 1) / nodeCapacity;
+    size_t slices = (size_t) ceil(sqrt((double) leaves));
+    size_t sliceSize = MAX(1, slices) * nodeCapacity;
+    for(size_t start = 0; start < count; start += sliceSize){
+        qsort((uint8_t *) items + start * size, MIN(sliceSize, count - start), size, sfwt_compare_center_y);
+    }
+}
+
+static BOOL sfwt_intersects(const double *bounds, const double *window){
+    return bounds[0] <= window[2] && bounds[2] >= window[0] && bounds[1] <= window[3] && bounds[3] >= window[1];
+}
+
+@interface SFWTSpatialIndex()
+
+/**
+ * Index data
+ */
+@property (nonatomic, strong) NSData *data;
+
+@end
+
+@implementation SFWTSpatialIndex{
+    const SFWTSpatialHeader *_header;
+    const SFWTSpatialRecord *_records;
+    const SFWTSpatialNode *_nodes;
+    NSDictionary<NSNumber *, NSNumber *> *_recordIndexes;
+}
+
++(SFWTSpatialIndex *) indexWithText: (NSString *) text{
+    return [[SFWTSpatialIndex alloc] initWithText:text andNodeCapacity:SFWT_SPATIAL_INDEX_DEFAULT_NODE_CAPACITY];
+}
+
++(SFWTSpatialIndex *) indexWithPath: (NSString *) path error: (NSError **) error{
+    SFWTSpatialIndex *index = nil;
+    NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedIfSafe error:error];
+    if(data != nil){
+        index = [[SFWTSpatialIndex alloc] initWithData:data];
+    }
+    return index;
+}
+
+-(instancetype) initWithText: (NSString *) text andNodeCapacity: (int) nodeCapacity{
+    self = [super init];
+    if(self != nil){
+        if(nodeCapacity < 2){
+            [NSException raise:@"Invalid Node Capacity" format:@"Spatial index node capacity must be at least 2: %d", nodeCapacity];
+        }
+        [self buildWithText:text andNodeCapacity:(uint32_t) nodeCapacity];
+    }
+    return self;
+}
+
+-(instancetype) initWithData: (NSData *) data{
+    self = [super init];
+    if(self != nil){
+        [self loadData:data];
+    }
+    return self;
+}
+
+-(NSUInteger) count{
+    return (NSUInteger) _header->numRecords;
+}
+
+-(NSUInteger) textLength{
+    return (NSUInteger) _header->textLength;
+}
+
+-(NSIndexSet *) recordsIntersectingEnvelope: (SFGeometryEnvelope *) envelope{
+    NSMutableIndexSet *records = [NSMutableIndexSet indexSet];
+    [self queryEnvelope:envelope withBlock:^(const SFWTSpatialRecord *record){
+        [records addIndex:(NSUInteger) record->record];
+    }];
+    return records;
+}
+
+-(NSRange) rangeOfRecord: (NSUInteger) record{
+    @synchronized(self){
+        if(_recordIndexes == nil){
+            NSMutableDictionary<NSNumber *, NSNumber *> *recordIndexes = [NSMutableDictionary dictionaryWithCapacity:(NSUInteger) _header->numRecords];
+            for(uint64_t i = 0; i < _header->numRecords; i++){
+                [recordIndexes setObject:[NSNumber numberWithUnsignedLongLong:i] forKey:[NSNumber numberWithUnsignedLongLong:_records[i].record]];
+            }
+            _recordIndexes = recordIndexes;
+        }
+    }
+    NSRange range = NSMakeRange(NSNotFound, 0);
+    NSNumber *index = [_recordIndexes objectForKey:[NSNumber numberWithUnsignedInteger:record]];
+    if(index != nil){
+        const SFWTSpatialRecord *indexed = &_records[[index unsignedLongLongValue]];
+        range = NSMakeRange((NSUInteger) indexed->location, (NSUInteger) indexed->length);
+    }
+    return range;
+}
+
+-(NSArray<SFGeometry *> *) geometriesIntersectingEnvelope: (SFGeometryEnvelope *) envelope inText: (NSString *) text{
+
+    if([text length] != _header->textLength){
+        [NSException raise:@"Invalid Text" format:@"Text length %lu does not match the indexed text length %llu", (unsigned long)[text length], _header->textLength];
+    }
+
+    NSMutableArray<NSValue *> *matches = [NSMutableArray array];
+    [self queryEnvelope:envelope withBlock:^(const SFWTSpatialRecord *record){
+        [matches addObject:[NSValue valueWithPointer:record]];
+    }];
+    [matches sortUsingComparator:^NSComparisonResult(NSValue *first, NSValue *second){
+        uint64_t firstRecord = ((const SFWTSpatialRecord *)[first pointerValue])->record;
+        uint64_t secondRecord = ((const SFWTSpatialRecord *)[second pointerValue])->record;
+        return firstRecord < secondRecord ? NSOrderedAscending : (firstRecord > secondRecord ? NSOrderedDescending : NSOrderedSame);
+    }];
+
+    NSMutableArray<SFGeometry *> *geometries = [NSMutableArray arrayWithCapacity:matches.count];
+    for(NSValue *match in matches){
+        const SFWTSpatialRecord *record = [match pointerValue];
+        NSString *recordText = [text substringWithRange:NSMakeRange((NSUInteger) record->location, (NSUInteger) record->length)];
+        SFGeometry *geometry = [SFWTGeometryReader readGeometryWithText:recordText];
+        if(geometry != nil){
+            [geometries addObject:geometry];
+        }
+    }
+
+    return geometries;
+}
+
+-(BOOL) writeToFile: (NSString *) path error: (NSError **) error{
+    return [_data writeToFile:path options:NSDataWritingAtomic error:error];
+}
+
+/**
+ * Scan the text and build the packed tree
+ *
+ * @param text
+ *            well-known text geometries
+ * @param nodeCapacity
+ *            max children per node
+ */
+-(void) buildWithText: (NSString *) text andNodeCapacity: (uint32_t) nodeCapacity{
+
+    SFTextReader *textReader = [SFWTIndexedTextReader readerWithText:text];
+    if(![textReader isKindOfClass:[SFWTIndexedTextReader class]]){
+        [NSException raise:@"Invalid Text" format:@"Spatial index requires ASCII well-known text"];
+    }
+    SFWTIndexedTextReader *reader = (SFWTIndexedTextReader *) textReader;
+    SFWTStructuralIndex *structuralIndex = [reader index];
+    SFWTGeometryReader *geometryReader = [[SFWTGeometryReader alloc] initWithReader:reader];
+
+    NSUInteger capacity = 1024;
+    NSUInteger count = 0;
+    SFWTSpatialRecord *records = malloc(capacity * sizeof(SFWTSpatialRecord));
+    SFWTSpatialNode *nodes = NULL;
+
+    @try{
+
+        uint64_t recordNumber = 0;
+        while([reader peekCharacter] != 0){
+            NSUInteger location = [structuralIndex positionAtIndex:[reader position]];
+            double bounds[4];
+            BOOL indexed = [geometryReader readBounds:bounds];
+            if(indexed){
+                if(count == capacity){
+                    capacity *= 2;
+                    records = reallocf(records, capacity * sizeof(SFWTSpatialRecord));
+                }
+                NSUInteger next = [reader position];
+                NSUInteger end = next < [structuralIndex count] ? [structuralIndex positionAtIndex:next] : [structuralIndex length];
+                SFWTSpatialRecord *record = &records[count++];
+                memcpy(record->bounds, bounds, sizeof(bounds));
+                record->location = location;
+                record->length = end - location;
+                record->record = recordNumber;
+            }
+            recordNumber++;
+        }
+
+        // Pack the tree levels bottom up, the root is the last node
+        NSUInteger nodeCount = 0;
+        nodes = malloc((count + 64) * sizeof(SFWTSpatialNode));
+        if(count > 0){
+            void *items = records;
+            size_t itemSize = sizeof(SFWTSpatialRecord);
+            NSUInteger itemCount = count;
+            NSUInteger itemStart = 0;
+            BOOL leaf = YES;
+            while(YES){
+                sfwt_str_sort(items, itemCount, itemSize, nodeCapacity);
+                NSUInteger levelStart = nodeCount;
+                for(NSUInteger i = 0; i < itemCount; i += nodeCapacity){
+                    SFWTSpatialNode *node = &nodes[nodeCount++];
+                    node->first = (uint32_t) (itemStart + i);
+                    node->count = (uint32_t) MIN(nodeCapacity, itemCount - i);
+                    node->leaf = leaf;
+                    node->reserved = 0;
+                    node->bounds[0] = INFINITY;
+                    node->bounds[1] = INFINITY;
+                    node->bounds[2] = -INFINITY;
+                    node->bounds[3] = -INFINITY;
+                    for(uint32_t j = 0; j < node->count; j++){
+                        const double *bounds = (const double *) ((uint8_t *) items + (i + j) * itemSize);
+                        node->bounds[0] = MIN(node->bounds[0], bounds[0]);
+                        node->bounds[1] = MIN(node->bounds[1], bounds[1]);
+                        node->bounds[2] = MAX(node->bounds[2], bounds[2]);
+                        node->bounds[3] = MAX(node->bounds[3], bounds[3]);
+                    }
+                }
+                if(nodeCount - levelStart == 1){
+                    break;
+                }
+                items = &nodes[levelStart];
+                itemSize = sizeof(SFWTSpatialNode);
+                itemCount = nodeCount - levelStart;
+                itemStart = levelStart;
+                leaf = NO;
+            }
+        }
+
+        SFWTSpatialHeader header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.byteOrderMark = BYTE_ORDER_MARK;
+        header.nodeCapacity = nodeCapacity;
+        header.numRecords = count;
+        header.numNodes = nodeCount;
+        header.textLength = [text length];
+
+        NSMutableData *data = [NSMutableData dataWithCapacity:sizeof(header) + count * sizeof(SFWTSpatialRecord) + nodeCount * sizeof(SFWTSpatialNode)];
+        [data appendBytes:&header length:sizeof(header)];
+        [data appendBytes:records length:count * sizeof(SFWTSpatialRecord)];
+        [data appendBytes:nodes length:nodeCount * sizeof(SFWTSpatialNode)];
+        [self loadData:data];
+
+    }@finally{
+        free(records);
+        free(nodes);
+    }
+
+}
+
+/**
+ * Load and verify index data
+ *
+ * @param data
+ *            index data
+ */
+-(void) loadData: (NSData *) data{
+
+    _data = data;
+    const uint8_t *bytes = [data bytes];
+    NSUInteger length = [data length];
+
+    if(length < sizeof(SFWTSpatialHeader)){
+        [self invalid:@"Data is smaller than the header"];
+    }
+    _header = (const SFWTSpatialHeader *) bytes;
+    if(memcmp(_header->magic, MAGIC, sizeof(MAGIC)) != 0 || _header->version != VERSION){
+        [self invalid:@"Not a supported spatial index"];
+    }
+    if(_header->byteOrderMark != BYTE_ORDER_MARK){
+        [self invalid:@"Index was written with a different byte order"];
+    }
+    uint64_t available = length - sizeof(SFWTSpatialHeader);
+    if(_header->numRecords > available / sizeof(SFWTSpatialRecord)
+       || _header->numNodes > (available - _header->numRecords * sizeof(SFWTSpatialRecord)) / sizeof(SFWTSpatialNode)
+       || (_header->numRecords > 0) != (_header->numNodes > 0)){
+        [self invalid:@"Sections are out of bounds"];
+    }
+
+    _records = (const SFWTSpatialRecord *) (bytes + sizeof(SFWTSpatialHeader));
+    _nodes = (const SFWTSpatialNode *) (_records + _header->numRecords);
+
+    // Children must precede their parents, which also bounds the traversal
+    for(uint64_t i = 0; i < _header->numNodes; i++){
+        const SFWTSpatialNode *node = &_nodes[i];
+        uint64_t limit = node->leaf ? _header->numRecords : i;
+        if((uint64_t) node->first + node->count > limit){
+            [self invalid:@"Node children are out of bounds"];
+        }
+    }
+    for(uint64_t i = 0; i < _header->numRecords; i++){
+        const SFWTSpatialRecord *record = &_records[i];
+        if(record->location > _header->textLength || record->length > _header->textLength - record->location){
+            [self invalid:@"Record range is out of bounds"];
+        }
+    }
+
+    _recordIndexes = nil;
+}
+
+/**
+ * Visit the records whose bounds intersect the envelope
+ *
+ * @param envelope
+ *            query envelope
+ * @param block
+ *            record block
+ */
+-(void) queryEnvelope: (SFGeometryEnvelope *) envelope withBlock: (void (^)(const SFWTSpatialRecord *record)) block{
+
+    if(_header->numNodes == 0){
+        return;
+    }
+
+    double window[4];
+    window[0] = [envelope.minX doubleValue];
+    window[1] = [envelope.minY doubleValue];
+    window[2] = [envelope.maxX doubleValue];
+    window[3] = [envelope.maxY doubleValue];
+
+    NSUInteger capacity = 64;
+    NSUInteger size = 0;
+    uint64_t *stack = malloc(capacity * sizeof(uint64_t));
+    stack[size++] = _header->numNodes - 1;
+
+    while(size > 0){
+        const SFWTSpatialNode *node = &_nodes[stack[--size]];
+        if(!sfwt_intersects(node->bounds, window)){
+            continue;
+        }
+        for(uint32_t i = 0; i < node->count; i++){
+            uint64_t child = (uint64_t) node->first + i;
+            if(node->leaf){
+                const SFWTSpatialRecord *record = &_records[child];
+                if(sfwt_intersects(record->bounds, window)){
+                    block(record);
+                }
+            }else{
+                if(size == capacity){
+                    capacity *= 2;
+                    stack = reallocf(stack, capacity * sizeof(uint64_t));
+                }
+                stack[size++] = child;
+            }
+        }
+    }
+
+    free(stack);
+}
+
+/**
+ * Raise an invalid index exception
+ *
+ * @param reason
+ *            reason
+ */
+-(void) invalid: (NSString *) reason{
+    [NSException raise:@"Invalid Spatial Index" format:@"%@", reason];
+}
+
+@end
@@ -0,0 +1,434 @@
+//
+//  SFWTStructuralIndex.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTStructuralIndex.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SFWT_SCAN_X86 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define SFWT_SCAN_NEON 1
+#endif
+
+/**
+ * Bytes classified per block
+ */
+#define SFWT_BLOCK_SIZE 64
+
+/**
+ * Byte character classes
+ */
+#define SFWT_CLASS_WHITESPACE 0x1
+#define SFWT_CLASS_WORD 0x2
+
+/**
+ * Block classification masks, one bit per byte
+ */
+typedef struct {
+    uint64_t whitespace;
+    uint64_t word;
+    uint64_t high;
+} SFWTBlockMasks;
+
+/**
+ * Block classifier function
+ */
+typedef void (*SFWTClassifier)(const uint8_t *block, SFWTBlockMasks *masks);
+
+/**
+ * Scalar byte classes
+ */
+static uint8_t sfwt_classes[256];
+
+static void sfwt_init_classes(void){
+    for(int c = 0; c < 256; c++){
+        uint8_t value = 0;
+        if(c == ' ' || (c >= '\t' && c <= '\r')){
+            value = SFWT_CLASS_WHITESPACE;
+        }else if((c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')
+                 || c == '-' || c == '.' || c == '+'){
+            value = SFWT_CLASS_WORD;
+        }
+        sfwt_classes[c] = value;
+    }
+}
+
+#if !defined(SFWT_SCAN_X86) && !defined(SFWT_SCAN_NEON)
+
+static void sfwt_classify_scalar(const uint8_t *block, SFWTBlockMasks *masks){
+    uint64_t whitespace = 0;
+    uint64_t word = 0;
+    uint64_t high = 0;
+    for(int i = 0; i < SFWT_BLOCK_SIZE; i++){
+        uint8_t c = block[i];
+        uint8_t value = sfwt_classes[c];
+        whitespace |= (uint64_t)(value & SFWT_CLASS_WHITESPACE) << i;
+        word |= (uint64_t)((value & SFWT_CLASS_WORD) >> 1) << i;
+        high |= (uint64_t)(c >> 7) << i;
+    }
+    masks->whitespace = whitespace;
+    masks->word = word;
+    masks->high = high;
+}
+
+#endif
+
+#if defined(SFWT_SCAN_X86)
+
+/**
+ * Classify 16 bytes, ASCII only comparisons are signed so high bytes are
+ * never whitespace or word characters
+ */
+static inline void sfwt_classify_sse2_16(__m128i c, uint32_t *whitespace, uint32_t *word, uint32_t *high){
+    __m128i space = _mm_cmpeq_epi8(c, _mm_set1_epi8(' '));
+    __m128i control = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('\t' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('\r' + 1)));
+    __m128i lower = _mm_or_si128(c, _mm_set1_epi8(0x20));
+    __m128i alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(lower, _mm_set1_epi8('z' + 1)));
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+    __m128i sign = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(c, _mm_set1_epi8('-')), _mm_cmpeq_epi8(c, _mm_set1_epi8('+'))), _mm_cmpeq_epi8(c, _mm_set1_epi8('.')));
+    *whitespace = (uint32_t)_mm_movemask_epi8(_mm_or_si128(space, control));
+    *word = (uint32_t)_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(alpha, digit), sign));
+    *high = (uint32_t)_mm_movemask_epi8(c);
+}
+
+static void sfwt_classify_sse2(const uint8_t *block, SFWTBlockMasks *masks){
+    uint64_t whitespace = 0;
+    uint64_t word = 0;
+    uint64_t high = 0;
+    for(int i = 0; i < SFWT_BLOCK_SIZE; i += 16){
+        uint32_t w, d, h;
+        sfwt_classify_sse2_16(_mm_loadu_si128((const __m128i *)(block + i)), &w, &d, &h);
+        whitespace |= (uint64_t)w << i;
+        word |= (uint64_t)d << i;
+        high |= (uint64_t)h << i;
+    }
+    masks->whitespace = whitespace;
+    masks->word = word;
+    masks->high = high;
+}
+
+__attribute__((target("avx2")))
+static void sfwt_classify_avx2(const uint8_t *block, SFWTBlockMasks *masks){
+    uint64_t whitespace = 0;
+    uint64_t word = 0;
+    uint64_t high = 0;
+    for(int i = 0; i < SFWT_BLOCK_SIZE; i += 32){
+        __m256i c = _mm256_loadu_si256((const __m256i *)(block + i));
+        __m256i space = _mm256_cmpeq_epi8(c, _mm256_set1_epi8(' '));
+        __m256i control = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('\t' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('\r' + 1), c));
+        __m256i lower = _mm256_or_si256(c, _mm256_set1_epi8(0x20));
+        __m256i alpha = _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+        __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), c));
+        __m256i sign = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(c, _mm256_set1_epi8('-')), _mm256_cmpeq_epi8(c, _mm256_set1_epi8('+'))), _mm256_cmpeq_epi8(c, _mm256_set1_epi8('.')));
+        whitespace |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_or_si256(space, control)) << i;
+        word |= (uint64_t)(uint32_t)_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(alpha, digit), sign)) << i;
+        high |= (uint64_t)(uint32_t)_mm256_movemask_epi8(c) << i;
+    }
+    masks->whitespace = whitespace;
+    masks->word = word;
+    masks->high = high;
+}
+
+#elif defined(SFWT_SCAN_NEON)
+
+/**
+ * Collapse a 16 byte comparison result to a 16 bit mask
+ */
+static inline uint32_t sfwt_neon_movemask(uint8x16_t value){
+    static const uint8_t weights[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+    uint8x16_t masked = vandq_u8(value, vld1q_u8(weights));
+    return (uint32_t)vaddv_u8(vget_low_u8(masked)) | ((uint32_t)vaddv_u8(vget_high_u8(masked)) << 8);
+}
+
+static void sfwt_classify_neon(const uint8_t *block, SFWTBlockMasks *masks){
+    uint64_t whitespace = 0;
+    uint64_t word = 0;
+    uint64_t high = 0;
+    for(int i = 0; i < SFWT_BLOCK_SIZE; i += 16){
+        uint8x16_t c = vld1q_u8(block + i);
+        uint8x16_t space = vorrq_u8(vceqq_u8(c, vdupq_n_u8(' ')), vcleq_u8(vsubq_u8(c, vdupq_n_u8('\t')), vdupq_n_u8('\r' - '\t')));
+        uint8x16_t alpha = vcleq_u8(vsubq_u8(vorrq_u8(c, vdupq_n_u8(0x20)), vdupq_n_u8('a')), vdupq_n_u8('z' - 'a'));
+        uint8x16_t digit = vcleq_u8(vsubq_u8(c, vdupq_n_u8('0')), vdupq_n_u8('9' - '0'));
+        uint8x16_t sign = vorrq_u8(vorrq_u8(vceqq_u8(c, vdupq_n_u8('-')), vceqq_u8(c, vdupq_n_u8('+'))), vceqq_u8(c, vdupq_n_u8('.')));
+        whitespace |= (uint64_t)sfwt_neon_movemask(space) << i;
+        word |= (uint64_t)sfwt_neon_movemask(vorrq_u8(vorrq_u8(alpha, digit), sign)) << i;
+        high |= (uint64_t)sfwt_neon_movemask(vcgeq_u8(c, vdupq_n_u8(0x80))) << i;
+    }
+    masks->whitespace = whitespace;
+    masks->word = word;
+    masks->high = high;
+}
+
+#endif
+
+/**
+ * Classifier in use
+ */
+static SFWTClassifier sfwt_classifier = NULL;
+
+/**
+ * Classifier implementation name
+ */
+static NSString *sfwt_implementation = nil;
+
+static void sfwt_init_classifier(void){
+    static dispatch_once_t once;
+    dispatch_once(&once, ^{
+        sfwt_init_classes();
+#if defined(SFWT_SCAN_X86)
+        if(__builtin_cpu_supports("avx2")){
+            sfwt_classifier = sfwt_classify_avx2;
+            sfwt_implementation = @"AVX2";
+        }else{
+            sfwt_classifier = sfwt_classify_sse2;
+            sfwt_implementation = @"SSE2";
+        }
+#elif defined(SFWT_SCAN_NEON)
+        sfwt_classifier = sfwt_classify_neon;
+        sfwt_implementation = @"NEON";
+#else
+        sfwt_classifier = sfwt_classify_scalar;
+        sfwt_implementation = @"Scalar";
+#endif
+    });
+}
+
+/**
+ * Index the structural positions of the bytes
+ *
+ * @param bytes
+ *            bytes
+ * @param length
+ *            byte length
+ * @param positions
+ *            positions array, reallocated as needed
+ * @param capacity
+ *            positions capacity
+ * @param high
+ *            set when a non ASCII byte is found
+ *
+ * @return position count
+ */
+static NSUInteger sfwt_index(const uint8_t *bytes, NSUInteger length, uint32_t **positions, NSUInteger *capacity, BOOL *high){
+
+    SFWTClassifier classify = sfwt_classifier;
+    uint32_t *output = *positions;
+    NSUInteger count = 0;
+    uint64_t previousWord = 0;
+    uint64_t highBits = 0;
+    uint8_t padded[SFWT_BLOCK_SIZE];
+
+    for(NSUInteger offset = 0; offset < length; offset += SFWT_BLOCK_SIZE){
+
+        const uint8_t *block = bytes + offset;
+        NSUInteger remaining = length - offset;
+        if(remaining < SFWT_BLOCK_SIZE){
+            memset(padded, ' ', SFWT_BLOCK_SIZE);
+            memcpy(padded, block, remaining);
+            block = padded;
+        }
+
+        SFWTBlockMasks masks;
+        classify(block, &masks);
+        highBits |= masks.high;
+
+        // Token starts are punctuation characters and word characters not
+        // preceded by a word character
+        uint64_t wordStart = masks.word & ~((masks.word << 1) | previousWord);
+        uint64_t structural = (~masks.whitespace & ~masks.word) | wordStart;
+        previousWord = masks.word >> 63;
+
+        if(count + SFWT_BLOCK_SIZE > *capacity){
+            *capacity = MAX(*capacity * 2, count + SFWT_BLOCK_SIZE);
+            output = reallocf(output, *capacity * sizeof(uint32_t));
+            if(output == NULL){
+                [NSException raise:NSMallocException format:@"Failed to allocate structural index of %lu positions", (unsigned long)*capacity];
+            }
+            *positions = output;
+        }
+
+        while(structural != 0){
+            output[count++] = (uint32_t)(offset + __builtin_ctzll(structural));
+            structural &= structural - 1;
+        }
+
+    }
+
+    *high = highBits != 0;
+
+    return count;
+}
+
+/**
+ * Determine if a token first character starts a number
+ *
+ * @param c
+ *            character
+ * @return true if a number
+ */
+static inline BOOL sfwt_is_number_start(uint8_t c){
+    return (c >= '0' && c <= '9') || c == '-' || c == '+' || c == '.'
+        || c == 'n' || c == 'N' || c == 'i' || c == 'I';
+}
+
+@interface SFWTStructuralIndex()
+
+/**
+ * Indexed UTF-8 bytes, retained and not copied
+ */
+@property (nonatomic, strong) NSData *data;
+
+@end
+
+@implementation SFWTStructuralIndex{
+    const uint8_t *_bytes;
+    NSUInteger _length;
+    uint32_t *_positions;
+    NSUInteger _count;
+    BOOL _ascii;
+}
+
+-(instancetype) initWithText: (NSString *) text{
+    return [self initWithData:[text dataUsingEncoding:NSUTF8StringEncoding]];
+}
+
+-(instancetype) initWithData: (NSData *) data{
+    self = [super init];
+    if(self != nil){
+
+        sfwt_init_classifier();
+
+        NSUInteger length = [data length];
+        if(length > UINT32_MAX){
+            [NSException raise:@"Unsupported Length" format:@"Text of %lu bytes exceeds the structural index limit", (unsigned long)length];
+        }
+
+        _data = data;
+        _bytes = [data bytes];
+        _length = length;
+
+        NSUInteger capacity = length / 4 + SFWT_BLOCK_SIZE;
+        _positions = malloc(capacity * sizeof(uint32_t));
+        BOOL high = NO;
+        _count = sfwt_index(_bytes, _length, &_positions, &capacity, &high);
+        _ascii = !high;
+    }
+    return self;
+}
+
+-(void) dealloc{
+    free(_positions);
+}
+
+-(const uint8_t *) bytes{
+    return _bytes;
+}
+
+-(NSUInteger) length{
+    return _length;
+}
+
+-(BOOL) isASCII{
+    return _ascii;
+}
+
+-(NSUInteger) count{
+    return _count;
+}
+
+-(const uint32_t *) positions{
+    return _positions;
+}
+
+-(NSUInteger) positionAtIndex: (NSUInteger) index{
+    return _positions[index];
+}
+
+-(uint8_t) characterAtIndex: (NSUInteger) index{
+    return _bytes[_positions[index]];
+}
+
+-(NSUInteger) closingIndexOf: (NSUInteger) index{
+    int open = 0;
+    for(NSUInteger i = index; i < _count; i++){
+        uint8_t c = _bytes[_positions[i]];
+        if(c == '('){
+            open++;
+        }else if(c == ')'){
+            if(--open == 0){
+                return i;
+            }
+        }
+    }
+    return NSNotFound;
+}
+
+-(int) countMembersAtIndex: (NSUInteger) index{
+    int commas = 0;
+    int open = 0;
+    BOOL empty = YES;
+    for(NSUInteger i = index; i < _count; i++){
+        uint8_t c = _bytes[_positions[i]];
+        if(c == '('){
+            if(open > 0){
+                empty = NO;
+            }
+            open++;
+        }else if(c == ')'){
+            if(--open == 0){
+                break;
+            }
+        }else{
+            if(c == ',' && open == 1){
+                commas++;
+            }
+            empty = NO;
+        }
+    }
+    return empty ? 0 : commas + 1;
+}
+
+-(int) countCoordinatesAtIndex: (NSUInteger) index{
+    int coordinates = 0;
+    int open = 0;
+    int group = 0;
+    BOOL innermost = NO;
+    BOOL numbers = NO;
+    for(NSUInteger i = index; i < _count; i++){
+        uint8_t c = _bytes[_positions[i]];
+        if(c == '('){
+            open++;
+            innermost = YES;
+            numbers = NO;
+            group = 1;
+        }else if(c == ')'){
+            if(innermost && numbers){
+                coordinates += group;
+            }
+            innermost = NO;
+            if(--open == 0){
+                break;
+            }
+        }else if(c == ','){
+            if(innermost){
+                group++;
+            }
+        }else if(innermost && sfwt_is_number_start(c)){
+            numbers = YES;
+        }
+    }
+    return coordinates;
+}
+
++(NSString *) implementation{
+    sfwt_init_classifier();
+    return sfwt_implementation;
+}
+
+@end
@@ -0,0 +1,295 @@
+//
+//  SFWTTWKBTextWriter.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTTWKBTextWriter.h>
+#import <SimpleFeaturesWKT/SFWTGeometryWriter.h>
+
+/**
+ * Max collection nesting
+ */
+#define SFWT_TWKB_MAX_DEPTH 1000
+
+/**
+ * Geometry type names as written, indexed by TWKB code
+ */
+static const char *sfwt_twkb_names[] = {NULL, "POINT", "LINESTRING", "POLYGON", "MULTIPOINT", "MULTILINESTRING", "MULTIPOLYGON", "GEOMETRYCOLLECTION"};
+
+/**
+ * TWKB input
+ */
+typedef struct {
+    const uint8_t *bytes;
+    NSUInteger length;
+    NSUInteger offset;
+} SFWTTWKBInput;
+
+/**
+ * TWKB geometry header and coordinate delta state
+ */
+typedef struct {
+    int code;
+    BOOL empty;
+    BOOL idList;
+    int dimensions;
+    BOOL hasZ;
+    BOOL hasM;
+    int precisions[4];
+    int64_t previous[4];
+} SFWTTWKBHeader;
+
+static void sfwt_twkb_invalid(SFWTTWKBInput *input){
+    [NSException raise:@"Invalid TWKB" format:@"Unexpected end of TWKB at offset %lu of %lu", (unsigned long)input->offset, (unsigned long)input->length];
+}
+
+static uint8_t sfwt_twkb_read_byte(SFWTTWKBInput *input){
+    if(input->offset >= input->length){
+        sfwt_twkb_invalid(input);
+    }
+    return input->bytes[input->offset++];
+}
+
+static uint64_t sfwt_twkb_read_varint(SFWTTWKBInput *input){
+    uint64_t value = 0;
+    for(int shift = 0; shift < 64; shift += 7){
+        uint8_t byte = sfwt_twkb_read_byte(input);
+        value |= (uint64_t) (byte & 0x7F) << shift;
+        if((byte & 0x80) == 0){
+            return value;
+        }
+    }
+    [NSException raise:@"Invalid TWKB" format:@"Varint exceeds 64 bits at offset %lu", (unsigned long)input->offset];
+    return 0;
+}
+
+static int64_t sfwt_twkb_read_signed_varint(SFWTTWKBInput *input){
+    uint64_t value = sfwt_twkb_read_varint(input);
+    return (int64_t) (value >> 1) ^ -(int64_t) (value & 1);
+}
+
+static uint32_t sfwt_twkb_read_count(SFWTTWKBInput *input){
+    uint64_t count = sfwt_twkb_read_varint(input);
+    if(count > input->length - input->offset){
+        // Each member takes at least one byte
+        [NSException raise:@"Invalid TWKB" format:@"TWKB count of %llu exceeds the remaining bytes", (unsigned long long)count];
+    }
+    return (uint32_t) count;
+}
+
+static SFWTTWKBHeader sfwt_twkb_read_header(SFWTTWKBInput *input){
+
+    SFWTTWKBHeader header;
+    memset(&header, 0, sizeof(header));
+
+    uint8_t typePrecision = sfwt_twkb_read_byte(input);
+    header.code = typePrecision & 0x0F;
+    if(header.code < 1 || header.code > 7){
+        [NSException raise:@"Geometry Not Supported" format:@"TWKB geometry type not supported: %d", header.code];
+    }
+    uint8_t zigzag = typePrecision >> 4;
+    int precision = (zigzag >> 1) ^ -(zigzag & 1);
+
+    uint8_t metadata = sfwt_twkb_read_byte(input);
+    BOOL boundingBox = (metadata & 0x01) != 0;
+    BOOL size = (metadata & 0x02) != 0;
+    header.idList = (metadata & 0x04) != 0;
+    header.empty = (metadata & 0x10) != 0;
+
+    int precisionZ = 0;
+    int precisionM = 0;
+    if((metadata & 0x08) != 0){
+        uint8_t extended = sfwt_twkb_read_byte(input);
+        header.hasZ = (extended & 0x01) != 0;
+        header.hasM = (extended & 0x02) != 0;
+        precisionZ = (extended >> 2) & 0x07;
+        precisionM = (extended >> 5) & 0x07;
+    }
+    header.dimensions = 2 + (header.hasZ ? 1 : 0) + (header.hasM ? 1 : 0);
+    header.precisions[0] = precision;
+    header.precisions[1] = precision;
+    header.precisions[2] = precisionZ;
+    header.precisions[3] = precisionM;
+
+    if(size){
+        sfwt_twkb_read_varint(input);
+    }
+    if(boundingBox && !header.empty){
+        for(int i = 0; i < 2 * header.dimensions; i++){
+            sfwt_twkb_read_signed_varint(input);
+        }
+    }
+
+    return header;
+}
+
+static void sfwt_twkb_append(NSMutableData *output, const char *text, NSUInteger length){
+    [output appendBytes:text length:length];
+}
+
+static void sfwt_twkb_write_value(NSMutableData *output, int64_t quantized, int precision){
+    // Dividing by an exact power of ten matches the parsed decimal value
+    double value = precision >= 0 ? quantized / pow(10.0, precision) : quantized * pow(10.0, -precision);
+    char buffer[SFWT_VALUE_BUFFER_SIZE];
+    int length = [SFWTGeometryWriter formatValue:value toBuffer:buffer];
+    sfwt_twkb_append(output, buffer, length);
+}
+
+static void sfwt_twkb_write_point(NSMutableData *output, SFWTTWKBInput *input, SFWTTWKBHeader *header){
+    int ordinates[4] = {0, 1, 2, 3};
+    if(!header->hasZ){
+        ordinates[2] = 3;
+    }
+    for(int i = 0; i < header->dimensions; i++){
+        if(i > 0){
+            sfwt_twkb_append(output, " ", 1);
+        }
+        int ordinate = ordinates[i];
+        header->previous[ordinate] += sfwt_twkb_read_signed_varint(input);
+        sfwt_twkb_write_value(output, header->previous[ordinate], header->precisions[ordinate]);
+    }
+}
+
+static void sfwt_twkb_write_points(NSMutableData *output, SFWTTWKBInput *input, SFWTTWKBHeader *header, BOOL wrapped){
+    uint32_t numPoints = sfwt_twkb_read_count(input);
+    if(numPoints == 0){
+        sfwt_twkb_append(output, "EMPTY", 5);
+    }else{
+        if(wrapped && header->idList){
+            for(uint32_t i = 0; i < numPoints; i++){
+                sfwt_twkb_read_signed_varint(input);
+            }
+        }
+        sfwt_twkb_append(output, "(", 1);
+        for(uint32_t i = 0; i < numPoints; i++){
+            if(i > 0){
+                sfwt_twkb_append(output, ", ", 2);
+            }
+            if(wrapped){
+                sfwt_twkb_append(output, "(", 1);
+            }
+            sfwt_twkb_write_point(output, input, header);
+            if(wrapped){
+                sfwt_twkb_append(output, ")", 1);
+            }
+        }
+        sfwt_twkb_append(output, ")", 1);
+    }
+}
+
+static void sfwt_twkb_write_polygon(NSMutableData *output, SFWTTWKBInput *input, SFWTTWKBHeader *header){
+    uint32_t numRings = sfwt_twkb_read_count(input);
+    if(numRings == 0){
+        sfwt_twkb_append(output, "EMPTY", 5);
+    }else{
+        sfwt_twkb_append(output, "(", 1);
+        for(uint32_t i = 0; i < numRings; i++){
+            if(i > 0){
+                sfwt_twkb_append(output, ", ", 2);
+            }
+            sfwt_twkb_write_points(output, input, header, NO);
+        }
+        sfwt_twkb_append(output, ")", 1);
+    }
+}
+
+static void sfwt_twkb_write_geometry(NSMutableData *output, SFWTTWKBInput *input, int depth){
+
+    if(depth > SFWT_TWKB_MAX_DEPTH){
+        [NSException raise:@"Invalid TWKB" format:@"TWKB geometry nesting exceeds %d", SFWT_TWKB_MAX_DEPTH];
+    }
+
+    SFWTTWKBHeader header = sfwt_twkb_read_header(input);
+
+    const char *name = sfwt_twkb_names[header.code];
+    sfwt_twkb_append(output, name, strlen(name));
+    sfwt_twkb_append(output, " ", 1);
+    if(header.hasZ || header.hasM){
+        if(header.hasZ){
+            sfwt_twkb_append(output, "Z", 1);
+        }
+        if(header.hasM){
+            sfwt_twkb_append(output, "M", 1);
+        }
+        sfwt_twkb_append(output, " ", 1);
+    }
+
+    if(header.empty){
+        sfwt_twkb_append(output, "EMPTY", 5);
+        return;
+    }
+
+    switch(header.code){
+        case 1:
+            sfwt_twkb_append(output, "(", 1);
+            sfwt_twkb_write_point(output, input, &header);
+            sfwt_twkb_append(output, ")", 1);
+            break;
+        case 2:
+            sfwt_twkb_write_points(output, input, &header, NO);
+            break;
+        case 3:
+            sfwt_twkb_write_polygon(output, input, &header);
+            break;
+        case 4:
+            sfwt_twkb_write_points(output, input, &header, YES);
+            break;
+        default:
+            {
+                uint32_t count = sfwt_twkb_read_count(input);
+                if(count == 0){
+                    sfwt_twkb_append(output, "EMPTY", 5);
+                    break;
+                }
+                if(header.idList){
+                    for(uint32_t i = 0; i < count; i++){
+                        sfwt_twkb_read_signed_varint(input);
+                    }
+                }
+                sfwt_twkb_append(output, "(", 1);
+                for(uint32_t i = 0; i < count; i++){
+                    if(i > 0){
+                        sfwt_twkb_append(output, ", ", 2);
+                    }
+                    switch(header.code){
+                        case 5:
+                            sfwt_twkb_write_points(output, input, &header, NO);
+                            break;
+                        case 6:
+                            sfwt_twkb_write_polygon(output, input, &header);
+                            break;
+                        default:
+                            sfwt_twkb_write_geometry(output, input, depth + 1);
+                            break;
+                    }
+                }
+                sfwt_twkb_append(output, ")", 1);
+            }
+            break;
+    }
+
+}
+
+@implementation SFWTTWKBTextWriter
+
++(NSString *) textWithTWKB: (NSData *) twkb{
+    NSMutableString *text = [NSMutableString string];
+    [self writeTWKB:twkb toString:text];
+    return text;
+}
+
++(void) writeTWKB: (NSData *) twkb toString: (NSMutableString *) string{
+    SFWTTWKBInput input;
+    input.bytes = [twkb bytes];
+    input.length = [twkb length];
+    input.offset = 0;
+    NSMutableData *output = [NSMutableData dataWithCapacity:4 * input.length];
+    sfwt_twkb_write_geometry(output, &input, 0);
+    NSString *text = [[NSString alloc] initWithData:output encoding:NSASCIIStringEncoding];
+    [string appendString:text];
+}
+
+@end
@@ -0,0 +1,336 @@
+//
+//  SFWTTWKBTranscoder.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTTWKBTranscoder.h>
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+
+int const SFWT_TWKB_DEFAULT_PRECISION = 6;
+
+/**
+ * Largest quantized magnitude, keeps zigzag deltas within 64 bits
+ */
+static double const MAX_QUANTIZED = 4611686018427387904.0;
+
+/**
+ * Open geometry being written
+ */
+typedef struct {
+    int code;
+    BOOL headered;
+    BOOL declaredZ;
+    BOOL declaredM;
+    NSUInteger offset;
+    int dimensions;
+    BOOL hasZ;
+    BOOL hasM;
+    int64_t previous[4];
+} SFWTTWKBFrame;
+
+/**
+ * Append an unsigned varint
+ */
+static NSUInteger sfwt_encode_varint(uint64_t value, uint8_t *buffer){
+    NSUInteger length = 0;
+    while(value >= 0x80){
+        buffer[length++] = (uint8_t) (value | 0x80);
+        value >>= 7;
+    }
+    buffer[length++] = (uint8_t) value;
+    return length;
+}
+
+static uint64_t sfwt_zigzag(int64_t value){
+    return ((uint64_t) value << 1) ^ (uint64_t) (value >> 63);
+}
+
+@interface SFWTTWKBTranscoder()
+
+/**
+ * Event reader
+ */
+@property (nonatomic, strong) SFWTEventReader *eventReader;
+
+@end
+
+@implementation SFWTTWKBTranscoder{
+    SFWTTWKBFrame *_frames;
+    int _capacity;
+    double _scales[4];
+}
+
++(NSData *) twkbWithText: (NSString *) text{
+    return [self twkbWithText:text andPrecision:SFWT_TWKB_DEFAULT_PRECISION];
+}
+
++(NSData *) twkbWithText: (NSString *) text andPrecision: (int) precision{
+    SFWTTWKBTranscoder *transcoder = [[SFWTTWKBTranscoder alloc] initWithText:text];
+    [transcoder setPrecision:precision];
+    return [transcoder write];
+}
+
+-(instancetype) initWithText: (NSString *) text{
+    return [self initWithReader:[SFWTIndexedTextReader readerWithText:text]];
+}
+
+-(instancetype) initWithReader: (SFTextReader *) reader{
+    self = [super init];
+    if(self != nil){
+        _eventReader = [[SFWTEventReader alloc] initWithReader:reader];
+        _precision = SFWT_TWKB_DEFAULT_PRECISION;
+        _precisionZ = 0;
+        _precisionM = 0;
+        _capacity = 8;
+        _frames = malloc(_capacity * sizeof(SFWTTWKBFrame));
+    }
+    return self;
+}
+
+-(void) dealloc{
+    free(_frames);
+}
+
+-(NSData *) write{
+    NSMutableData *data = [NSMutableData data];
+    return [self writeToData:data] ? data : nil;
+}
+
+-(BOOL) writeToData: (NSMutableData *) data{
+
+    if(_precision < -7 || _precision > 7 || _precisionZ < 0 || _precisionZ > 7 || _precisionM < 0 || _precisionM > 7){
+        [NSException raise:@"Invalid Precision" format:@"TWKB precision out of range. xy: %d, z: %d, m: %d", _precision, _precisionZ, _precisionM];
+    }
+    _scales[0] = pow(10.0, _precision);
+    _scales[1] = _scales[0];
+    _scales[2] = pow(10.0, _precisionZ);
+    _scales[3] = pow(10.0, _precisionM);
+
+    [_eventReader setLimits:_limits];
+
+    if([_eventReader next] == SFWT_EVENT_NONE){
+        return NO;
+    }
+
+    int size = 0;
+    int context = -1;
+
+    do{
+
+        switch([_eventReader eventType]){
+
+            case SFWT_EVENT_START_GEOMETRY:
+                {
+                    SFGeometryType geometryType = [_eventReader geometryType];
+                    int code = [SFWTTWKBTranscoder codeOfGeometryType:geometryType];
+                    SFWTTWKBFrame *parent = size > 0 ? &_frames[size - 1] : NULL;
+                    if(code == 0 || (parent != NULL && ![self isCode:code allowedInCode:parent->code])){
+                        [NSException raise:@"Unsupported Geometry" format:@"TWKB does not support geometry: %@", [SFGeometryTypes name:geometryType]];
+                    }
+                    if(size == _capacity){
+                        _capacity *= 2;
+                        _frames = reallocf(_frames, _capacity * sizeof(SFWTTWKBFrame));
+                    }
+                    SFWTTWKBFrame *frame = &_frames[size];
+                    frame->code = code;
+                    frame->headered = parent == NULL || parent->code == 7;
+                    frame->declaredZ = [_eventReader hasZ];
+                    frame->declaredM = [_eventReader hasM];
+                    frame->hasZ = frame->declaredZ;
+                    frame->hasM = frame->declaredM;
+                    frame->offset = [data length];
+                    frame->dimensions = 0;
+                    if(frame->headered){
+                        // Coordinate deltas restart in each TWKB geometry
+                        memset(frame->previous, 0, sizeof(frame->previous));
+                        context = size;
+                    }
+                    size++;
+                }
+                break;
+
+            case SFWT_EVENT_COORDINATE:
+                [self writeCoordinateInFrame:&_frames[context] toData:data];
+                break;
+
+            case SFWT_EVENT_END_GEOMETRY:
+                {
+                    SFWTTWKBFrame *frame = &_frames[--size];
+                    uint8_t buffer[13];
+                    NSUInteger length = 0;
+                    if(frame->headered){
+                        BOOL hasZ;
+                        BOOL hasM;
+                        if(frame->code == 7){
+                            hasZ = [_eventReader hasZ];
+                            hasM = [_eventReader hasM];
+                        }else{
+                            hasZ = frame->hasZ;
+                            hasM = frame->hasM;
+                        }
+                        buffer[length++] = (uint8_t) (frame->code | (sfwt_zigzag(_precision) << 4));
+                        if(hasZ || hasM){
+                            buffer[length++] = 0x08;
+                            buffer[length++] = (uint8_t) ((hasZ ? 0x01 : 0) | (hasM ? 0x02 : 0) | (_precisionZ << 2) | (_precisionM << 5));
+                        }else{
+                            buffer[length++] = 0;
+                        }
+                        // Restore the enclosing delta context
+                        context = -1;
+                        for(int i = size - 1; i >= 0; i--){
+                            if(_frames[i].headered){
+                                context = i;
+                                break;
+                            }
+                        }
+                    }
+                    if(frame->code != 1){
+                        length += sfwt_encode_varint([_eventReader count], buffer + length);
+                    }
+                    if(length > 0){
+                        [data replaceBytesInRange:NSMakeRange(frame->offset, 0) withBytes:buffer length:length];
+                    }
+                }
+                break;
+
+            default:
+                break;
+        }
+
+    } while(size > 0 && [_eventReader next] != SFWT_EVENT_NONE);
+
+    if(size > 0){
+        [NSException raise:@"Invalid Token" format:@"Unexpected end of text, %d geometries not closed", size];
+    }
+
+    return YES;
+}
+
+/**
+ * Write the current coordinate as deltas within the TWKB geometry
+ *
+ * @param frame
+ *            headered frame owning the coordinate deltas
+ * @param data
+ *            TWKB output
+ */
+-(void) writeCoordinateInFrame: (SFWTTWKBFrame *) frame toData: (NSMutableData *) data{
+
+    BOOL hasZ = [_eventReader hasZ];
+    BOOL hasM = [_eventReader hasM];
+
+    if(frame->dimensions == 0){
+        frame->hasZ = frame->declaredZ || hasZ;
+        frame->hasM = frame->declaredM || hasM;
+        frame->dimensions = 2 + (frame->hasZ ? 1 : 0) + (frame->hasM ? 1 : 0);
+    }
+    if(hasZ != frame->hasZ || hasM != frame->hasM){
+        [NSException raise:@"Invalid Geometry" format:@"TWKB geometry coordinates have inconsistent dimensions"];
+    }
+
+    double values[4];
+    int count = 0;
+    int ordinates[4];
+    values[count] = [_eventReader x];
+    ordinates[count++] = 0;
+    values[count] = [_eventReader y];
+    ordinates[count++] = 1;
+    if(hasZ){
+        values[count] = [_eventReader z];
+        ordinates[count++] = 2;
+    }
+    if(hasM){
+        values[count] = [_eventReader m];
+        ordinates[count++] = 3;
+    }
+
+    uint8_t buffer[40];
+    NSUInteger length = 0;
+    for(int i = 0; i < count; i++){
+        int ordinate = ordinates[i];
+        double scaled = round(values[i] * _scales[ordinate]);
+        if(!(fabs(scaled) < MAX_QUANTIZED)){
+            [NSException raise:@"Invalid Value" format:@"Coordinate value %f can not be quantized at the TWKB precision", values[i]];
+        }
+        int64_t quantized = (int64_t) scaled;
+        length += sfwt_encode_varint(sfwt_zigzag(quantized - frame->previous[ordinate]), buffer + length);
+        frame->previous[ordinate] = quantized;
+    }
+    [data appendBytes:buffer length:length];
+}
+
+/**
+ * Determine if a member TWKB code is valid within a containing TWKB code
+ *
+ * @param code
+ *            member code
+ * @param containingCode
+ *            containing code
+ *
+ * @return true if allowed
+ */
+-(BOOL) isCode: (int) code allowedInCode: (int) containingCode{
+    BOOL allowed;
+    switch(containingCode){
+        case 3:
+        case 5:
+            allowed = code == 2;
+            break;
+        case 4:
+            allowed = code == 1;
+            break;
+        case 6:
+            allowed = code == 3;
+            break;
+        case 7:
+            allowed = YES;
+            break;
+        default:
+            allowed = NO;
+            break;
+    }
+    return allowed;
+}
+
++(int) codeOfGeometryType: (SFGeometryType) geometryType{
+
+    int code = 0;
+
+    switch(geometryType){
+        case SF_POINT:
+            code = 1;
+            break;
+        case SF_LINESTRING:
+            code = 2;
+            break;
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+            code = 3;
+            break;
+        case SF_MULTIPOINT:
+            code = 4;
+            break;
+        case SF_MULTILINESTRING:
+        case SF_MULTICURVE:
+            code = 5;
+            break;
+        case SF_MULTIPOLYGON:
+        case SF_MULTISURFACE:
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            code = 6;
+            break;
+        case SF_GEOMETRYCOLLECTION:
+            code = 7;
+            break;
+        default:
+            break;
+    }
+
+    return code;
+}
+
+@end
@@ -0,0 +1,394 @@
+//
+//  SFWTTextComparator.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTTextComparator.h>
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+
+/**
+ * Open geometry being compared
+ */
+typedef struct {
+    SFGeometryType geometryType;
+    int index;
+    int children;
+} SFWTCompareFrame;
+
+@interface SFWTTextComparator()
+
+/**
+ * Expected event reader
+ */
+@property (nonatomic, strong) SFWTEventReader *expectedReader;
+
+/**
+ * Actual event reader
+ */
+@property (nonatomic, strong) SFWTEventReader *actualReader;
+
+@end
+
+@implementation SFWTTextComparator{
+    SFWTCompareFrame *_frames;
+    int _capacity;
+    int _size;
+    int _geometries;
+}
+
++(SFWTTextDifference *) differenceWithExpected: (NSString *) expected andActual: (NSString *) actual andDelta: (double) delta{
+    SFWTTextComparator *comparator = [[SFWTTextComparator alloc] initWithExpected:expected andActual:actual];
+    [comparator setDelta:delta];
+    return [comparator compare];
+}
+
++(BOOL) isEqualWithExpected: (NSString *) expected andActual: (NSString *) actual andDelta: (double) delta{
+    return [self differenceWithExpected:expected andActual:actual andDelta:delta] == nil;
+}
+
+-(instancetype) initWithExpected: (NSString *) expected andActual: (NSString *) actual{
+    return [self initWithExpectedReader:[SFWTIndexedTextReader readerWithText:expected] andActualReader:[SFWTIndexedTextReader readerWithText:actual]];
+}
+
+-(instancetype) initWithExpectedReader: (SFTextReader *) expected andActualReader: (SFTextReader *) actual{
+    self = [super init];
+    if(self != nil){
+        _expectedReader = [[SFWTEventReader alloc] initWithReader:expected];
+        _actualReader = [[SFWTEventReader alloc] initWithReader:actual];
+        _delta = 0;
+        _capacity = 8;
+        _frames = malloc(_capacity * sizeof(SFWTCompareFrame));
+    }
+    return self;
+}
+
+-(void) dealloc{
+    free(_frames);
+}
+
+-(SFWTTextDifference *) compare{
+
+    [_expectedReader setLimits:_limits];
+    [_actualReader setLimits:_limits];
+
+    _size = 0;
+    _geometries = 0;
+
+    SFWTTextDifference *difference = nil;
+
+    while(difference == nil){
+
+        SFWTEventType expectedEvent = [_expectedReader next];
+        SFWTEventType actualEvent = [_actualReader next];
+
+        if(expectedEvent != actualEvent){
+            difference = [self differenceOfExpectedEvent:expectedEvent andActualEvent:actualEvent];
+            break;
+        }
+
+        switch(expectedEvent){
+            case SFWT_EVENT_NONE:
+                return nil;
+            case SFWT_EVENT_START_GEOMETRY:
+                difference = [self startGeometry];
+                break;
+            case SFWT_EVENT_COORDINATE:
+                difference = [self coordinate];
+                break;
+            case SFWT_EVENT_END_GEOMETRY:
+                difference = [self endGeometry];
+                break;
+        }
+
+    }
+
+    return difference;
+}
+
+/**
+ * Compare start geometry events
+ *
+ * @return difference or nil
+ */
+-(SFWTTextDifference *) startGeometry{
+
+    SFGeometryType expectedType = [SFWTTextComparator comparedTypeOfGeometryType:[_expectedReader geometryType]];
+    SFGeometryType actualType = [SFWTTextComparator comparedTypeOfGeometryType:[_actualReader geometryType]];
+
+    int index = _size > 0 ? _frames[_size - 1].children++ : _geometries;
+
+    if(expectedType != actualType){
+        NSString *name = _size > 0 ? [SFWTTextComparator memberNameInType:_frames[_size - 1].geometryType] : @"geometry";
+        return [self differenceWithType:SFWT_DIFFERENCE_TYPE andName:name andIndex:index andMessage:[NSString stringWithFormat:@"Expected %@, found %@", [SFGeometryTypes name:expectedType], [SFGeometryTypes name:actualType]]];
+    }
+
+    if(_size == _capacity){
+        _capacity *= 2;
+        _frames = reallocf(_frames, _capacity * sizeof(SFWTCompareFrame));
+    }
+    SFWTCompareFrame *frame = &_frames[_size++];
+    frame->geometryType = expectedType;
+    frame->index = index;
+    frame->children = 0;
+
+    return nil;
+}
+
+/**
+ * Compare coordinate events
+ *
+ * @return difference or nil
+ */
+-(SFWTTextDifference *) coordinate{
+
+    int index = _frames[_size - 1].children++;
+
+    NSString *message = [self differenceOfDimensionsWithHasZ:[_expectedReader hasZ] andHasM:[_expectedReader hasM] andActualHasZ:[_actualReader hasZ] andActualHasM:[_actualReader hasM]];
+    if(message != nil){
+        return [self differenceWithType:SFWT_DIFFERENCE_DIMENSIONS andName:@"vertex" andIndex:index andMessage:message];
+    }
+
+    message = [self differenceOfValue:[_expectedReader x] andActual:[_actualReader x] named:@"x"];
+    if(message == nil){
+        message = [self differenceOfValue:[_expectedReader y] andActual:[_actualReader y] named:@"y"];
+    }
+    if(message == nil && [_expectedReader hasZ]){
+        message = [self differenceOfValue:[_expectedReader z] andActual:[_actualReader z] named:@"z"];
+    }
+    if(message == nil && [_expectedReader hasM]){
+        message = [self differenceOfValue:[_expectedReader m] andActual:[_actualReader m] named:@"m"];
+    }
+    if(message != nil){
+        return [self differenceWithType:SFWT_DIFFERENCE_COORDINATE andName:@"vertex" andIndex:index andMessage:message];
+    }
+
+    return nil;
+}
+
+/**
+ * Compare end geometry events
+ *
+ * @return difference or nil
+ */
+-(SFWTTextDifference *) endGeometry{
+
+    // Final dimensions, including untagged ordinates
+    NSString *message = [self differenceOfDimensionsWithHasZ:[_expectedReader hasZ] andHasM:[_expectedReader hasM] andActualHasZ:[_actualReader hasZ] andActualHasM:[_actualReader hasM]];
+    if(message != nil){
+        return [self differenceWithType:SFWT_DIFFERENCE_DIMENSIONS andName:nil andIndex:0 andMessage:message];
+    }
+
+    _size--;
+    if(_size == 0){
+        _geometries++;
+    }
+
+    return nil;
+}
+
+/**
+ * Create the difference of mismatched events
+ *
+ * @param expectedEvent
+ *            expected event type
+ * @param actualEvent
+ *            actual event type
+ *
+ * @return difference
+ */
+-(SFWTTextDifference *) differenceOfExpectedEvent: (SFWTEventType) expectedEvent andActualEvent: (SFWTEventType) actualEvent{
+
+    SFWTDifferenceType type = SFWT_DIFFERENCE_COUNT;
+    NSString *message = nil;
+
+    // Name the child present in only one of the texts
+    SFWTEventType childEvent = expectedEvent;
+    if(childEvent == SFWT_EVENT_NONE || childEvent == SFWT_EVENT_END_GEOMETRY){
+        childEvent = actualEvent;
+    }
+
+    NSString *name = nil;
+    int index = 0;
+    if(_size == 0){
+        name = @"geometry";
+        index = _geometries;
+    }else{
+        name = childEvent == SFWT_EVENT_COORDINATE ? @"vertex" : [SFWTTextComparator memberNameInType:_frames[_size - 1].geometryType];
+        index = _frames[_size - 1].children;
+    }
+
+    if(expectedEvent == SFWT_EVENT_NONE || expectedEvent == SFWT_EVENT_END_GEOMETRY){
+        message = [NSString stringWithFormat:@"Unexpected %@", name];
+    }else if(actualEvent == SFWT_EVENT_NONE || actualEvent == SFWT_EVENT_END_GEOMETRY){
+        message = [NSString stringWithFormat:@"Missing %@", name];
+    }else{
+        type = SFWT_DIFFERENCE_TYPE;
+        message = expectedEvent == SFWT_EVENT_COORDINATE ? @"Expected vertex, found geometry" : @"Expected geometry, found vertex";
+    }
+
+    return [self differenceWithType:type andName:name andIndex:index andMessage:message];
+}
+
+/**
+ * Describe a dimension difference
+ *
+ * @param hasZ
+ *            expected has z
+ * @param hasM
+ *            expected has m
+ * @param actualHasZ
+ *            actual has z
+ * @param actualHasM
+ *            actual has m
+ *
+ * @return difference description or nil
+ */
+-(NSString *) differenceOfDimensionsWithHasZ: (BOOL) hasZ andHasM: (BOOL) hasM andActualHasZ: (BOOL) actualHasZ andActualHasM: (BOOL) actualHasM{
+    NSString *message = nil;
+    if(hasZ != actualHasZ || hasM != actualHasM){
+        message = [NSString stringWithFormat:@"Expected %@, found %@", [SFWTTextComparator nameOfDimensionsWithHasZ:hasZ andHasM:hasM], [SFWTTextComparator nameOfDimensionsWithHasZ:actualHasZ andHasM:actualHasM]];
+    }
+    return message;
+}
+
+/**
+ * Describe a coordinate value difference beyond the delta
+ *
+ * @param expected
+ *            expected value
+ * @param actual
+ *            actual value
+ * @param name
+ *            ordinate name
+ *
+ * @return difference description or nil
+ */
+-(NSString *) differenceOfValue: (double) expected andActual: (double) actual named: (NSString *) name{
+    NSString *message = nil;
+    if(!(expected == actual || (isnan(expected) && isnan(actual)) || fabs(expected - actual) <= _delta)){
+        message = [NSString stringWithFormat:@"Expected %@ %.17g, found %.17g", name, expected, actual];
+    }
+    return message;
+}
+
+/**
+ * Create a difference at the open geometry path
+ *
+ * @param type
+ *            difference type
+ * @param name
+ *            child path name, nil for the current geometry
+ * @param index
+ *            child index
+ * @param message
+ *            difference description
+ *
+ * @return difference
+ */
+-(SFWTTextDifference *) differenceWithType: (SFWTDifferenceType) type andName: (NSString *) name andIndex: (int) index andMessage: (NSString *) message{
+
+    NSMutableArray<NSNumber *> *path = [NSMutableArray arrayWithCapacity:_size + 1];
+    NSMutableString *pathDescription = [NSMutableString string];
+
+    for(int i = 0; i < _size; i++){
+        NSString *frameName = i == 0 ? @"geometry" : [SFWTTextComparator memberNameInType:_frames[i - 1].geometryType];
+        [self appendName:frameName andIndex:_frames[i].index toPath:path andDescription:pathDescription];
+    }
+    if(name != nil){
+        [self appendName:name andIndex:index toPath:path andDescription:pathDescription];
+    }
+
+    return [[SFWTTextDifference alloc] initWithType:type andPath:path andPathDescription:pathDescription andMessage:message];
+}
+
+/**
+ * Append a path element
+ *
+ * @param name
+ *            element name
+ * @param index
+ *            element index
+ * @param path
+ *            path indices
+ * @param description
+ *            readable path
+ */
+-(void) appendName: (NSString *) name andIndex: (int) index toPath: (NSMutableArray<NSNumber *> *) path andDescription: (NSMutableString *) description{
+    if(path.count > 0){
+        [description appendString:@" → "];
+    }
+    [description appendFormat:@"%@ %d", name, index];
+    [path addObject:[NSNumber numberWithInt:index]];
+}
+
++(NSString *) memberNameInType: (SFGeometryType) geometryType{
+
+    NSString *name = nil;
+
+    switch(geometryType){
+        case SF_POLYGON:
+        case SF_CURVEPOLYGON:
+        case SF_TRIANGLE:
+            name = @"ring";
+            break;
+        case SF_MULTIPOINT:
+            name = @"point";
+            break;
+        case SF_MULTILINESTRING:
+            name = @"line string";
+            break;
+        case SF_COMPOUNDCURVE:
+            name = @"segment";
+            break;
+        case SF_MULTIPOLYGON:
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            name = @"polygon";
+            break;
+        default:
+            name = @"geometry";
+            break;
+    }
+
+    return name;
+}
+
+/**
+ * Get the geometry type compared for a geometry type, matching the type
+ * the geometry reader creates
+ *
+ * @param geometryType
+ *            geometry type
+ *
+ * @return compared geometry type
+ */
++(SFGeometryType) comparedTypeOfGeometryType: (SFGeometryType) geometryType{
+    switch(geometryType){
+        case SF_MULTICURVE:
+        case SF_MULTISURFACE:
+            geometryType = SF_GEOMETRYCOLLECTION;
+            break;
+        default:
+            break;
+    }
+    return geometryType;
+}
+
+/**
+ * Get the dimension name
+ *
+ * @param hasZ
+ *            has z
+ * @param hasM
+ *            has m
+ *
+ * @return dimension name
+ */
++(NSString *) nameOfDimensionsWithHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+    return hasZ ? (hasM ? @"ZM" : @"Z") : (hasM ? @"M" : @"XY");
+}
+
+@end
@@ -0,0 +1,28 @@
+//
+//  SFWTTextDifference.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTTextDifference.h>
+
+@implementation SFWTTextDifference
+
+-(instancetype) initWithType: (SFWTDifferenceType) type andPath: (NSArray<NSNumber *> *) path andPathDescription: (NSString *) pathDescription andMessage: (NSString *) message{
+    self = [super init];
+    if(self != nil){
+        _type = type;
+        _path = path;
+        _pathDescription = pathDescription;
+        _message = message;
+    }
+    return self;
+}
+
+-(NSString *) description{
+    return [NSString stringWithFormat:@"%@: %@", _pathDescription, _message];
+}
+
+@end
@@ -0,0 +1,269 @@
+//
+//  SFWTTextNormalizer.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTTextNormalizer.h>
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+#import <SimpleFeaturesWKT/SFWTGeometryWriter.h>
+
+/**
+ * Open geometry being written
+ */
+typedef struct {
+    SFGeometryType geometryType;
+    NSUInteger tagOffset;
+    int members;
+} SFWTTextFrame;
+
+@interface SFWTTextNormalizer()
+
+/**
+ * Event reader
+ */
+@property (nonatomic, strong) SFWTEventReader *eventReader;
+
+@end
+
+@implementation SFWTTextNormalizer{
+    SFWTTextFrame *_frames;
+    int _capacity;
+    int _size;
+    NSMutableData *_data;
+}
+
++(NSString *) normalizedTextWithText: (NSString *) text{
+    return [[[SFWTTextNormalizer alloc] initWithText:text] write];
+}
+
+-(instancetype) initWithText: (NSString *) text{
+    return [self initWithReader:[SFWTIndexedTextReader readerWithText:text]];
+}
+
+-(instancetype) initWithReader: (SFTextReader *) reader{
+    self = [super init];
+    if(self != nil){
+        _eventReader = [[SFWTEventReader alloc] initWithReader:reader];
+        _capacity = 8;
+        _frames = malloc(_capacity * sizeof(SFWTTextFrame));
+    }
+    return self;
+}
+
+-(void) dealloc{
+    free(_frames);
+}
+
+-(NSString *) write{
+    NSString *text = nil;
+    NSMutableData *data = [NSMutableData data];
+    if([self writeToData:data]){
+        text = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+    }
+    return text;
+}
+
+-(BOOL) writeToStream: (NSOutputStream *) stream{
+    NSMutableData *data = [NSMutableData data];
+    BOOL written = [self writeToData:data];
+    const uint8_t *bytes = [data bytes];
+    NSUInteger length = [data length];
+    NSUInteger offset = 0;
+    while(offset < length){
+        NSInteger count = [stream write:bytes + offset maxLength:length - offset];
+        if(count <= 0){
+            [NSException raise:@"Stream Write" format:@"Failed to write well-known text to stream: %@", [stream streamError]];
+        }
+        offset += count;
+    }
+    return written;
+}
+
+-(BOOL) writeToData: (NSMutableData *) data{
+
+    [_eventReader setLimits:_limits];
+
+    if([_eventReader next] == SFWT_EVENT_NONE){
+        return NO;
+    }
+
+    _data = data;
+    _size = 0;
+
+    @try{
+
+        do{
+
+            switch([_eventReader eventType]){
+                case SFWT_EVENT_START_GEOMETRY:
+                    [self startGeometry];
+                    break;
+                case SFWT_EVENT_COORDINATE:
+                    [self coordinate];
+                    break;
+                case SFWT_EVENT_END_GEOMETRY:
+                    [self endGeometry];
+                    break;
+                default:
+                    break;
+            }
+
+        } while(_size > 0 && [_eventReader next] != SFWT_EVENT_NONE);
+
+    }@finally{
+        _data = nil;
+    }
+
+    if(_size > 0){
+        [NSException raise:@"Invalid Token" format:@"Unexpected end of text, %d geometries not closed", _size];
+    }
+
+    return YES;
+}
+
+/**
+ * Handle a start geometry event
+ */
+-(void) startGeometry{
+
+    SFGeometryType geometryType = [_eventReader geometryType];
+
+    if(_size == _capacity){
+        _capacity *= 2;
+        _frames = reallocf(_frames, _capacity * sizeof(SFWTTextFrame));
+    }
+
+    SFWTTextFrame *parent = NULL;
+    if(_size > 0){
+        parent = &_frames[_size - 1];
+        [self beginMemberOfFrame:parent];
+    }
+
+    SFWTTextFrame *frame = &_frames[_size++];
+    frame->geometryType = geometryType;
+    frame->members = 0;
+    frame->tagOffset = NSNotFound;
+
+    if(parent == NULL || [SFWTTextNormalizer writesTypesOfMembers:parent->geometryType]){
+        if(geometryType == SF_MULTICURVE || geometryType == SF_MULTISURFACE){
+            // Read as geometry collections
+            geometryType = SF_GEOMETRYCOLLECTION;
+        }
+        [self appendCString:[[SFGeometryTypes name:geometryType] UTF8String]];
+        [self appendCString:" "];
+        frame->tagOffset = [_data length];
+    }
+
+}
+
+/**
+ * Handle a coordinate event
+ */
+-(void) coordinate{
+
+    [self beginMemberOfFrame:&_frames[_size - 1]];
+
+    [self appendValue:[_eventReader x]];
+    [self appendCString:" "];
+    [self appendValue:[_eventReader y]];
+    if([_eventReader hasZ]){
+        [self appendCString:" "];
+        [self appendValue:[_eventReader z]];
+    }
+    if([_eventReader hasM]){
+        [self appendCString:" "];
+        [self appendValue:[_eventReader m]];
+    }
+
+}
+
+/**
+ * Handle an end geometry event
+ */
+-(void) endGeometry{
+
+    SFWTTextFrame *frame = &_frames[_size - 1];
+
+    if(frame->members > 0){
+        [self appendCString:")"];
+    }else{
+        [self appendCString:"EMPTY"];
+    }
+
+    if(frame->tagOffset != NSNotFound){
+        BOOL hasZ = [_eventReader hasZ];
+        BOOL hasM = [_eventReader hasM];
+        if(hasZ || hasM){
+            // Dimensions include untagged child ordinates, known at the end
+            const char *tag = hasZ ? (hasM ? "ZM " : "Z ") : "M ";
+            [_data replaceBytesInRange:NSMakeRange(frame->tagOffset, 0) withBytes:tag length:strlen(tag)];
+        }
+    }
+
+    _size--;
+}
+
+/**
+ * Write the opening parenthesis or member separator and count the member
+ *
+ * @param frame
+ *            containing frame
+ */
+-(void) beginMemberOfFrame: (SFWTTextFrame *) frame{
+    if(frame->members++ == 0){
+        [self appendCString:"("];
+    }else{
+        [self appendCString:", "];
+    }
+}
+
+/**
+ * Append a formatted value
+ *
+ * @param value
+ *            value
+ */
+-(void) appendValue: (double) value{
+    char buffer[SFWT_VALUE_BUFFER_SIZE];
+    int length = [SFWTGeometryWriter formatValue:value toBuffer:buffer];
+    [_data appendBytes:buffer length:length];
+}
+
+/**
+ * Append a C string
+ *
+ * @param string
+ *            C string
+ */
+-(void) appendCString: (const char *) string{
+    [_data appendBytes:string length:strlen(string)];
+}
+
+/**
+ * Determine if members of the geometry type are written with type names
+ *
+ * @param geometryType
+ *            containing geometry type
+ *
+ * @return true if member types are written
+ */
++(BOOL) writesTypesOfMembers: (SFGeometryType) geometryType{
+    BOOL types = NO;
+    switch(geometryType){
+        case SF_GEOMETRYCOLLECTION:
+        case SF_MULTICURVE:
+        case SF_MULTISURFACE:
+        case SF_COMPOUNDCURVE:
+        case SF_CURVEPOLYGON:
+            types = YES;
+            break;
+        default:
+            break;
+    }
+    return types;
+}
+
+@end
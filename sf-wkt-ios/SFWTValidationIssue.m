@@ -0,0 +1,32 @@
+//
+//  SFWTValidationIssue.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTValidationIssue.h>
+
+NSString * const SFWT_VALIDATION_FAILED = @"Validation Failed";
+
+NSString * const SFWT_VALIDATION_ISSUE_KEY = @"issue";
+
+@implementation SFWTValidationIssue
+
+-(instancetype) initWithRule: (SFWTValidationRules) rule andGeometryType: (SFGeometryType) geometryType andPosition: (NSUInteger) position andMessage: (NSString *) message{
+    self = [super init];
+    if(self != nil){
+        _rule = rule;
+        _geometryType = geometryType;
+        _position = position;
+        _message = message;
+    }
+    return self;
+}
+
+-(NSString *) description{
+    return [NSString stringWithFormat:@"%@: %@", [SFGeometryTypes name:_geometryType], _message];
+}
+
+@end
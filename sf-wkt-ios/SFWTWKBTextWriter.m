@@ -0,0 +1,409 @@
+//
+//  SFWTWKBTextWriter.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTWKBTextWriter.h>
+#import <SimpleFeaturesWKT/SFWTGeometryWriter.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+
+/**
+ * Chunk size used when writing to a mutable string
+ */
+#define SFWT_TEXT_CHUNK_SIZE 1024
+
+/**
+ * Highest supported well-known binary geometry type code
+ */
+#define SFWT_MAX_GEOMETRY_CODE 17
+
+/**
+ * Text output, either a caller buffer or a mutable string fed in chunks
+ */
+typedef struct {
+    char *buffer;
+    NSUInteger capacity;
+    NSUInteger length;
+    CFMutableStringRef string;
+    char chunk[SFWT_TEXT_CHUNK_SIZE];
+    NSUInteger chunkLength;
+} SFWTTextOutput;
+
+/**
+ * Binary input
+ */
+typedef struct {
+    const uint8_t *bytes;
+    NSUInteger length;
+    NSUInteger offset;
+} SFWTBinaryInput;
+
+/**
+ * Geometry header
+ */
+typedef struct {
+    BOOL swap;
+    uint32_t code;
+    BOOL hasZ;
+    BOOL hasM;
+} SFWTBinaryHeader;
+
+/**
+ * Geometry type names as written, indexed by code
+ */
+static const char *sfwt_names[SFWT_MAX_GEOMETRY_CODE + 1];
+
+static void sfwt_flush(SFWTTextOutput *output){
+    if(output->string != NULL && output->chunkLength > 0){
+        output->chunk[output->chunkLength] = '\0';
+        CFStringAppendCString(output->string, output->chunk, kCFStringEncodingASCII);
+        output->chunkLength = 0;
+    }
+}
+
+static void sfwt_append(SFWTTextOutput *output, const char *text, NSUInteger length){
+    if(output->string != NULL){
+        if(output->chunkLength + length >= SFWT_TEXT_CHUNK_SIZE){
+            sfwt_flush(output);
+        }
+        memcpy(output->chunk + output->chunkLength, text, length);
+        output->chunkLength += length;
+    }else if(output->length + 1 < output->capacity){
+        NSUInteger available = output->capacity - 1 - output->length;
+        memcpy(output->buffer + output->length, text, MIN(length, available));
+    }
+    output->length += length;
+}
+
+static void sfwt_append_string(SFWTTextOutput *output, const char *text){
+    sfwt_append(output, text, strlen(text));
+}
+
+static void sfwt_invalid(SFWTBinaryInput *input, NSUInteger size){
+    [NSException raise:@"Invalid WKB" format:@"Unexpected end of well-known binary reading %lu bytes at offset %lu of %lu", (unsigned long)size, (unsigned long)input->offset, (unsigned long)input->length];
+}
+
+static uint32_t sfwt_read_uint32(SFWTBinaryInput *input, BOOL swap){
+    if(input->length - input->offset < 4){
+        sfwt_invalid(input, 4);
+    }
+    uint32_t value;
+    memcpy(&value, input->bytes + input->offset, 4);
+    input->offset += 4;
+    return swap ? CFSwapInt32(value) : value;
+}
+
+static double sfwt_read_double(SFWTBinaryInput *input, BOOL swap){
+    if(input->length - input->offset < 8){
+        sfwt_invalid(input, 8);
+    }
+    uint64_t bits;
+    memcpy(&bits, input->bytes + input->offset, 8);
+    input->offset += 8;
+    if(swap){
+        bits = CFSwapInt64(bits);
+    }
+    double value;
+    memcpy(&value, &bits, 8);
+    return value;
+}
+
+static SFWTBinaryHeader sfwt_read_header(SFWTBinaryInput *input){
+
+    if(input->offset >= input->length){
+        sfwt_invalid(input, 1);
+    }
+
+    SFWTBinaryHeader header;
+    uint8_t byteOrder = input->bytes[input->offset++];
+    BOOL littleEndian = byteOrder == 1;
+    header.swap = littleEndian != (CFByteOrderGetCurrent() == CFByteOrderLittleEndian);
+
+    uint32_t code = sfwt_read_uint32(input, header.swap);
+
+    // Extended flags
+    header.hasZ = (code & 0x80000000) != 0;
+    header.hasM = (code & 0x40000000) != 0;
+    if((code & 0x20000000) != 0){
+        // Skip the SRID
+        sfwt_read_uint32(input, header.swap);
+    }
+    code &= 0x0FFFFFFF;
+
+    // ISO dimension codes
+    switch(code / 1000){
+        case 1:
+            header.hasZ = YES;
+            break;
+        case 2:
+            header.hasM = YES;
+            break;
+        case 3:
+            header.hasZ = YES;
+            header.hasM = YES;
+            break;
+        default:
+            break;
+    }
+    header.code = code % 1000;
+
+    if(header.code > SFWT_MAX_GEOMETRY_CODE || sfwt_names[header.code] == NULL){
+        [NSException raise:@"Geometry Not Supported" format:@"Geometry Type not supported: %u", code];
+    }
+
+    return header;
+}
+
+/**
+ * Peek at the geometry code of the first member of a multi geometry
+ */
+static uint32_t sfwt_peek_member_code(SFWTBinaryInput *input){
+    SFWTBinaryInput peek = *input;
+    return sfwt_read_header(&peek).code;
+}
+
+static void sfwt_write_value(SFWTTextOutput *output, double value){
+    char buffer[SFWT_VALUE_BUFFER_SIZE];
+    int length = [SFWTGeometryWriter formatValue:value toBuffer:buffer];
+    sfwt_append(output, buffer, length);
+}
+
+static void sfwt_write_point(SFWTTextOutput *output, SFWTBinaryInput *input, SFWTBinaryHeader *header){
+    sfwt_write_value(output, sfwt_read_double(input, header->swap));
+    sfwt_append(output, " ", 1);
+    sfwt_write_value(output, sfwt_read_double(input, header->swap));
+    if(header->hasZ){
+        sfwt_append(output, " ", 1);
+        sfwt_write_value(output, sfwt_read_double(input, header->swap));
+    }
+    if(header->hasM){
+        sfwt_append(output, " ", 1);
+        sfwt_write_value(output, sfwt_read_double(input, header->swap));
+    }
+}
+
+static void sfwt_write_wrapped_point(SFWTTextOutput *output, SFWTBinaryInput *input, SFWTBinaryHeader *header){
+    sfwt_append(output, "(", 1);
+    sfwt_write_point(output, input, header);
+    sfwt_append(output, ")", 1);
+}
+
+static void sfwt_write_line_string(SFWTTextOutput *output, SFWTBinaryInput *input, SFWTBinaryHeader *header){
+    uint32_t numPoints = sfwt_read_uint32(input, header->swap);
+    if(numPoints == 0){
+        sfwt_append(output, "EMPTY", 5);
+    }else{
+        sfwt_append(output, "(", 1);
+        for(uint32_t i = 0; i < numPoints; i++){
+            if(i > 0){
+                sfwt_append(output, ", ", 2);
+            }
+            sfwt_write_point(output, input, header);
+        }
+        sfwt_append(output, ")", 1);
+    }
+}
+
+static void sfwt_write_polygon(SFWTTextOutput *output, SFWTBinaryInput *input, SFWTBinaryHeader *header){
+    uint32_t numRings = sfwt_read_uint32(input, header->swap);
+    if(numRings == 0){
+        sfwt_append(output, "EMPTY", 5);
+    }else{
+        sfwt_append(output, "(", 1);
+        for(uint32_t i = 0; i < numRings; i++){
+            if(i > 0){
+                sfwt_append(output, ", ", 2);
+            }
+            sfwt_write_line_string(output, input, header);
+        }
+        sfwt_append(output, ")", 1);
+    }
+}
+
+static void sfwt_write_geometry(SFWTTextOutput *output, SFWTBinaryInput *input, int depth);
+
+/**
+ * Member body writer, reads the member header before the body
+ */
+typedef enum {
+    SFWT_MEMBER_WRAPPED_POINT,
+    SFWT_MEMBER_LINE_STRING,
+    SFWT_MEMBER_POLYGON,
+    SFWT_MEMBER_GEOMETRY
+} SFWTMemberWrite;
+
+static void sfwt_write_members(SFWTTextOutput *output, SFWTBinaryInput *input, SFWTBinaryHeader *header, SFWTMemberWrite memberWrite, uint32_t count, int depth){
+    if(count == 0){
+        sfwt_append(output, "EMPTY", 5);
+    }else{
+        sfwt_append(output, "(", 1);
+        for(uint32_t i = 0; i < count; i++){
+            if(i > 0){
+                sfwt_append(output, ", ", 2);
+            }
+            SFWTMemberWrite write = memberWrite;
+            if(write == SFWT_MEMBER_LINE_STRING && sfwt_peek_member_code(input) == SF_CIRCULARSTRING){
+                write = SFWT_MEMBER_GEOMETRY;
+            }
+            if(write == SFWT_MEMBER_GEOMETRY){
+                sfwt_write_geometry(output, input, depth + 1);
+            }else{
+                SFWTBinaryHeader memberHeader = sfwt_read_header(input);
+                switch(write){
+                    case SFWT_MEMBER_WRAPPED_POINT:
+                        sfwt_write_wrapped_point(output, input, &memberHeader);
+                        break;
+                    case SFWT_MEMBER_LINE_STRING:
+                        sfwt_write_line_string(output, input, &memberHeader);
+                        break;
+                    default:
+                        sfwt_write_polygon(output, input, &memberHeader);
+                        break;
+                }
+            }
+        }
+        sfwt_append(output, ")", 1);
+    }
+}
+
+static void sfwt_write_geometry(SFWTTextOutput *output, SFWTBinaryInput *input, int depth){
+
+    if(depth > 1000){
+        [NSException raise:@"Invalid WKB" format:@"Well-known binary geometry nesting exceeds %d", 1000];
+    }
+
+    SFWTBinaryHeader header = sfwt_read_header(input);
+    uint32_t code = header.code;
+
+    uint32_t count = 0;
+    if(code != SF_POINT){
+        // Peek at the count for the multi curve name check
+        SFWTBinaryInput peek = *input;
+        count = sfwt_read_uint32(&peek, header.swap);
+    }
+
+    // Write the geometry type
+    const char *name = sfwt_names[code];
+    if(code == SF_MULTILINESTRING && count > 0){
+        SFWTBinaryInput member = *input;
+        member.offset += 4;
+        if(sfwt_peek_member_code(&member) == SF_CIRCULARSTRING){
+            name = sfwt_names[SF_MULTICURVE];
+        }
+    }
+    sfwt_append_string(output, name);
+    sfwt_append(output, " ", 1);
+    if(header.hasZ || header.hasM){
+        if(header.hasZ){
+            sfwt_append(output, "Z", 1);
+        }
+        if(header.hasM){
+            sfwt_append(output, "M", 1);
+        }
+        sfwt_append(output, " ", 1);
+    }
+
+    switch(code){
+        case SF_POINT:
+            sfwt_write_wrapped_point(output, input, &header);
+            break;
+        case SF_LINESTRING:
+        case SF_CIRCULARSTRING:
+            sfwt_write_line_string(output, input, &header);
+            break;
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+            sfwt_write_polygon(output, input, &header);
+            break;
+        case SF_MULTIPOINT:
+            input->offset += 4;
+            sfwt_write_members(output, input, &header, SFWT_MEMBER_WRAPPED_POINT, count, depth);
+            break;
+        case SF_MULTILINESTRING:
+            input->offset += 4;
+            sfwt_write_members(output, input, &header, SFWT_MEMBER_LINE_STRING, count, depth);
+            break;
+        case SF_MULTIPOLYGON:
+        case SF_POLYHEDRALSURFACE:
+        case SF_TIN:
+            input->offset += 4;
+            sfwt_write_members(output, input, &header, SFWT_MEMBER_POLYGON, count, depth);
+            break;
+        case SF_GEOMETRYCOLLECTION:
+        case SF_MULTICURVE:
+        case SF_MULTISURFACE:
+        case SF_COMPOUNDCURVE:
+        case SF_CURVEPOLYGON:
+            input->offset += 4;
+            sfwt_write_members(output, input, &header, SFWT_MEMBER_GEOMETRY, count, depth);
+            break;
+        default:
+            [NSException raise:@"Unexpected Geometry Type" format:@"Unexpected Geometry Type of %s which is abstract", name];
+    }
+
+}
+
+@implementation SFWTWKBTextWriter
+
++(void) initialize{
+    for(int code = 0; code <= SFWT_MAX_GEOMETRY_CODE; code++){
+        NSString *name = [SFGeometryTypes name:(SFGeometryType) code];
+        sfwt_names[code] = name != nil ? strdup([name UTF8String]) : NULL;
+    }
+}
+
++(NSString *) textWithWKB: (NSData *) wkb{
+    NSMutableString *text = [NSMutableString string];
+    [self writeWKB:wkb toString:text];
+    return text;
+}
+
++(void) writeWKB: (NSData *) wkb toString: (NSMutableString *) string{
+    SFWTTextOutput *output = malloc(sizeof(SFWTTextOutput));
+    output->buffer = NULL;
+    output->capacity = 0;
+    output->length = 0;
+    output->string = (__bridge CFMutableStringRef) string;
+    output->chunkLength = 0;
+    @try {
+        [self writeWKB:wkb toOutput:output];
+        sfwt_flush(output);
+    } @finally {
+        free(output);
+    }
+}
+
++(NSUInteger) writeWKB: (NSData *) wkb toBuffer: (char *) buffer withLength: (NSUInteger) length{
+    SFWTTextOutput output;
+    output.buffer = buffer;
+    output.capacity = length;
+    output.length = 0;
+    output.string = NULL;
+    output.chunkLength = 0;
+    [self writeWKB:wkb toOutput:&output];
+    if(length > 0){
+        buffer[MIN(output.length, length - 1)] = '\0';
+    }
+    return output.length;
+}
+
+/**
+ * Transcode well-known binary to the text output
+ *
+ * @param wkb
+ *            well-known binary
+ * @param output
+ *            text output
+ */
++(void) writeWKB: (NSData *) wkb toOutput: (SFWTTextOutput *) output{
+    SFWTBinaryInput input;
+    input.bytes = [wkb bytes];
+    input.length = [wkb length];
+    input.offset = 0;
+    sfwt_write_geometry(output, &input, 0);
+}
+
+@end
@@ -0,0 +1,370 @@
+//
+//  SFWTWKBTranscoder.m
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <SimpleFeaturesWKT/SFWTWKBTranscoder.h>
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+
+/**
+ * Open geometry being written
+ */
+typedef struct {
+    NSUInteger codeOffset;
+    NSUInteger countOffset;
+    BOOL headered;
+    int coordinateStart;
+} SFWTWKBFrame;
+
+/**
+ * Written coordinate, recorded until the dimensions of its headered
+ * geometry are known
+ */
+typedef struct {
+    NSUInteger offset;
+    BOOL hasZ;
+    BOOL hasM;
+} SFWTWKBCoordinate;
+
+@interface SFWTWKBTranscoder()
+
+/**
+ * Event reader
+ */
+@property (nonatomic, strong) SFWTEventReader *eventReader;
+
+@end
+
+@implementation SFWTWKBTranscoder{
+    SFWTWKBFrame *_frames;
+    int _capacity;
+    SFWTWKBCoordinate *_coordinates;
+    int _coordinateCount;
+    int _coordinateCapacity;
+}
+
++(NSData *) wkbWithText: (NSString *) text{
+    return [self wkbWithText:text andByteOrder:CFByteOrderBigEndian];
+}
+
++(NSData *) wkbWithText: (NSString *) text andByteOrder: (CFByteOrder) byteOrder{
+    SFWTWKBTranscoder *transcoder = [[SFWTWKBTranscoder alloc] initWithText:text];
+    [transcoder setByteOrder:byteOrder];
+    return [transcoder write];
+}
+
+-(instancetype) initWithText: (NSString *) text{
+    return [self initWithReader:[SFWTIndexedTextReader readerWithText:text]];
+}
+
+-(instancetype) initWithReader: (SFTextReader *) reader{
+    self = [super init];
+    if(self != nil){
+        _eventReader = [[SFWTEventReader alloc] initWithReader:reader];
+        _byteOrder = CFByteOrderBigEndian;
+        _capacity = 8;
+        _frames = malloc(_capacity * sizeof(SFWTWKBFrame));
+        _coordinateCapacity = 64;
+        _coordinates = malloc(_coordinateCapacity * sizeof(SFWTWKBCoordinate));
+    }
+    return self;
+}
+
+-(void) dealloc{
+    free(_frames);
+    free(_coordinates);
+}
+
+-(NSData *) write{
+    NSMutableData *data = [NSMutableData data];
+    return [self writeToData:data] ? data : nil;
+}
+
+-(BOOL) writeToData: (NSMutableData *) data{
+
+    [_eventReader setLimits:_limits];
+
+    if([_eventReader next] == SFWT_EVENT_NONE){
+        return NO;
+    }
+
+    int size = 0;
+    _coordinateCount = 0;
+
+    do{
+
+        switch([_eventReader eventType]){
+
+            case SFWT_EVENT_START_GEOMETRY:
+                {
+                    if(size == _capacity){
+                        _capacity *= 2;
+                        _frames = reallocf(_frames, _capacity * sizeof(SFWTWKBFrame));
+                    }
+                    SFWTWKBFrame *frame = &_frames[size++];
+                    SFGeometryType geometryType = [_eventReader geometryType];
+                    frame->headered = [self isHeaderedInType:[_eventReader containingType]];
+                    frame->codeOffset = NSNotFound;
+                    frame->countOffset = NSNotFound;
+                    frame->coordinateStart = _coordinateCount;
+                    if(frame->headered){
+                        uint8_t byteOrder = _byteOrder == CFByteOrderLittleEndian ? 1 : 0;
+                        [data appendBytes:&byteOrder length:1];
+                        frame->codeOffset = [data length];
+                        [self appendUInt32:0 toData:data];
+                    }
+                    if(geometryType != SF_POINT){
+                        frame->countOffset = [data length];
+                        [self appendUInt32:0 toData:data];
+                    }
+                }
+                break;
+
+            case SFWT_EVENT_COORDINATE:
+                {
+                    if(_coordinateCount == _coordinateCapacity){
+                        _coordinateCapacity *= 2;
+                        _coordinates = reallocf(_coordinates, _coordinateCapacity * sizeof(SFWTWKBCoordinate));
+                    }
+                    SFWTWKBCoordinate *coordinate = &_coordinates[_coordinateCount++];
+                    coordinate->offset = [data length];
+                    coordinate->hasZ = [_eventReader hasZ];
+                    coordinate->hasM = [_eventReader hasM];
+                }
+                [self appendDouble:[_eventReader x] toData:data];
+                [self appendDouble:[_eventReader y] toData:data];
+                if([_eventReader hasZ]){
+                    [self appendDouble:[_eventReader z] toData:data];
+                }
+                if([_eventReader hasM]){
+                    [self appendDouble:[_eventReader m] toData:data];
+                }
+                break;
+
+            case SFWT_EVENT_END_GEOMETRY:
+                {
+                    SFWTWKBFrame *frame = &_frames[--size];
+                    if(frame->codeOffset != NSNotFound){
+                        uint32_t code = [SFWTWKBTranscoder codeOfGeometryType:[_eventReader geometryType] andHasZ:[_eventReader hasZ] andHasM:[_eventReader hasM]];
+                        [self replaceUInt32:code atOffset:frame->codeOffset inData:data];
+                        [self padCoordinatesFrom:frame->coordinateStart withHasZ:[_eventReader hasZ] andHasM:[_eventReader hasM] inData:data];
+                    }
+                    if(frame->countOffset != NSNotFound){
+                        [self replaceUInt32:[_eventReader count] atOffset:frame->countOffset inData:data];
+                    }
+                }
+                break;
+
+            default:
+                break;
+        }
+
+    } while(size > 0 && [_eventReader next] != SFWT_EVENT_NONE);
+
+    if(size > 0){
+        [NSException raise:@"Invalid Token" format:@"Unexpected end of text, %d geometries not closed", size];
+    }
+
+    return YES;
+}
+
++(uint32_t) codeOfGeometryType: (SFGeometryType) geometryType andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM{
+
+    uint32_t code = 0;
+
+    switch(geometryType){
+        case SF_GEOMETRY:
+            code = 0;
+            break;
+        case SF_POINT:
+            code = 1;
+            break;
+        case SF_LINESTRING:
+            code = 2;
+            break;
+        case SF_POLYGON:
+            code = 3;
+            break;
+        case SF_MULTIPOINT:
+            code = 4;
+            break;
+        case SF_MULTILINESTRING:
+            code = 5;
+            break;
+        case SF_MULTIPOLYGON:
+            code = 6;
+            break;
+        case SF_GEOMETRYCOLLECTION:
+        case SF_MULTICURVE:
+        case SF_MULTISURFACE:
+            // Read as geometry collections
+            code = 7;
+            break;
+        case SF_CIRCULARSTRING:
+            code = 8;
+            break;
+        case SF_COMPOUNDCURVE:
+            code = 9;
+            break;
+        case SF_CURVEPOLYGON:
+            code = 10;
+            break;
+        case SF_CURVE:
+            code = 13;
+            break;
+        case SF_SURFACE:
+            code = 14;
+            break;
+        case SF_POLYHEDRALSURFACE:
+            code = 15;
+            break;
+        case SF_TIN:
+            code = 16;
+            break;
+        case SF_TRIANGLE:
+            code = 17;
+            break;
+        default:
+            [NSException raise:@"Unsupported Geometry" format:@"Geometry Type not supported: %@", [SFGeometryTypes name:geometryType]];
+    }
+
+    if(hasZ){
+        code += 1000;
+    }
+    if(hasM){
+        code += 2000;
+    }
+
+    return code;
+}
+
+/**
+ * Pad the coordinates written since the start index to the final
+ * dimensions of their headered geometry, writing NaN for missing z and m
+ * values. Untagged text may mix coordinate dimensions within a geometry
+ * while the type code is written with the dimensions of the geometry.
+ *
+ * @param start
+ *            index of the first coordinate of the geometry
+ * @param hasZ
+ *            geometry has z values
+ * @param hasM
+ *            geometry has m values
+ * @param data
+ *            output data
+ */
+-(void) padCoordinatesFrom: (int) start withHasZ: (BOOL) hasZ andHasM: (BOOL) hasM inData: (NSMutableData *) data{
+    
+    int first = start;
+    while(first < _coordinateCount && _coordinates[first].hasZ == hasZ && _coordinates[first].hasM == hasM){
+        first++;
+    }
+    
+    if(first < _coordinateCount){
+        
+        const uint8_t *bytes = [data bytes];
+        NSUInteger tailOffset = _coordinates[first].offset;
+        NSMutableData *tail = [NSMutableData dataWithCapacity:[data length] - tailOffset];
+        NSUInteger copied = tailOffset;
+        
+        for(int i = first; i < _coordinateCount; i++){
+            SFWTWKBCoordinate *coordinate = &_coordinates[i];
+            // Counts of rings between coordinates, followed by x and y
+            [tail appendBytes:bytes + copied length:coordinate->offset + 2 * sizeof(double) - copied];
+            copied = coordinate->offset + 2 * sizeof(double);
+            if(coordinate->hasZ){
+                if(hasZ){
+                    [tail appendBytes:bytes + copied length:sizeof(double)];
+                }
+                copied += sizeof(double);
+            }else if(hasZ){
+                [self appendDouble:NAN toData:tail];
+            }
+            if(coordinate->hasM){
+                if(hasM){
+                    [tail appendBytes:bytes + copied length:sizeof(double)];
+                }
+                copied += sizeof(double);
+            }else if(hasM){
+                [self appendDouble:NAN toData:tail];
+            }
+        }
+        [tail appendBytes:bytes + copied length:[data length] - copied];
+        
+        [data replaceBytesInRange:NSMakeRange(tailOffset, [data length] - tailOffset) withBytes:[tail bytes] length:[tail length]];
+    }
+    
+    _coordinateCount = start;
+}
+
+/**
+ * Determine if member geometries within the containing type are written
+ * with a byte order and type code header
+ *
+ * @param containingType
+ *            containing geometry type, SF_NONE at the top level
+ *
+ * @return true if headered
+ */
+-(BOOL) isHeaderedInType: (SFGeometryType) containingType{
+    BOOL headered;
+    switch(containingType){
+        case SF_POLYGON:
+        case SF_TRIANGLE:
+            // Rings
+            headered = NO;
+            break;
+        default:
+            headered = YES;
+            break;
+    }
+    return headered;
+}
+
+/**
+ * Append an unsigned 32 bit integer in the byte order
+ *
+ * @param value
+ *            value
+ * @param data
+ *            output data
+ */
+-(void) appendUInt32: (uint32_t) value toData: (NSMutableData *) data{
+    uint32_t ordered = _byteOrder == CFByteOrderLittleEndian ? CFSwapInt32HostToLittle(value) : CFSwapInt32HostToBig(value);
+    [data appendBytes:&ordered length:sizeof(ordered)];
+}
+
+/**
+ * Replace an unsigned 32 bit integer in the byte order
+ *
+ * @param value
+ *            value
+ * @param offset
+ *            byte offset
+ * @param data
+ *            output data
+ */
+-(void) replaceUInt32: (uint32_t) value atOffset: (NSUInteger) offset inData: (NSMutableData *) data{
+    uint32_t ordered = _byteOrder == CFByteOrderLittleEndian ? CFSwapInt32HostToLittle(value) : CFSwapInt32HostToBig(value);
+    [data replaceBytesInRange:NSMakeRange(offset, sizeof(ordered)) withBytes:&ordered];
+}
+
+/**
+ * Append a double in the byte order
+ *
+ * @param value
+ *            value
+ * @param data
+ *            output data
+ */
+-(void) appendDouble: (double) value toData: (NSMutableData *) data{
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    uint64_t ordered = _byteOrder == CFByteOrderLittleEndian ? CFSwapInt64HostToLittle(bits) : CFSwapInt64HostToBig(bits);
+    [data appendBytes:&ordered length:sizeof(ordered)];
+}
+
+@end
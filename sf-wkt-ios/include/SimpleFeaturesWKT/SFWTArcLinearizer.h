@@ -0,0 +1,92 @@
+//
+//  SFWTArcLinearizer.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * Default number of segments per quarter circle
+ */
+extern int const SFWT_DEFAULT_SEGMENTS_PER_QUADRANT;
+
+/**
+ * Circular arc linearizer. Approximates the arc through three points with
+ * line segments, interpolating z and m values along the arc. Points are
+ * passed as x, y, z, m arrays with NaN for missing values.
+ */
+@interface SFWTArcLinearizer : NSObject
+
+/**
+ * Number of segments per quarter circle, used when no tolerance is set
+ */
+@property (nonatomic) int segmentsPerQuadrant;
+
+/**
+ * Maximum distance between the arc and a segment, 0 for none
+ */
+@property (nonatomic) double maxDeviation;
+
+/**
+ * Maximum angle in radians swept by a segment, 0 for none
+ */
+@property (nonatomic) double maxAngle;
+
+/**
+ * Initializer, default segments per quadrant
+ */
+-(instancetype) init;
+
+/**
+ * Initializer
+ *
+ * @param segmentsPerQuadrant
+ *            segments per quarter circle
+ */
+-(instancetype) initWithSegmentsPerQuadrant: (int) segmentsPerQuadrant;
+
+/**
+ * Initializer
+ *
+ * @param maxDeviation
+ *            maximum distance between the arc and a segment
+ */
+-(instancetype) initWithMaxDeviation: (double) maxDeviation;
+
+/**
+ * Linearize the arc from the start through the middle to the end point.
+ * The block is called for each generated point after the start, ending
+ * with the end point. Collinear points produce the middle and end point.
+ * A start equal to the end is a full circle through the middle point.
+ *
+ * @param start
+ *            arc start x, y, z, m
+ * @param middle
+ *            arc middle x, y, z, m
+ * @param end
+ *            arc end x, y, z, m
+ * @param block
+ *            point block
+ */
+-(void) linearizeArcWithStart: (const double *) start andMiddle: (const double *) middle andEnd: (const double *) end usingBlock: (void (^)(const double *point)) block;
+
+/**
+ * Expand x and y bounds to include the arc from the start through the
+ * middle to the end point. Arcs bulge past their control points, so the
+ * bounds include each axis extreme of the circle swept by the arc.
+ *
+ * @param bounds
+ *            min x, min y, max x, max y to expand
+ * @param start
+ *            arc start x, y
+ * @param middle
+ *            arc middle x, y
+ * @param end
+ *            arc end x, y
+ */
++(void) expandBounds: (double *) bounds withArcStart: (const double *) start andMiddle: (const double *) middle andEnd: (const double *) end;
+
+@end
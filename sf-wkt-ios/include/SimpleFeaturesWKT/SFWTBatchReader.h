@@ -0,0 +1,82 @@
+//
+//  SFWTBatchReader.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+#import <SimpleFeaturesWKT/SFWTCompressedGeometryReader.h>
+#import <SimpleFeaturesWKT/SFWTFlatGeometry.h>
+#import <SimpleFeaturesWKT/SFWTReaderLimits.h>
+
+/**
+ * Error domain of errors returned by the batch reader
+ */
+extern NSString * const SFWT_ERROR_DOMAIN;
+
+/**
+ * Error user info key of the name of the exception raised while reading
+ */
+extern NSString * const SFWT_EXCEPTION_NAME_KEY;
+
+/**
+ * Well Known Text batch reader. Reads geometries in batches and returns
+ * errors in place of raised exceptions, for callers such as Swift that can
+ * not catch Objective-C exceptions. When an error interrupts a batch, the
+ * geometries read before it are returned and the error is returned by the
+ * next read.
+ */
+@interface SFWTBatchReader : NSObject
+
+/**
+ * Resource limits, nil for unlimited
+ */
+@property (nonatomic, strong) SFWTReaderLimits *limits;
+
+/**
+ * Initializer
+ *
+ * @param text
+ *            well-known text
+ */
+-(instancetype) initWithText: (NSString *) text;
+
+/**
+ * Initializer
+ *
+ * @param reader
+ *            compressed geometry reader
+ */
+-(instancetype) initWithCompressedReader: (SFWTCompressedGeometryReader *) reader;
+
+/**
+ * Read the next batch of non empty geometries
+ *
+ * @param count
+ *            max geometries to read
+ * @param error
+ *            error when the text is invalid or exceeds a limit
+ *
+ * @return geometries, empty at the end of the text, nil on error with no
+ *         geometries read
+ */
+-(NSArray<SFGeometry *> *) readBatchWithCount: (NSUInteger) count error: (NSError **) error;
+
+/**
+ * Read the next batch of non empty geometries as flat geometries sharing a
+ * new arena. Not supported by compressed readers.
+ *
+ * @param count
+ *            max geometries to read
+ * @param error
+ *            error when the text is invalid or exceeds a limit
+ *
+ * @return flat geometries, empty at the end of the text, nil on error
+ *         with no geometries read
+ */
+-(NSArray<SFWTFlatGeometry *> *) readFlatBatchWithCount: (NSUInteger) count error: (NSError **) error;
+
+@end
@@ -0,0 +1,82 @@
+//
+//  SFWTCompressedGeometryReader.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+#import <SimpleFeaturesWKT/SFWTCompressedGeometryWriter.h>
+#import <SimpleFeaturesWKT/SFWTReaderLimits.h>
+
+/**
+ * Compressed well-known text stream reader. gzip and zlib input is
+ * detected from the stream header and inflated with zlib, other input is
+ * read as uncompressed text. Text is inflated directly into the buffer
+ * fed to the tokenizer, which is cut after the last complete top level
+ * geometry and refilled as geometries are read, so memory is bounded by
+ * the buffer size and the largest geometry.
+ */
+@interface SFWTCompressedGeometryReader : NSObject
+
+/**
+ * Resource limits, nil for unlimited. The max bytes limit bounds the
+ * total decompressed text size.
+ */
+@property (nonatomic, strong) SFWTReaderLimits *limits;
+
+/**
+ * Minimum number of decompressed bytes tokenized at once
+ */
+@property (nonatomic) NSUInteger bufferSize;
+
+/**
+ * Create a reader of a file
+ *
+ * @param path
+ *            file path
+ *
+ * @return reader
+ */
++(SFWTCompressedGeometryReader *) readerWithPath: (NSString *) path;
+
+/**
+ * Initializer
+ *
+ * @param data
+ *            compressed or uncompressed well-known text
+ */
+-(instancetype) initWithData: (NSData *) data;
+
+/**
+ * Initializer
+ *
+ * @param stream
+ *            input stream, opened if not already open
+ */
+-(instancetype) initWithStream: (NSInputStream *) stream;
+
+/**
+ * Get the detected input format, available after the first read
+ *
+ * @return compression format
+ */
+-(SFWTCompressionFormat) format;
+
+/**
+ * Read the next non empty geometry
+ *
+ * @return geometry, nil at the end of the input
+ */
+-(SFGeometry *) read;
+
+/**
+ * Read all remaining non empty geometries
+ *
+ * @return geometries
+ */
+-(NSMutableArray<SFGeometry *> *) readAll;
+
+@end
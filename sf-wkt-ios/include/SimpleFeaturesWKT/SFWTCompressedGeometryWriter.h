@@ -0,0 +1,98 @@
+//
+//  SFWTCompressedGeometryWriter.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+
+/**
+ * Default compression stream buffer size
+ */
+#define SFWT_COMPRESSION_DEFAULT_BUFFER_SIZE 65536
+
+/**
+ * Compressed well-known text formats
+ */
+typedef NS_ENUM(NSInteger, SFWTCompressionFormat){
+    /** Uncompressed text */
+    SFWT_COMPRESSION_NONE,
+    /** gzip (RFC 1952) */
+    SFWT_COMPRESSION_GZIP,
+    /** zlib wrapped deflate (RFC 1950) */
+    SFWT_COMPRESSION_ZLIB
+};
+
+/**
+ * Compressed well-known text stream writer. Geometries are written by the
+ * SFWTGeometryWriter, one per line, and compressed with zlib as they are
+ * written.
+ */
+@interface SFWTCompressedGeometryWriter : NSObject
+
+/**
+ * Create a gzip writer to a file
+ *
+ * @param path
+ *            file path
+ *
+ * @return writer
+ */
++(SFWTCompressedGeometryWriter *) writerWithPath: (NSString *) path;
+
+/**
+ * Initializer, gzip with the default compression level
+ *
+ * @param stream
+ *            output stream, opened if not already open
+ */
+-(instancetype) initWithStream: (NSOutputStream *) stream;
+
+/**
+ * Initializer
+ *
+ * @param stream
+ *            output stream, opened if not already open
+ * @param format
+ *            compression format
+ * @param level
+ *            zlib compression level, 0 to 9 or -1 for the default
+ */
+-(instancetype) initWithStream: (NSOutputStream *) stream andFormat: (SFWTCompressionFormat) format andLevel: (int) level;
+
+/**
+ * Write a geometry followed by a new line
+ *
+ * @param geometry
+ *            geometry
+ */
+-(void) write: (SFGeometry *) geometry;
+
+/**
+ * Write well-known text as is
+ *
+ * @param text
+ *            text
+ */
+-(void) writeText: (NSString *) text;
+
+/**
+ * Write UTF-8 bytes as is
+ *
+ * @param bytes
+ *            bytes
+ * @param length
+ *            number of bytes
+ */
+-(void) writeBytes: (const uint8_t *) bytes length: (NSUInteger) length;
+
+/**
+ * Finish the compressed stream and close the output stream. Must be
+ * called to produce a complete compressed stream.
+ */
+-(void) close;
+
+@end
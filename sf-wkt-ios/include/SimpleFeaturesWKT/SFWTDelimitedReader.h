@@ -0,0 +1,143 @@
+//
+//  SFWTDelimitedReader.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeaturesWKT/SFWTDelimitedRecord.h>
+#import <SimpleFeaturesWKT/SFWTReaderLimits.h>
+
+/**
+ * Comma separated values delimiter
+ */
+#define SFWT_CSV_DELIMITER ','
+
+/**
+ * Tab separated values delimiter
+ */
+#define SFWT_TSV_DELIMITER '\t'
+
+/**
+ * Default number of rows read per batch
+ */
+#define SFWT_DELIMITED_DEFAULT_BATCH_SIZE 1024
+
+/**
+ * Delimited text (CSV, TSV) well-known text column reader. Locates the
+ * column field of each row in place within the UTF-8 bytes, handling RFC
+ * 4180 quoted fields, and reads geometries directly from the field bytes
+ * without creating field strings. Rows of a batch are read concurrently
+ * and returned in row order. Rows end with LF or CRLF; blank lines are
+ * skipped.
+ */
+@interface SFWTDelimitedReader : NSObject
+
+/**
+ * Resource limits applied per geometry, nil for unlimited
+ */
+@property (nonatomic, strong) SFWTReaderLimits *limits;
+
+/**
+ * Number of rows read per batch
+ */
+@property (nonatomic) NSUInteger batchSize;
+
+/**
+ * Read batch rows concurrently, true by default
+ */
+@property (nonatomic) BOOL concurrent;
+
+/**
+ * Create a reader of a memory mapped file
+ *
+ * @param path
+ *            file path
+ * @param delimiter
+ *            field delimiter
+ * @param column
+ *            zero based well-known text column
+ * @param header
+ *            true if the first row is a header row
+ * @param error
+ *            error when the file can not be read
+ *
+ * @return reader, nil on error
+ */
++(SFWTDelimitedReader *) readerWithPath: (NSString *) path andDelimiter: (uint8_t) delimiter andColumn: (NSUInteger) column andHeader: (BOOL) header error: (NSError **) error;
+
+/**
+ * Create a reader of a memory mapped file with a header row
+ *
+ * @param path
+ *            file path
+ * @param delimiter
+ *            field delimiter
+ * @param name
+ *            well-known text column header name
+ * @param error
+ *            error when the file can not be read
+ *
+ * @return reader, nil on error
+ */
++(SFWTDelimitedReader *) readerWithPath: (NSString *) path andDelimiter: (uint8_t) delimiter andColumnName: (NSString *) name error: (NSError **) error;
+
+/**
+ * Initializer
+ *
+ * @param data
+ *            delimited UTF-8 text
+ * @param delimiter
+ *            field delimiter
+ * @param column
+ *            zero based well-known text column
+ * @param header
+ *            true if the first row is a header row
+ */
+-(instancetype) initWithData: (NSData *) data andDelimiter: (uint8_t) delimiter andColumn: (NSUInteger) column andHeader: (BOOL) header;
+
+/**
+ * Initializer, the first row is a header row holding the column name. An
+ * "Invalid Column" exception is raised when the name is not found.
+ *
+ * @param data
+ *            delimited UTF-8 text
+ * @param delimiter
+ *            field delimiter
+ * @param name
+ *            well-known text column header name
+ */
+-(instancetype) initWithData: (NSData *) data andDelimiter: (uint8_t) delimiter andColumnName: (NSString *) name;
+
+/**
+ * Get the zero based well-known text column
+ *
+ * @return column
+ */
+-(NSUInteger) column;
+
+/**
+ * Read the next batch of rows
+ *
+ * @return records in row order, nil at the end of the text
+ */
+-(NSArray<SFWTDelimitedRecord *> *) readBatch;
+
+/**
+ * Read all remaining rows
+ *
+ * @return records in row order
+ */
+-(NSArray<SFWTDelimitedRecord *> *) readAll;
+
+/**
+ * Enumerate the remaining rows in row order, reading in batches
+ *
+ * @param block
+ *            record block, set stop to true to stop enumerating
+ */
+-(void) enumerateRecordsUsingBlock: (void (^)(SFWTDelimitedRecord *record, BOOL *stop)) block;
+
+@end
@@ -0,0 +1,37 @@
+//
+//  SFWTDelimitedRecord.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+
+/**
+ * Geometry read from a delimited text row
+ */
+@interface SFWTDelimitedRecord : NSObject
+
+/**
+ * Zero based data row, excluding the header row and blank lines
+ */
+@property (nonatomic, readonly) NSUInteger row;
+
+/**
+ * Geometry, nil for an empty field or empty geometry
+ */
+@property (nonatomic, strong, readonly) SFGeometry *geometry;
+
+/**
+ * Initializer
+ *
+ * @param row
+ *            data row
+ * @param geometry
+ *            geometry
+ */
+-(instancetype) initWithRow: (NSUInteger) row andGeometry: (SFGeometry *) geometry;
+
+@end
@@ -0,0 +1,177 @@
+//
+//  SFWTEventReader.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+#import <SimpleFeaturesWKT/SFWTReaderLimits.h>
+
+/**
+ * Well Known Text event types
+ */
+typedef NS_ENUM(NSInteger, SFWTEventType){
+    SFWT_EVENT_NONE,
+    SFWT_EVENT_START_GEOMETRY,
+    SFWT_EVENT_COORDINATE,
+    SFWT_EVENT_END_GEOMETRY
+};
+
+/**
+ * Well Known Text pull event reader. Reads the same grammar as the
+ * SFWTGeometryReader one event at a time without building geometry
+ * objects. Empty geometries produce no events, matching the nil
+ * geometries returned by the geometry reader.
+ */
+@interface SFWTEventReader : NSObject
+
+/**
+ * Resource limits, nil for unlimited
+ */
+@property (nonatomic, strong) SFWTReaderLimits *limits;
+
+/**
+ * Initializer
+ *
+ * @param text well-known text
+ */
+-(instancetype) initWithText: (NSString *) text;
+
+/**
+ * Initializer
+ *
+ * @param reader text reader
+ */
+-(instancetype) initWithReader: (SFTextReader *) reader;
+
+/**
+ * Get the text reader
+ *
+ * @return text reader
+ */
+-(SFTextReader *) textReader;
+
+/**
+ * Read the next event. After the end event of a top level geometry, the
+ * next event starts the following geometry in the text.
+ *
+ * @return event type, SFWT_EVENT_NONE at the end of the text
+ */
+-(SFWTEventType) next;
+
+/**
+ * Get the current event type
+ *
+ * @return event type
+ */
+-(SFWTEventType) eventType;
+
+/**
+ * Get the geometry type of the current start or end event, or of the
+ * geometry containing the current coordinate. Types are reported as
+ * written, including the abstract MultiCurve and MultiSurface types.
+ *
+ * @return geometry type
+ */
+-(SFGeometryType) geometryType;
+
+/**
+ * Has z values. The declared value on start events, the final value
+ * including untagged z coordinates on end events, and the coordinate
+ * value on coordinate events.
+ *
+ * @return true if has z values
+ */
+-(BOOL) hasZ;
+
+/**
+ * Has m values. The declared value on start events, the final value
+ * including untagged m coordinates on end events, and the coordinate
+ * value on coordinate events.
+ *
+ * @return true if has m values
+ */
+-(BOOL) hasM;
+
+/**
+ * Get the nesting depth of the current geometry, 1 for a top level
+ * geometry
+ *
+ * @return depth
+ */
+-(int) depth;
+
+/**
+ * Get the geometry type containing the current geometry, SF_NONE for a
+ * top level geometry
+ *
+ * @return containing geometry type
+ */
+-(SFGeometryType) containingType;
+
+/**
+ * Get the number of child geometries or coordinates on end events
+ *
+ * @return count
+ */
+-(int) count;
+
+/**
+ * Get the number of empty top level geometries passed over so far. Empty
+ * geometries produce no events.
+ *
+ * @return empty geometry count
+ */
+-(NSUInteger) numEmpty;
+
+/**
+ * Get the coordinate x value
+ *
+ * @return x
+ */
+-(double) x;
+
+/**
+ * Get the coordinate y value
+ *
+ * @return y
+ */
+-(double) y;
+
+/**
+ * Get the coordinate z value, NaN when not present
+ *
+ * @return z
+ */
+-(double) z;
+
+/**
+ * Get the coordinate m value, NaN when not present
+ *
+ * @return m
+ */
+-(double) m;
+
+/**
+ * Skip the remainder of the current geometry without reading its
+ * events. No end event is produced for the skipped geometry.
+ */
+-(void) skipGeometry;
+
+/**
+ * Determine if the geometry type is a valid member of the containing
+ * geometry type when read with a type tag
+ *
+ * @param geometryType
+ *            member geometry type
+ * @param containingType
+ *            containing geometry type
+ *
+ * @return true if allowed
+ */
++(BOOL) isType: (SFGeometryType) geometryType allowedInType: (SFGeometryType) containingType;
+
+@end
@@ -0,0 +1,200 @@
+//
+//  SFWTFlatGeometry.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+#import <SimpleFeaturesWKT/SFWTEventReader.h>
+#import <SimpleFeaturesWKT/SFWTGeometryArena.h>
+
+/**
+ * Flat node flag, z values declared by the geometry type tag
+ */
+#define SFWT_FLAT_DECLARED_Z 0x1
+
+/**
+ * Flat node flag, m values declared by the geometry type tag
+ */
+#define SFWT_FLAT_DECLARED_M 0x2
+
+/**
+ * Flat node flag, undeclared z or m values are missing from some
+ * coordinates and a presence mask follows the coordinates
+ */
+#define SFWT_FLAT_PARTIAL 0x4
+
+/**
+ * Flat coordinate presence mask bit, z value present
+ */
+#define SFWT_FLAT_PRESENT_Z 0x1
+
+/**
+ * Flat coordinate presence mask bit, m value present
+ */
+#define SFWT_FLAT_PRESENT_M 0x2
+
+/**
+ * Batched coordinate transform. Called with blocks of interleaved
+ * coordinates to transform in place: count coordinates of dimension
+ * values each, x y followed by z and/or m when present.
+ */
+typedef void (^SFWTCoordinateTransform)(double *coordinates, NSUInteger count, int dimension);
+
+/**
+ * Flat geometry node. Nodes are stored in pre-order: the first child of a
+ * node is at the next index and the next sibling is at the node index plus
+ * the subtree size. Coordinates of a node are stored contiguously with a
+ * stride of 2 plus 1 for z plus 1 for m, missing values are NaN. Nodes
+ * flagged SFWT_FLAT_PARTIAL follow their coordinates with a presence mask
+ * byte per coordinate, packed into whole doubles, distinguishing missing
+ * values from NaN values read from the text.
+ */
+typedef struct {
+    uint64_t coordinateOffset;
+    uint32_t numCoordinates;
+    uint32_t numChildren;
+    uint32_t subtreeSize;
+    int32_t geometryType;
+    uint8_t hasZ;
+    uint8_t hasM;
+    uint16_t flags;
+    uint32_t reserved;
+} SFWTFlatNode;
+
+/**
+ * Flat geometry backed by arena (or other externally owned) storage. Holds
+ * the geometry tree as a node array and a single coordinate array instead
+ * of an object graph. Geometry objects are only built when requested.
+ */
+@interface SFWTFlatGeometry : NSObject
+
+/**
+ * Initializer
+ *
+ * @param nodes
+ *            pre-order nodes, the first node is the root
+ * @param coordinates
+ *            coordinate values
+ * @param owner
+ *            owner of the node and coordinate memory, retained
+ */
+-(instancetype) initWithNodes: (const SFWTFlatNode *) nodes andCoordinates: (const double *) coordinates andOwner: (NSObject *) owner;
+
+/**
+ * Read the next geometry from the event reader into the arena
+ *
+ * @param eventReader
+ *            event reader
+ * @param arena
+ *            geometry arena
+ *
+ * @return flat geometry, nil at the end of the text
+ */
++(SFWTFlatGeometry *) flatGeometryWithEventReader: (SFWTEventReader *) eventReader andArena: (SFWTGeometryArena *) arena;
+
+/**
+ * Read the next geometry from the event reader into the arena, applying
+ * the transform to the arena coordinates in blocks of nodes sharing the
+ * same dimension
+ *
+ * @param eventReader
+ *            event reader
+ * @param arena
+ *            geometry arena
+ * @param transform
+ *            coordinate transform, nil for none
+ *
+ * @return flat geometry, nil at the end of the text
+ */
++(SFWTFlatGeometry *) flatGeometryWithEventReader: (SFWTEventReader *) eventReader andArena: (SFWTGeometryArena *) arena andTransform: (SFWTCoordinateTransform) transform;
+
+/**
+ * Get the number of coordinate array values stored for a node, including
+ * the presence mask of a partial node
+ *
+ * @param node
+ *            flat node
+ *
+ * @return value count
+ */
++(uint64_t) numValuesOfNode: (const SFWTFlatNode *) node;
+
+/**
+ * Get the geometry type as written in the text
+ *
+ * @return geometry type
+ */
+-(SFGeometryType) geometryType;
+
+/**
+ * Has z values
+ *
+ * @return true if has z values
+ */
+-(BOOL) hasZ;
+
+/**
+ * Has m values
+ *
+ * @return true if has m values
+ */
+-(BOOL) hasM;
+
+/**
+ * Get the number of child geometries (rings, members, ...)
+ *
+ * @return child count
+ */
+-(int) numGeometries;
+
+/**
+ * Get the child geometry at the index
+ *
+ * @param index
+ *            child index
+ *
+ * @return child flat geometry sharing the same storage
+ */
+-(SFWTFlatGeometry *) geometryAtIndex: (int) index;
+
+/**
+ * Get the number of points held directly by the geometry
+ *
+ * @return point count
+ */
+-(int) numPoints;
+
+/**
+ * Get the coordinate stride, 2 plus 1 for z plus 1 for m
+ *
+ * @return stride
+ */
+-(int) stride;
+
+/**
+ * Get the coordinates held directly by the geometry, numPoints * stride
+ * values
+ *
+ * @return coordinates
+ */
+-(const double *) coordinates;
+
+/**
+ * Get the root node
+ *
+ * @return node
+ */
+-(const SFWTFlatNode *) node;
+
+/**
+ * Build the geometry object, matching the geometry reader result
+ *
+ * @return geometry
+ */
+-(SFGeometry *) geometry;
+
+@end
@@ -0,0 +1,197 @@
+//
+//  SFWTFlatGeometryFile.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeaturesWKT/SFWTFlatGeometry.h>
+
+/**
+ * Flat geometry file magic
+ */
+#define SFWT_FLAT_FILE_MAGIC "SFWTFLAT"
+
+/**
+ * Flat geometry file version
+ */
+#define SFWT_FLAT_FILE_VERSION 2
+
+/**
+ * Flat geometry file header. All values are in host byte order, verified
+ * with the byte order mark.
+ */
+typedef struct {
+    char magic[8];
+    uint32_t version;
+    uint32_t byteOrderMark;
+    uint64_t numRecords;
+    uint64_t numNodes;
+    uint64_t numCoordinates;
+    uint64_t recordsOffset;
+    uint64_t nodesOffset;
+    uint64_t coordinatesOffset;
+} SFWTFlatFileHeader;
+
+/**
+ * Flat geometry file record, the pre-order node range of a geometry. Empty
+ * geometries have no nodes.
+ */
+typedef struct {
+    uint64_t firstNode;
+    uint64_t numNodes;
+} SFWTFlatFileRecord;
+
+/**
+ * Memory mapped flat geometry file. Written once from well-known text by
+ * the SFWTFlatGeometryFileWriter, the file holds a header, a record index,
+ * a flat node array and a single coordinate array, each 16 byte aligned.
+ * Loading maps the file without parsing; geometries are exposed as flat
+ * geometries over the mapped memory and only built as objects on request,
+ * matching the SFWTGeometryReader results.
+ */
+@interface SFWTFlatGeometryFile : NSObject
+
+/**
+ * Open a flat geometry file
+ *
+ * @param path
+ *            file path
+ * @param error
+ *            error output
+ *
+ * @return flat geometry file, nil on error
+ */
++(SFWTFlatGeometryFile *) fileWithPath: (NSString *) path error: (NSError **) error;
+
+/**
+ * Initializer
+ *
+ * @param data
+ *            flat geometry file data, typically mapped
+ */
+-(instancetype) initWithData: (NSData *) data;
+
+/**
+ * Get the number of geometry records
+ *
+ * @return record count
+ */
+-(NSUInteger) count;
+
+/**
+ * Get the flat geometry of a record, sharing the mapped memory
+ *
+ * @param index
+ *            record index
+ *
+ * @return flat geometry, nil for an empty geometry
+ */
+-(SFWTFlatGeometry *) flatGeometryAtIndex: (NSUInteger) index;
+
+/**
+ * Build the geometry of a record
+ *
+ * @param index
+ *            record index
+ *
+ * @return geometry, nil for an empty geometry
+ */
+-(SFGeometry *) geometryAtIndex: (NSUInteger) index;
+
+/**
+ * Get the total number of coordinate values in the file
+ *
+ * @return coordinate value count
+ */
+-(NSUInteger) numCoordinates;
+
+/**
+ * Get all coordinate values in the file, valid while the file is retained
+ *
+ * @return coordinate values
+ */
+-(const double *) coordinates;
+
+@end
+
+/**
+ * Flat geometry file writer. Parses well-known text once into flat
+ * geometries and writes the flat geometry file layout.
+ */
+@interface SFWTFlatGeometryFileWriter : NSObject
+
+/**
+ * Resource limits, nil for unlimited
+ */
+@property (nonatomic, strong) SFWTReaderLimits *limits;
+
+/**
+ * Write every geometry in the text to a flat geometry file, with empty
+ * records for empty geometries
+ *
+ * @param text
+ *            well-known text geometries
+ * @param path
+ *            file path
+ * @param error
+ *            error output
+ *
+ * @return true if written
+ */
++(BOOL) writeText: (NSString *) text toFile: (NSString *) path error: (NSError **) error;
+
+/**
+ * Initializer
+ */
+-(instancetype) init;
+
+/**
+ * Add a record for the geometry text, an empty record when the geometry is
+ * empty
+ *
+ * @param text
+ *            well-known text geometry
+ */
+-(void) addText: (NSString *) text;
+
+/**
+ * Add a record for every geometry in the text, an empty record for each
+ * empty geometry
+ *
+ * @param text
+ *            well-known text geometries
+ *
+ * @return number of records added
+ */
+-(NSUInteger) addAllText: (NSString *) text;
+
+/**
+ * Get the number of records added
+ *
+ * @return record count
+ */
+-(NSUInteger) count;
+
+/**
+ * Build the flat geometry file data
+ *
+ * @return file data
+ */
+-(NSData *) data;
+
+/**
+ * Write the flat geometry file
+ *
+ * @param path
+ *            file path
+ * @param error
+ *            error output
+ *
+ * @return true if written
+ */
+-(BOOL) writeToFile: (NSString *) path error: (NSError **) error;
+
+@end
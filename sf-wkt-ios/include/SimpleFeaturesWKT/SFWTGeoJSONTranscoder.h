@@ -0,0 +1,125 @@
+//
+//  SFWTGeoJSONTranscoder.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+#import <SimpleFeaturesWKT/SFWTEventReader.h>
+#import <SimpleFeaturesWKT/SFWTArcLinearizer.h>
+
+/**
+ * Circular arc handling when writing formats without curves
+ */
+typedef NS_ENUM(NSInteger, SFWTCurvePolicy){
+    SFWT_CURVE_LINEARIZE,
+    SFWT_CURVE_ERROR
+};
+
+/**
+ * Well Known Text to GeoJSON geometry transcoder. Parses the text and
+ * writes RFC 7946 geometry JSON in a single pass without building geometry
+ * objects. Positions include z values when present; m values are dropped.
+ *
+ * Types without a GeoJSON equivalent are mapped: Triangle and CurvePolygon
+ * to Polygon, CircularString and CompoundCurve to LineString, MultiCurve
+ * to MultiLineString, and PolyhedralSurface, TIN and MultiSurface to
+ * MultiPolygon. Circular arcs are linearized or raise an "Unsupported
+ * Geometry" exception per the curve policy. Empty geometries produce no
+ * output, matching the nil geometries returned by the geometry reader.
+ */
+@interface SFWTGeoJSONTranscoder : NSObject
+
+/**
+ * Circular arc policy, linearize by default
+ */
+@property (nonatomic) SFWTCurvePolicy curvePolicy;
+
+/**
+ * Arc linearizer used by the linearize curve policy
+ */
+@property (nonatomic, strong) SFWTArcLinearizer *linearizer;
+
+/**
+ * Resource limits, nil for unlimited
+ */
+@property (nonatomic, strong) SFWTReaderLimits *limits;
+
+/**
+ * Transcode well-known text to GeoJSON, linearizing circular arcs
+ *
+ * @param text
+ *            well-known text
+ *
+ * @return GeoJSON UTF-8 data, nil if empty
+ */
++(NSData *) geoJSONWithText: (NSString *) text;
+
+/**
+ * Transcode well-known text to a GeoJSON string, linearizing circular arcs
+ *
+ * @param text
+ *            well-known text
+ *
+ * @return GeoJSON, nil if empty
+ */
++(NSString *) geoJSONStringWithText: (NSString *) text;
+
+/**
+ * Initializer
+ *
+ * @param text
+ *            well-known text
+ */
+-(instancetype) initWithText: (NSString *) text;
+
+/**
+ * Initializer
+ *
+ * @param reader
+ *            text reader
+ */
+-(instancetype) initWithReader: (SFTextReader *) reader;
+
+/**
+ * Transcode the next non empty geometry
+ *
+ * @return GeoJSON UTF-8 data, nil at the end of the text
+ */
+-(NSData *) write;
+
+/**
+ * Transcode the next non empty geometry, appending to the data
+ *
+ * @param data
+ *            GeoJSON output
+ *
+ * @return true if a geometry was written, false at the end of the text
+ */
+-(BOOL) writeToData: (NSMutableData *) data;
+
+/**
+ * Transcode the next non empty geometry to an open output stream. Output
+ * is written in chunks as it is produced.
+ *
+ * @param stream
+ *            open output stream
+ *
+ * @return true if a geometry was written, false at the end of the text
+ */
+-(BOOL) writeToStream: (NSOutputStream *) stream;
+
+/**
+ * Get the GeoJSON type name a geometry type is written as
+ *
+ * @param geometryType
+ *            geometry type
+ *
+ * @return GeoJSON type name
+ */
++(NSString *) geoJSONTypeOfGeometryType: (SFGeometryType) geometryType;
+
+@end
@@ -0,0 +1,104 @@
+//
+//  SFWTGeometryArena.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * Default arena block size in bytes
+ */
+extern NSUInteger const SFWT_ARENA_DEFAULT_BLOCK_SIZE;
+
+/**
+ * Number of reusable scratch buffers held by an arena
+ */
+#define SFWT_ARENA_SCRATCH_BUFFERS 3
+
+/**
+ * Geometry arena. Batch allocates flat geometry storage in large blocks
+ * which are released together on reset or dealloc. An arena is not
+ * thread safe and should be used by a single reader at a time.
+ */
+@interface SFWTGeometryArena : NSObject
+
+/**
+ * Initializer, default block size
+ */
+-(instancetype) init;
+
+/**
+ * Initializer
+ *
+ * @param blockSize
+ *            block size in bytes
+ */
+-(instancetype) initWithBlockSize: (NSUInteger) blockSize;
+
+/**
+ * Allocate 16 byte aligned memory owned by the arena. Requests larger than
+ * the block size are given a dedicated block.
+ *
+ * @param size
+ *            size in bytes
+ *
+ * @return allocated memory
+ */
+-(void *) allocate: (NSUInteger) size;
+
+/**
+ * Get the number of bytes allocated since creation or the last reset
+ *
+ * @return allocated bytes
+ */
+-(NSUInteger) size;
+
+/**
+ * Get the number of bytes held in blocks
+ *
+ * @return capacity in bytes
+ */
+-(NSUInteger) capacity;
+
+/**
+ * Get the arena generation, incremented on each reset
+ *
+ * @return generation
+ */
+-(NSUInteger) generation;
+
+/**
+ * Get a reusable scratch buffer of at least the size, growing it while
+ * keeping its contents when needed. Scratch buffers hold temporary build
+ * state between allocations, are kept until dealloc and are not counted in
+ * the arena size.
+ *
+ * @param buffer
+ *            scratch buffer number, less than SFWT_ARENA_SCRATCH_BUFFERS
+ * @param size
+ *            minimum size in bytes
+ *
+ * @return scratch memory
+ */
+-(void *) scratch: (int) buffer withSize: (NSUInteger) size;
+
+/**
+ * Get the current size of a scratch buffer
+ *
+ * @param buffer
+ *            scratch buffer number, less than SFWT_ARENA_SCRATCH_BUFFERS
+ *
+ * @return size in bytes
+ */
+-(NSUInteger) scratchSize: (int) buffer;
+
+/**
+ * Release all allocations at once, retaining the first block for reuse.
+ * Flat geometries allocated before the reset become invalid.
+ */
+-(void) reset;
+
+@end
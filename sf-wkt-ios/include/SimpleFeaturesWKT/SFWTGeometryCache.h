@@ -0,0 +1,126 @@
+//
+//  SFWTGeometryCache.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+
+/**
+ * Default geometry cache size in bytes
+ */
+extern NSUInteger const SFWT_CACHE_DEFAULT_MAX_BYTES;
+
+/**
+ * Thread safe least recently used cache of geometries read from
+ * well-known text. Entries are keyed by a hash of the text content plus
+ * the filter instance and expected type, and evicted once the approximate
+ * size of the cached text and geometries exceeds the max bytes. Reads of
+ * uncached text parse outside of the cache lock.
+ */
+@interface SFWTGeometryCache : NSObject
+
+/**
+ * Max approximate bytes held by the cache
+ */
+@property (nonatomic, readonly) NSUInteger maxBytes;
+
+/**
+ * Return copies of cached geometries (default) instead of the shared
+ * instances. Shared geometries must not be modified.
+ */
+@property (atomic) BOOL copyResults;
+
+/**
+ * Initializer, default max bytes
+ */
+-(instancetype) init;
+
+/**
+ * Initializer
+ *
+ * @param maxBytes
+ *            max approximate bytes
+ */
+-(instancetype) initWithMaxBytes: (NSUInteger) maxBytes;
+
+/**
+ * Read a geometry from the well-known text, using the cached result when
+ * available
+ *
+ * @param text
+ *            well-known text
+ *
+ * @return geometry
+ */
+-(SFGeometry *) readGeometryWithText: (NSString *) text;
+
+/**
+ * Read a geometry from the well-known text, using the cached result when
+ * available
+ *
+ * @param text
+ *            well-known text
+ * @param filter
+ *            geometry filter, part of the cache key by instance
+ * @param expectedType
+ *            expected type
+ *
+ * @return geometry
+ */
+-(SFGeometry *) readGeometryWithText: (NSString *) text andFilter: (NSObject<SFGeometryFilter> *) filter andExpectedType: (Class) expectedType;
+
+/**
+ * Get the number of cached entries
+ *
+ * @return entry count
+ */
+-(NSUInteger) count;
+
+/**
+ * Get the approximate bytes held by the cache
+ *
+ * @return approximate bytes
+ */
+-(NSUInteger) bytes;
+
+/**
+ * Get the number of reads answered from the cache
+ *
+ * @return hit count
+ */
+-(NSUInteger) hits;
+
+/**
+ * Get the number of reads that parsed the text
+ *
+ * @return miss count
+ */
+-(NSUInteger) misses;
+
+/**
+ * Get the number of entries evicted to stay within the max bytes
+ *
+ * @return eviction count
+ */
+-(NSUInteger) evictions;
+
+/**
+ * Remove all cached entries, keeping the statistics
+ */
+-(void) removeAll;
+
+/**
+ * Compute the 64 bit content hash of well-known text used by the cache
+ *
+ * @param text
+ *            well-known text
+ *
+ * @return hash
+ */
++(uint64_t) hashOfText: (NSString *) text;
+
+@end
@@ -0,0 +1,125 @@
+//
+//  SFWTGeometryFingerprint.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+#import <SimpleFeaturesWKT/SFWTEventReader.h>
+
+/**
+ * 128 bit geometry fingerprint
+ */
+typedef struct {
+    uint64_t high;
+    uint64_t low;
+} SFWTFingerprint;
+
+/**
+ * Well Known Text geometry fingerprint. Hashes the geometry type,
+ * dimensions, structure and coordinate values from event reader events
+ * without building geometry objects, so texts differing only in case,
+ * whitespace, number formatting or dimension tag style produce the same
+ * fingerprint. Texts producing the same SFWTGeometryWriter output always
+ * share a fingerprint. Coordinate values are optionally snapped to a
+ * tolerance grid before hashing.
+ *
+ * Tolerance fingerprints compare grid cells, not distances. Values are
+ * snapped to round(value / tolerance), so two values closer than the
+ * tolerance may fall in different cells and fingerprint differently, while
+ * values up to one tolerance apart within a cell match.
+ *
+ * The class methods build a structural index and readers on every call.
+ * Reuse an instance to fingerprint many geometries of the same text.
+ */
+@interface SFWTGeometryFingerprint : NSObject
+
+/**
+ * Coordinate tolerance grid size, 0 to hash exact values. Equal
+ * fingerprints mean equal grid cells, not coordinates within the tolerance.
+ */
+@property (nonatomic) double tolerance;
+
+/**
+ * Resource limits, nil for unlimited
+ */
+@property (nonatomic, strong) SFWTReaderLimits *limits;
+
+/**
+ * Fingerprint the first non empty geometry of well-known text. Allocates
+ * an index and readers per call.
+ *
+ * @param text
+ *            well-known text
+ *
+ * @return fingerprint, zero if empty
+ */
++(SFWTFingerprint) fingerprintWithText: (NSString *) text;
+
+/**
+ * Fingerprint the first non empty geometry of well-known text with
+ * coordinates snapped to a tolerance grid. Allocates an index and readers
+ * per call.
+ *
+ * @param text
+ *            well-known text
+ * @param tolerance
+ *            tolerance grid size
+ *
+ * @return fingerprint, zero if empty
+ */
++(SFWTFingerprint) fingerprintWithText: (NSString *) text andTolerance: (double) tolerance;
+
+/**
+ * 64 bit hash of the first non empty geometry of well-known text.
+ * Allocates an index and readers per call.
+ *
+ * @param text
+ *            well-known text
+ *
+ * @return hash, zero if empty
+ */
++(uint64_t) hashWithText: (NSString *) text;
+
+/**
+ * Determine if two fingerprints are equal
+ *
+ * @param fingerprint1
+ *            first fingerprint
+ * @param fingerprint2
+ *            second fingerprint
+ *
+ * @return true if equal
+ */
++(BOOL) isFingerprint: (SFWTFingerprint) fingerprint1 equalToFingerprint: (SFWTFingerprint) fingerprint2;
+
+/**
+ * Initializer
+ *
+ * @param text
+ *            well-known text
+ */
+-(instancetype) initWithText: (NSString *) text;
+
+/**
+ * Initializer
+ *
+ * @param reader
+ *            text reader
+ */
+-(instancetype) initWithReader: (SFTextReader *) reader;
+
+/**
+ * Fingerprint the next non empty geometry
+ *
+ * @param fingerprint
+ *            fingerprint result
+ *
+ * @return true if a geometry was read, false at the end of the text
+ */
+-(BOOL) readFingerprint: (SFWTFingerprint *) fingerprint;
+
+@end
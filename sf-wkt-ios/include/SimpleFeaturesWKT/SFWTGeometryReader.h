@@ -8,13 +8,82 @@
 
 #import <Foundation/Foundation.h>
 #import <SimpleFeatures/SimpleFeatures.h>
+#import <SimpleFeaturesWKT/SFWTArcLinearizer.h>
 #import <SimpleFeaturesWKT/SFWTGeometryTypeInfo.h>
+#import <SimpleFeaturesWKT/SFWTReaderLimits.h>
+#import <SimpleFeaturesWKT/SFWTFlatGeometry.h>
+#import <SimpleFeaturesWKT/SFWTMemberEnumerator.h>
+#import <SimpleFeaturesWKT/SFWTValidationIssue.h>
+
+/**
+ * Dimension projection options applied while reading
+ */
+typedef NS_OPTIONS(NSUInteger, SFWTDimensionOptions){
+    SFWT_DIMENSIONS_NONE = 0,
+    SFWT_DIMENSIONS_DROP_Z = 1 << 0,
+    SFWT_DIMENSIONS_DROP_M = 1 << 1,
+    SFWT_DIMENSIONS_FORCE_2D = SFWT_DIMENSIONS_DROP_Z | SFWT_DIMENSIONS_DROP_M,
+    SFWT_DIMENSIONS_PAD_Z = 1 << 2,
+    SFWT_DIMENSIONS_PAD_M = 1 << 3
+};
 
 /**
  * Well Known Text reader
  */
 @interface SFWTGeometryReader : NSObject
 
+/**
+ * Resource limits, nil for unlimited. Exceeding a limit raises a
+ * SFWT_LIMIT_EXCEEDED exception.
+ */
+@property (nonatomic, strong) SFWTReaderLimits *limits;
+
+/**
+ * Geometry arena used by flat reads, created on first use when nil
+ */
+@property (nonatomic, strong) SFWTGeometryArena *arena;
+
+/**
+ * Dimension projection of read geometries. Dropped z and m values are
+ * skipped without being parsed. Padded dimensions are added with the pad
+ * value when missing, a pad replaces a drop of the same dimension.
+ */
+@property (nonatomic) SFWTDimensionOptions dimensionOptions;
+
+/**
+ * Value of padded z and m values, 0 by default
+ */
+@property (nonatomic) double padValue;
+
+/**
+ * Coordinate transform applied to parsed coordinates in blocks before
+ * points are created, nil for none. Each coordinate sequence is parsed into
+ * a coordinate buffer and transformed in runs sharing a dimension, so
+ * geometry filters, envelope filters and bounds see the transformed
+ * coordinates.
+ */
+@property (nonatomic, copy) SFWTCoordinateTransform transform;
+
+/**
+ * Arc linearizer, nil to read curves as written. When set, geometries read
+ * by type tag are segmented as they are parsed: circular strings and
+ * compound curves are read as line strings, curve polygons as polygons,
+ * multi curves as multi line strings and multi surfaces as multi polygons.
+ */
+@property (nonatomic, strong) SFWTArcLinearizer *linearizer;
+
+/**
+ * Validation rules checked inline as coordinates are read, none by
+ * default
+ */
+@property (nonatomic) SFWTValidationRules validationRules;
+
+/**
+ * Raise a SFWT_VALIDATION_FAILED exception on the first violation instead
+ * of collecting validation issues
+ */
+@property (nonatomic) BOOL validationFailFast;
+
 /**
  *  Read a geometry from well-known text
  *
@@ -55,6 +124,45 @@
  */
 +(SFGeometry *) readGeometryWithText: (NSString *) text andFilter: (NSObject<SFGeometryFilter> *) filter andExpectedType: (Class) expectedType;
 
+/**
+ *  Read a geometry from well-known text
+ *
+ *  @param text well-known text
+ *  @param limits reader resource limits
+ *
+ *  @return geometry
+ */
++(SFGeometry *) readGeometryWithText: (NSString *) text andLimits: (SFWTReaderLimits *) limits;
+
+/**
+ *  Read a geometry from well-known text when it may intersect the envelope
+ *
+ *  @param text well-known text
+ *  @param envelope query envelope
+ *
+ *  @return geometry, nil if empty or disjoint from the envelope
+ */
++(SFGeometry *) readGeometryWithText: (NSString *) text andEnvelope: (SFGeometryEnvelope *) envelope;
+
+/**
+ *  Read a flat geometry from well-known text into an arena
+ *
+ *  @param text well-known text
+ *  @param arena geometry arena
+ *
+ *  @return flat geometry, nil if empty
+ */
++(SFWTFlatGeometry *) readFlatGeometryWithText: (NSString *) text andArena: (SFWTGeometryArena *) arena;
+
+/**
+ *  Enumerate the members of a geometry in well-known text one at a time
+ *
+ *  @param text well-known text
+ *
+ *  @return member enumerator
+ */
++(SFWTMemberEnumerator *) memberEnumeratorWithText: (NSString *) text;
+
 /**
  * Initializer
  *
@@ -76,6 +184,21 @@
  */
 -(SFTextReader *) textReader;
 
+/**
+ * Get the validation rule violations found by the last read
+ *
+ * @return validation issues
+ */
+-(NSArray<SFWTValidationIssue *> *) validationIssues;
+
+/**
+ * Get the approximate bytes allocated by the last read, tracked while
+ * limits are set
+ *
+ * @return approximate allocated bytes
+ */
+-(NSUInteger) allocation;
+
 /**
  *  Read a geometry from the well-known text
  *
@@ -122,6 +245,99 @@
  */
 -(SFGeometry *) readWithFilter: (NSObject<SFGeometryFilter> *) filter inType: (SFGeometryType) containingType andExpectedType: (Class) expectedType;
 
+/**
+ *  Read a geometry from the well-known text when it may intersect the
+ *  envelope. Indexed text is first scanned for coordinates without
+ *  building objects: a coordinate within the envelope stops the scan and
+ *  the geometry is read, while a geometry whose bounds are disjoint is
+ *  skipped. Other text readers read the geometry and compare its envelope.
+ *
+ *  @param envelope query envelope
+ *
+ *  @return geometry, nil if empty or disjoint from the envelope
+ */
+-(SFGeometry *) readWithEnvelope: (SFGeometryEnvelope *) envelope;
+
+/**
+ *  Read a geometry from the well-known text when it may intersect the
+ *  envelope
+ *
+ *  @param filter geometry filter
+ *  @param envelope query envelope, nil to read all geometries
+ *  @param expectedType expected geometry class type
+ *
+ *  @return geometry, nil if empty or disjoint from the envelope
+ */
+-(SFGeometry *) readWithFilter: (NSObject<SFGeometryFilter> *) filter andEnvelope: (SFGeometryEnvelope *) envelope andExpectedType: (Class) expectedType;
+
+/**
+ *  Read all remaining geometries in the well-known text that may intersect
+ *  the envelope
+ *
+ *  @param envelope query envelope
+ *
+ *  @return geometries
+ */
+-(NSMutableArray<SFGeometry *> *) readAllWithEnvelope: (SFGeometryEnvelope *) envelope;
+
+/**
+ *  Skip the next geometry when indexed text coordinates show it is disjoint
+ *  from the envelope, otherwise leave the reader at the geometry
+ *
+ *  @param envelope query envelope
+ *
+ *  @return true if the geometry was skipped
+ */
+-(BOOL) skipDisjointWithEnvelope: (SFGeometryEnvelope *) envelope;
+
+/**
+ *  Read past the next geometry, computing its x and y bounds. Indexed text
+ *  is scanned without building objects.
+ *
+ *  @param bounds min x, min y, max x, max y output
+ *
+ *  @return true if bounds were read, false for a geometry without coordinates
+ */
+-(BOOL) readBounds: (double *) bounds;
+
+/**
+ *  Read the next non empty geometry from the well-known text into the
+ *  reader arena. The flat geometry remains valid until the arena is reset.
+ *
+ *  @return flat geometry, nil at the end of the text
+ */
+-(SFWTFlatGeometry *) readFlat;
+
+/**
+ *  Read the next non empty geometry from the well-known text into an arena
+ *
+ *  @param arena geometry arena
+ *
+ *  @return flat geometry, nil at the end of the text
+ */
+-(SFWTFlatGeometry *) readFlatWithArena: (SFWTGeometryArena *) arena;
+
+/**
+ *  Read a single member of a geometry from the current text position,
+ *  such as a point of a line string, a ring of a polygon or a geometry of
+ *  a collection
+ *
+ *  @param containingType containing geometry type
+ *  @param hasZ has z values
+ *  @param hasM has m values
+ *
+ *  @return member geometry, nil if empty
+ */
+-(SFGeometry *) readMemberInType: (SFGeometryType) containingType andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM;
+
+/**
+ *  Open the next geometry in the well-known text and enumerate its
+ *  members one at a time
+ *
+ *  @return member enumerator
+ */
+-(SFWTMemberEnumerator *) memberEnumerator;
+
 /**
  * Read the geometry type info
  *
@@ -483,6 +699,18 @@
  */
 +(SFWTGeometryTypeInfo *) readGeometryTypeWithReader: (SFTextReader *) reader;
 
+/**
+ *  Read a single member of a geometry
+ *
+ *  @param reader text reader
+ *  @param containingType containing geometry type
+ *  @param hasZ has z values
+ *  @param hasM has m values
+ *
+ *  @return member geometry, nil if empty
+ */
++(SFGeometry *) readMemberWithReader: (SFTextReader *) reader inType: (SFGeometryType) containingType andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM;
+
 /**
  *  Read a point
  *
@@ -805,4 +1033,48 @@
  */
 +(SFTriangle *) readTriangleWithReader: (SFTextReader *) reader andFilter: (NSObject<SFGeometryFilter> *) filter andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM;
 
+/**
+ * Read a left parenthesis or empty set
+ *
+ * @param reader
+ *            text reader
+ * @return true if not empty
+ */
++(BOOL) leftParenthesisOrEmpty: (SFTextReader *) reader;
+
+/**
+ * Read a comma or right parenthesis
+ *
+ * @param reader
+ *            text reader
+ * @return true if a comma
+ */
++(BOOL) commaOrRightParenthesis: (SFTextReader *) reader;
+
+/**
+ * Read a right parenthesis
+ *
+ * @param reader
+ *            text reader
+ */
++(void) rightParenthesis: (SFTextReader *) reader;
+
+/**
+ * Determine if the next token is either a left parenthesis or empty
+ *
+ * @param reader
+ *            text reader
+ * @return true if a left parenthesis or empty
+ */
++(BOOL) isLeftParenthesisOrEmpty: (SFTextReader *) reader;
+
+/**
+ * Determine if the next token is either a comma or right parenthesis
+ *
+ * @param reader
+ *            text reader
+ * @return true if a comma
+ */
++(BOOL) isCommaOrRightParenthesis: (SFTextReader *) reader;
+
 @end
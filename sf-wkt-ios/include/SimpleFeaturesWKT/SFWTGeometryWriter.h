@@ -9,6 +9,11 @@
 #import <Foundation/Foundation.h>
 #import <SimpleFeatures/SimpleFeatures.h>
 
+/**
+ * Minimum character buffer size for a formatted value
+ */
+#define SFWT_VALUE_BUFFER_SIZE 32
+
 /**
  * Well Known Text writer
  */
@@ -447,4 +452,16 @@
  */
 +(void) writeTriangle: (SFTriangle *) triangle toString: (NSMutableString *) string;
 
+/**
+ * Format a value as written to well-known text: the shortest of 15, 16 or
+ * 17 significant digits that round trips, NaN, infinity or -infinity
+ *
+ * @param value
+ *            value
+ * @param buffer
+ *            character buffer of at least SFWT_VALUE_BUFFER_SIZE
+ * @return number of characters written, excluding the null terminator
+ */
++(int) formatValue: (double) value toBuffer: (char *) buffer;
+
 @end
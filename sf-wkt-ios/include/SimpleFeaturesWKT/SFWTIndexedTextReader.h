@@ -0,0 +1,90 @@
+//
+//  SFWTIndexedTextReader.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+#import <SimpleFeaturesWKT/SFWTStructuralIndex.h>
+
+/**
+ * Text reader driven by a structural index. Tokens are located from the
+ * index instead of scanning characters, punctuation tokens are returned
+ * without allocation and numbers are parsed directly from the UTF-8 bytes.
+ */
+@interface SFWTIndexedTextReader : SFTextReader
+
+/**
+ * Create a text reader for the text, indexed when the text is ASCII (all
+ * valid well-known text) and a standard text reader otherwise
+ *
+ * @param text
+ *            well-known text
+ *
+ * @return text reader
+ */
++(SFTextReader *) readerWithText: (NSString *) text;
+
+/**
+ * Initializer
+ *
+ * @param text
+ *            well-known text
+ */
+-(instancetype) initWithText: (NSString *) text;
+
+/**
+ * Initializer
+ *
+ * @param index
+ *            structural index of the text
+ * @param text
+ *            well-known text
+ */
+-(instancetype) initWithIndex: (SFWTStructuralIndex *) index andText: (NSString *) text;
+
+/**
+ * Get the structural index
+ *
+ * @return structural index
+ */
+-(SFWTStructuralIndex *) index;
+
+/**
+ * Get the structural index of the next token
+ *
+ * @return token position
+ */
+-(NSUInteger) position;
+
+/**
+ * Get the byte offset of the next token
+ *
+ * @return byte offset, the text length at the end of the text
+ */
+-(NSUInteger) offset;
+
+/**
+ * Seek to the structural index of a token
+ *
+ * @param position
+ *            token position
+ */
+-(void) seek: (NSUInteger) position;
+
+/**
+ * Peek at the first character of the next token without reading it
+ *
+ * @return character, 0 at the end of the text
+ */
+-(uint8_t) peekCharacter;
+
+/**
+ * Read past the next token
+ */
+-(void) skipToken;
+
+@end
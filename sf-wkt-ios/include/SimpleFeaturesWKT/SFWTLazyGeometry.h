@@ -0,0 +1,106 @@
+//
+//  SFWTLazyGeometry.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+#import <SimpleFeaturesWKT/SFWTStructuralIndex.h>
+
+/**
+ * Lazy geometry over unparsed well-known text. The geometry type,
+ * dimensions and member count are available immediately from the text
+ * structural index. Members (points, rings, polygons, collection
+ * geometries, ...) are parsed only when accessed and then cached. Text
+ * with non ASCII characters can not be tokenized by the structural index
+ * and is parsed in full when created. Not thread safe.
+ */
+@interface SFWTLazyGeometry : NSObject
+
+/**
+ * Create a lazy geometry from well-known text
+ *
+ * @param text
+ *            well-known text
+ *
+ * @return lazy geometry, nil if empty
+ */
++(SFWTLazyGeometry *) lazyGeometryWithText: (NSString *) text;
+
+/**
+ * Create a lazy geometry from a structural index
+ *
+ * @param index
+ *            structural index
+ * @param text
+ *            well-known text of the index
+ *
+ * @return lazy geometry, nil if empty
+ */
++(SFWTLazyGeometry *) lazyGeometryWithIndex: (SFWTStructuralIndex *) index andText: (NSString *) text;
+
+/**
+ * Get the geometry type as written in the text, or implied by the
+ * containing geometry for untagged members
+ *
+ * @return geometry type
+ */
+-(SFGeometryType) geometryType;
+
+/**
+ * Has z values as declared by the geometry type tag
+ *
+ * @return true if has z values
+ */
+-(BOOL) hasZ;
+
+/**
+ * Has m values as declared by the geometry type tag
+ *
+ * @return true if has m values
+ */
+-(BOOL) hasM;
+
+/**
+ * Get the number of members: points of a point, line string or circular
+ * string; rings of a polygon; line strings, polygons or points of a
+ * multi geometry; and geometries of a collection
+ *
+ * @return member count
+ */
+-(int) numMembers;
+
+/**
+ * Parse the member at the index, cached after the first access
+ *
+ * @param index
+ *            member index
+ *
+ * @return member geometry, nil if empty
+ */
+-(SFGeometry *) memberAtIndex: (int) index;
+
+/**
+ * Get a lazy geometry of the member at the index, such as ring k of
+ * polygon n, cached after the first access. Coordinate members of points,
+ * line strings, circular strings and multi points are point lazy
+ * geometries with a single member.
+ *
+ * @param index
+ *            member index
+ *
+ * @return lazy member geometry, nil if empty
+ */
+-(SFWTLazyGeometry *) lazyMemberAtIndex: (int) index;
+
+/**
+ * Parse the full geometry, cached after the first access
+ *
+ * @return geometry
+ */
+-(SFGeometry *) geometry;
+
+@end
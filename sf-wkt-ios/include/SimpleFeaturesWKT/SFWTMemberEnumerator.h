@@ -0,0 +1,73 @@
+//
+//  SFWTMemberEnumerator.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+
+/**
+ * Pull based enumerator over the members of a well-known text geometry.
+ * Opens a collection (or any multi or composite geometry) and parses one
+ * member at a time, so memory stays constant regardless of the member
+ * count. Empty members are skipped. Supports NSFastEnumeration through
+ * NSEnumerator.
+ */
+@interface SFWTMemberEnumerator : NSEnumerator<SFGeometry *>
+
+/**
+ * Initializer
+ *
+ * @param text
+ *            well-known text
+ */
+-(instancetype) initWithText: (NSString *) text;
+
+/**
+ * Initializer, reads the geometry type and opening parenthesis from the
+ * current text reader position
+ *
+ * @param reader
+ *            text reader
+ */
+-(instancetype) initWithReader: (SFTextReader *) reader;
+
+/**
+ * Get the geometry type of the enumerated geometry
+ *
+ * @return geometry type, SF_NONE if empty
+ */
+-(SFGeometryType) geometryType;
+
+/**
+ * Has z values as declared by the geometry type tag
+ *
+ * @return true if has z values
+ */
+-(BOOL) hasZ;
+
+/**
+ * Has m values as declared by the geometry type tag
+ *
+ * @return true if has m values
+ */
+-(BOOL) hasM;
+
+/**
+ * Get the number of members read so far, including empty members
+ *
+ * @return member count
+ */
+-(int) count;
+
+/**
+ * Parse the next non empty member
+ *
+ * @return member geometry, nil when all members have been read
+ */
+-(SFGeometry *) nextObject;
+
+@end
@@ -0,0 +1,153 @@
+//
+//  SFWTQuantizedReader.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+#import <SimpleFeaturesWKT/SFWTEventReader.h>
+
+/**
+ * Quantized integer coordinate width
+ */
+typedef NS_ENUM(NSInteger, SFWTQuantizedWidth){
+    SFWT_QUANTIZED_INT32,
+    SFWT_QUANTIZED_INT64
+};
+
+/**
+ * Well Known Text quantized coordinate reader. Parses the text and writes
+ * x and y coordinates straight into int32_t or int64_t buffers without
+ * building geometry objects. Each coordinate is quantized as
+ * round((value - offset) * scale). Z and m values are parsed but not
+ * written.
+ *
+ * Coordinates are written as interleaved x, y pairs. Each coordinate
+ * sequence (point, line string, ring) is a part, with its point count
+ * written as a uint32_t to the part counts buffer. Only geometries whose
+ * parts are unambiguous as a flat list are supported: points, line
+ * strings, polygons, triangles, multi points and multi line strings.
+ * Other geometry types are skipped and raise an exception.
+ */
+@interface SFWTQuantizedReader : NSObject
+
+/**
+ * X scale, 1 by default
+ */
+@property (nonatomic) double scaleX;
+
+/**
+ * Y scale, 1 by default
+ */
+@property (nonatomic) double scaleY;
+
+/**
+ * X offset, subtracted before scaling
+ */
+@property (nonatomic) double offsetX;
+
+/**
+ * Y offset, subtracted before scaling
+ */
+@property (nonatomic) double offsetY;
+
+/**
+ * Integer width of the written coordinates, int32_t by default
+ */
+@property (nonatomic) SFWTQuantizedWidth width;
+
+/**
+ * Drop consecutive duplicate points within a part after quantization
+ */
+@property (nonatomic) BOOL dropDuplicates;
+
+/**
+ * Resource limits, nil for unlimited
+ */
+@property (nonatomic, strong) SFWTReaderLimits *limits;
+
+/**
+ * Initializer
+ *
+ * @param text
+ *            well-known text
+ */
+-(instancetype) initWithText: (NSString *) text;
+
+/**
+ * Initializer
+ *
+ * @param reader
+ *            text reader
+ */
+-(instancetype) initWithReader: (SFTextReader *) reader;
+
+/**
+ * Set the same scale for x and y with offsets
+ *
+ * @param scale
+ *            x and y scale
+ * @param offsetX
+ *            x offset
+ * @param offsetY
+ *            y offset
+ */
+-(void) setScale: (double) scale andOffsetX: (double) offsetX andOffsetY: (double) offsetY;
+
+/**
+ * Set the scale and offsets to map the envelope onto an integer grid of
+ * 0 through extent in x and y
+ *
+ * @param envelope
+ *            grid envelope
+ * @param extent
+ *            grid extent
+ */
+-(void) setGridWithEnvelope: (SFGeometryEnvelope *) envelope andExtent: (int64_t) extent;
+
+/**
+ * Read the next non empty geometry, appending its quantized coordinates
+ * and part point counts. Unsupported geometry types are skipped and
+ * raise an exception, after which reading may continue.
+ *
+ * @param coordinates
+ *            quantized coordinate output
+ * @param counts
+ *            part point count output
+ *
+ * @return true if a geometry was read, false at the end of the text
+ */
+-(BOOL) readToCoordinates: (NSMutableData *) coordinates andCounts: (NSMutableData *) counts;
+
+/**
+ * Get the geometry type of the last read geometry, as written
+ *
+ * @return geometry type
+ */
+-(SFGeometryType) geometryType;
+
+/**
+ * Get the number of parts written for the last read geometry
+ *
+ * @return part count
+ */
+-(int) numParts;
+
+/**
+ * Get the number of points written for the last read geometry
+ *
+ * @return point count
+ */
+-(NSUInteger) numPoints;
+
+/**
+ * Get the number of duplicate points dropped from the last read geometry
+ *
+ * @return dropped point count
+ */
+-(NSUInteger) numDropped;
+
+@end
@@ -0,0 +1,145 @@
+//
+//  SFWTReaderLimits.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * Exception name raised when a reader limit is exceeded
+ */
+extern NSString * const SFWT_LIMIT_EXCEEDED;
+
+/**
+ * Well Known Text reader resource limits. Bounds the work and memory a
+ * single read can consume. A limit value of 0 is unlimited.
+ */
+@interface SFWTReaderLimits : NSObject
+
+/**
+ * Maximum geometry nesting depth, 1 for a single non collection geometry
+ */
+@property (nonatomic) int maxDepth;
+
+/**
+ * Maximum number of coordinates (points) read per geometry
+ */
+@property (nonatomic) NSUInteger maxCoordinates;
+
+/**
+ * Maximum well-known text input size in bytes per geometry record. Text
+ * that is not structurally indexed (non-ASCII) is checked as a whole.
+ */
+@property (nonatomic) NSUInteger maxBytes;
+
+/**
+ * Maximum approximate number of bytes allocated per geometry
+ */
+@property (nonatomic) NSUInteger maxAllocation;
+
+/**
+ * Create unlimited reader limits
+ *
+ * @return reader limits
+ */
++(SFWTReaderLimits *) limits;
+
+/**
+ * Create reader limits
+ *
+ * @param maxDepth
+ *            max nesting depth
+ * @param maxCoordinates
+ *            max coordinates
+ * @param maxBytes
+ *            max input bytes per geometry
+ * @param maxAllocation
+ *            max approximate allocation bytes
+ *
+ * @return reader limits
+ */
++(SFWTReaderLimits *) limitsWithMaxDepth: (int) maxDepth andMaxCoordinates: (NSUInteger) maxCoordinates andMaxBytes: (NSUInteger) maxBytes andMaxAllocation: (NSUInteger) maxAllocation;
+
+/**
+ * Initializer, unlimited
+ */
+-(instancetype) init;
+
+/**
+ * Initializer
+ *
+ * @param maxDepth
+ *            max nesting depth
+ * @param maxCoordinates
+ *            max coordinates
+ * @param maxBytes
+ *            max input bytes per geometry
+ * @param maxAllocation
+ *            max approximate allocation bytes
+ */
+-(instancetype) initWithMaxDepth: (int) maxDepth andMaxCoordinates: (NSUInteger) maxCoordinates andMaxBytes: (NSUInteger) maxBytes andMaxAllocation: (NSUInteger) maxAllocation;
+
+/**
+ * Verify the nesting depth is within the limit
+ *
+ * @param depth
+ *            current nesting depth
+ */
+-(void) checkDepth: (int) depth;
+
+/**
+ * Verify the coordinate count is within the limit
+ *
+ * @param coordinates
+ *            coordinates read
+ */
+-(void) checkCoordinates: (NSUInteger) coordinates;
+
+/**
+ * Verify the text size is within the limit
+ *
+ * @param text
+ *            well-known text
+ */
+-(void) checkText: (NSString *) text;
+
+/**
+ * Verify the byte count is within the limit
+ *
+ * @param bytes
+ *            input bytes
+ */
+-(void) checkBytes: (NSUInteger) bytes;
+
+/**
+ * Verify the approximate allocation is within the limit
+ *
+ * @param allocation
+ *            approximate allocated bytes
+ */
+-(void) checkAllocation: (NSUInteger) allocation;
+
+/**
+ * Approximate bytes allocated for a point
+ *
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ *
+ * @return approximate bytes
+ */
++(NSUInteger) pointAllocationWithHasZ: (BOOL) hasZ andHasM: (BOOL) hasM;
+
+/**
+ * Approximate bytes allocated for a geometry container (line string,
+ * polygon, collection, ...) excluding its points and children
+ *
+ * @return approximate bytes
+ */
++(NSUInteger) containerAllocation;
+
+@end
@@ -0,0 +1,133 @@
+//
+//  SFWTSpatialIndex.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+
+/**
+ * Default spatial index node capacity
+ */
+extern int const SFWT_SPATIAL_INDEX_DEFAULT_NODE_CAPACITY;
+
+/**
+ * Spatial index of the geometries in a well-known text file. Built in one
+ * scan of the text without building geometry objects, each geometry's x
+ * and y bounds and character range are packed into a Sort-Tile-Recursive
+ * (STR) R-tree. Queries return the geometries whose bounds intersect an
+ * envelope, reading only those records. The index can be saved as a
+ * sidecar file and loaded in later runs.
+ */
+@interface SFWTSpatialIndex : NSObject
+
+/**
+ * Build a spatial index of the well-known text geometries
+ *
+ * @param text
+ *            well-known text geometries
+ *
+ * @return spatial index
+ */
++(SFWTSpatialIndex *) indexWithText: (NSString *) text;
+
+/**
+ * Load a spatial index sidecar file
+ *
+ * @param path
+ *            file path
+ * @param error
+ *            error output
+ *
+ * @return spatial index, nil on error
+ */
++(SFWTSpatialIndex *) indexWithPath: (NSString *) path error: (NSError **) error;
+
+/**
+ * Initializer
+ *
+ * @param text
+ *            well-known text geometries
+ * @param nodeCapacity
+ *            max children per tree node
+ */
+-(instancetype) initWithText: (NSString *) text andNodeCapacity: (int) nodeCapacity;
+
+/**
+ * Initializer
+ *
+ * @param data
+ *            spatial index data
+ */
+-(instancetype) initWithData: (NSData *) data;
+
+/**
+ * Get the number of indexed (non empty) geometries
+ *
+ * @return indexed geometry count
+ */
+-(NSUInteger) count;
+
+/**
+ * Get the length of the indexed text
+ *
+ * @return text length
+ */
+-(NSUInteger) textLength;
+
+/**
+ * Get the record numbers, the zero based positions of the geometries in
+ * the text, whose bounds intersect the envelope
+ *
+ * @param envelope
+ *            query envelope
+ *
+ * @return record numbers
+ */
+-(NSIndexSet *) recordsIntersectingEnvelope: (SFGeometryEnvelope *) envelope;
+
+/**
+ * Get the text range of an indexed record
+ *
+ * @param record
+ *            record number
+ *
+ * @return text range, NSNotFound location if not indexed
+ */
+-(NSRange) rangeOfRecord: (NSUInteger) record;
+
+/**
+ * Read the geometries whose bounds intersect the envelope, in text order
+ *
+ * @param envelope
+ *            query envelope
+ * @param text
+ *            indexed well-known text
+ *
+ * @return geometries
+ */
+-(NSArray<SFGeometry *> *) geometriesIntersectingEnvelope: (SFGeometryEnvelope *) envelope inText: (NSString *) text;
+
+/**
+ * Get the spatial index data
+ *
+ * @return spatial index data
+ */
+-(NSData *) data;
+
+/**
+ * Write the spatial index sidecar file
+ *
+ * @param path
+ *            file path
+ * @param error
+ *            error output
+ *
+ * @return true if written
+ */
+-(BOOL) writeToFile: (NSString *) path error: (NSError **) error;
+
+@end
@@ -0,0 +1,132 @@
+//
+//  SFWTStructuralIndex.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * Well Known Text structural index. A single vectorized pass (AVX2 or
+ * SSE2 on x86, NEON on ARM, scalar otherwise) over the UTF-8 bytes records
+ * the position of every token start: each '(', ')', ',' or other
+ * punctuation character and the first character of each word (geometry
+ * type, dimension or number).
+ */
+@interface SFWTStructuralIndex : NSObject
+
+/**
+ * Initializer
+ *
+ * @param text
+ *            well-known text
+ */
+-(instancetype) initWithText: (NSString *) text;
+
+/**
+ * Initializer, indexing the bytes in place. The data is retained, not
+ * copied, and must not be mutated while the index is in use.
+ *
+ * @param data
+ *            well-known text UTF-8 bytes
+ */
+-(instancetype) initWithData: (NSData *) data;
+
+/**
+ * Get the indexed bytes, not null terminated
+ *
+ * @return bytes
+ */
+-(const uint8_t *) bytes;
+
+/**
+ * Get the number of indexed bytes
+ *
+ * @return byte length
+ */
+-(NSUInteger) length;
+
+/**
+ * Determine if the indexed bytes are all ASCII
+ *
+ * @return true if ASCII
+ */
+-(BOOL) isASCII;
+
+/**
+ * Get the number of structural positions (tokens)
+ *
+ * @return count
+ */
+-(NSUInteger) count;
+
+/**
+ * Get the structural byte positions in increasing order
+ *
+ * @return positions
+ */
+-(const uint32_t *) positions;
+
+/**
+ * Get the byte position of a structural index
+ *
+ * @param index
+ *            structural index
+ *
+ * @return byte position
+ */
+-(NSUInteger) positionAtIndex: (NSUInteger) index;
+
+/**
+ * Get the byte at a structural index, the first character of the token
+ *
+ * @param index
+ *            structural index
+ *
+ * @return byte
+ */
+-(uint8_t) characterAtIndex: (NSUInteger) index;
+
+/**
+ * Find the structural index of the ')' closing the '(' at the index
+ *
+ * @param index
+ *            structural index of a '('
+ *
+ * @return closing structural index, NSNotFound if unbalanced
+ */
+-(NSUInteger) closingIndexOf: (NSUInteger) index;
+
+/**
+ * Count the comma separated members within the '(' at the index, such as
+ * the points of a line string or the rings of a polygon, without parsing
+ *
+ * @param index
+ *            structural index of a '('
+ *
+ * @return member count
+ */
+-(int) countMembersAtIndex: (NSUInteger) index;
+
+/**
+ * Count the coordinates (innermost comma separated members) within the
+ * '(' at the index without parsing
+ *
+ * @param index
+ *            structural index of a '('
+ *
+ * @return coordinate count
+ */
+-(int) countCoordinatesAtIndex: (NSUInteger) index;
+
+/**
+ * Get the name of the scan implementation in use: "AVX2", "SSE2",
+ * "NEON" or "Scalar"
+ *
+ * @return implementation name
+ */
++(NSString *) implementation;
+
+@end
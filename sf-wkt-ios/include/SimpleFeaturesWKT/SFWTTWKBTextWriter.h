@@ -0,0 +1,39 @@
+//
+//  SFWTTWKBTextWriter.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * Tiny Well Known Binary (TWKB) to Well Known Text transcoder. Decodes the
+ * varint deltas in a single pass and writes text with the same formatting
+ * rules as the SFWTGeometryWriter without creating geometry objects.
+ * Bounding boxes, sizes and id lists are skipped.
+ */
+@interface SFWTTWKBTextWriter : NSObject
+
+/**
+ * Transcode TWKB to well-known text
+ *
+ * @param twkb
+ *            TWKB
+ *
+ * @return well-known text
+ */
++(NSString *) textWithTWKB: (NSData *) twkb;
+
+/**
+ * Transcode TWKB, appending the well-known text
+ *
+ * @param twkb
+ *            TWKB
+ * @param string
+ *            mutable string
+ */
++(void) writeTWKB: (NSData *) twkb toString: (NSMutableString *) string;
+
+@end
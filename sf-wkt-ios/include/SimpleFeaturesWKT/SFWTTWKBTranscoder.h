@@ -0,0 +1,118 @@
+//
+//  SFWTTWKBTranscoder.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+#import <SimpleFeaturesWKT/SFWTEventReader.h>
+
+/**
+ * Default TWKB x and y decimal precision
+ */
+extern int const SFWT_TWKB_DEFAULT_PRECISION;
+
+/**
+ * Well Known Text to Tiny Well Known Binary (TWKB) transcoder. Parses the
+ * text and writes TWKB in a single pass without building geometry
+ * objects: coordinates are quantized to the decimal precisions and written
+ * as zigzag varint deltas from the previous coordinate. Varint counts are
+ * inserted ahead of each geometry's content when it ends.
+ *
+ * Triangle maps to Polygon, MultiCurve to MultiLineString, and
+ * PolyhedralSurface, TIN and MultiSurface to MultiPolygon. Circular
+ * arcs and other members without a TWKB equivalent raise an "Unsupported
+ * Geometry" exception. The dimensions of each TWKB geometry are taken from
+ * its declaration or first coordinate and must be consistent.
+ */
+@interface SFWTTWKBTranscoder : NSObject
+
+/**
+ * X and y decimal precision, -7 through 7, 6 by default
+ */
+@property (nonatomic) int precision;
+
+/**
+ * Z decimal precision, 0 through 7
+ */
+@property (nonatomic) int precisionZ;
+
+/**
+ * M decimal precision, 0 through 7
+ */
+@property (nonatomic) int precisionM;
+
+/**
+ * Resource limits, nil for unlimited
+ */
+@property (nonatomic, strong) SFWTReaderLimits *limits;
+
+/**
+ * Transcode well-known text to TWKB with the default precision
+ *
+ * @param text
+ *            well-known text
+ *
+ * @return TWKB, nil if empty
+ */
++(NSData *) twkbWithText: (NSString *) text;
+
+/**
+ * Transcode well-known text to TWKB
+ *
+ * @param text
+ *            well-known text
+ * @param precision
+ *            x and y decimal precision
+ *
+ * @return TWKB, nil if empty
+ */
++(NSData *) twkbWithText: (NSString *) text andPrecision: (int) precision;
+
+/**
+ * Initializer
+ *
+ * @param text
+ *            well-known text
+ */
+-(instancetype) initWithText: (NSString *) text;
+
+/**
+ * Initializer
+ *
+ * @param reader
+ *            text reader
+ */
+-(instancetype) initWithReader: (SFTextReader *) reader;
+
+/**
+ * Transcode the next non empty geometry
+ *
+ * @return TWKB, nil at the end of the text
+ */
+-(NSData *) write;
+
+/**
+ * Transcode the next non empty geometry, appending to the data
+ *
+ * @param data
+ *            TWKB output
+ *
+ * @return true if a geometry was written, false at the end of the text
+ */
+-(BOOL) writeToData: (NSMutableData *) data;
+
+/**
+ * Get the TWKB geometry type code
+ *
+ * @param geometryType
+ *            geometry type
+ *
+ * @return TWKB type code, 0 when not supported
+ */
++(int) codeOfGeometryType: (SFGeometryType) geometryType;
+
+@end
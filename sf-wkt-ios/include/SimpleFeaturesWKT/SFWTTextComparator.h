@@ -0,0 +1,101 @@
+//
+//  SFWTTextComparator.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+#import <SimpleFeaturesWKT/SFWTEventReader.h>
+#import <SimpleFeaturesWKT/SFWTTextDifference.h>
+
+/**
+ * Well Known Text comparator. Reads two texts in lockstep with event
+ * readers and stops at the first difference, without building geometry
+ * objects. Memory grows only with the geometry nesting depth. Geometries
+ * are compared as read by the SFWTGeometryReader, so case, whitespace,
+ * number formatting and dimension tag style differences are ignored and
+ * MultiCurve and MultiSurface compare as GeometryCollection.
+ */
+@interface SFWTTextComparator : NSObject
+
+/**
+ * Maximum allowed coordinate value difference, 0 for exact values
+ */
+@property (nonatomic) double delta;
+
+/**
+ * Resource limits applied to both texts, nil for unlimited
+ */
+@property (nonatomic, strong) SFWTReaderLimits *limits;
+
+/**
+ * Find the first difference between well-known texts
+ *
+ * @param expected
+ *            expected well-known text
+ * @param actual
+ *            actual well-known text
+ * @param delta
+ *            maximum coordinate value difference
+ *
+ * @return first difference, nil if equal
+ */
++(SFWTTextDifference *) differenceWithExpected: (NSString *) expected andActual: (NSString *) actual andDelta: (double) delta;
+
+/**
+ * Determine if well-known texts are equal within a coordinate delta
+ *
+ * @param expected
+ *            expected well-known text
+ * @param actual
+ *            actual well-known text
+ * @param delta
+ *            maximum coordinate value difference
+ *
+ * @return true if equal
+ */
++(BOOL) isEqualWithExpected: (NSString *) expected andActual: (NSString *) actual andDelta: (double) delta;
+
+/**
+ * Initializer
+ *
+ * @param expected
+ *            expected well-known text
+ * @param actual
+ *            actual well-known text
+ */
+-(instancetype) initWithExpected: (NSString *) expected andActual: (NSString *) actual;
+
+/**
+ * Initializer
+ *
+ * @param expected
+ *            expected text reader
+ * @param actual
+ *            actual text reader
+ */
+-(instancetype) initWithExpectedReader: (SFTextReader *) expected andActualReader: (SFTextReader *) actual;
+
+/**
+ * Compare the remaining geometries of both texts, stopping at the first
+ * difference
+ *
+ * @return first difference, nil if equal
+ */
+-(SFWTTextDifference *) compare;
+
+/**
+ * Get the path name of a member within a geometry type, for example
+ * "ring" within a polygon
+ *
+ * @param geometryType
+ *            containing geometry type
+ *
+ * @return member name
+ */
++(NSString *) memberNameInType: (SFGeometryType) geometryType;
+
+@end
@@ -0,0 +1,65 @@
+//
+//  SFWTTextDifference.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * Well Known Text difference types
+ */
+typedef NS_ENUM(NSInteger, SFWTDifferenceType){
+    /** Different geometry types */
+    SFWT_DIFFERENCE_TYPE,
+    /** Different z or m dimensions */
+    SFWT_DIFFERENCE_DIMENSIONS,
+    /** Coordinate values differ by more than the delta */
+    SFWT_DIFFERENCE_COORDINATE,
+    /** Different number of geometries, members or coordinates */
+    SFWT_DIFFERENCE_COUNT
+};
+
+/**
+ * First difference found comparing two well-known texts
+ */
+@interface SFWTTextDifference : NSObject
+
+/**
+ * Difference type
+ */
+@property (nonatomic, readonly) SFWTDifferenceType type;
+
+/**
+ * Zero based indices from the top level geometry to the differing
+ * geometry or vertex
+ */
+@property (nonatomic, strong, readonly) NSArray<NSNumber *> *path;
+
+/**
+ * Readable path, for example "geometry 3 → ring 1 → vertex 2041"
+ */
+@property (nonatomic, strong, readonly) NSString *pathDescription;
+
+/**
+ * Difference description
+ */
+@property (nonatomic, strong, readonly) NSString *message;
+
+/**
+ * Initializer
+ *
+ * @param type
+ *            difference type
+ * @param path
+ *            path indices
+ * @param pathDescription
+ *            readable path
+ * @param message
+ *            difference description
+ */
+-(instancetype) initWithType: (SFWTDifferenceType) type andPath: (NSArray<NSNumber *> *) path andPathDescription: (NSString *) pathDescription andMessage: (NSString *) message;
+
+@end
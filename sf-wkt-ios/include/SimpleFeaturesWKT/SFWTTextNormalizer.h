@@ -0,0 +1,84 @@
+//
+//  SFWTTextNormalizer.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+#import <SimpleFeaturesWKT/SFWTEventReader.h>
+
+/**
+ * Well Known Text normalizer. Parses the text and writes canonical text in
+ * a single pass without building geometry objects. The output matches the
+ * SFWTGeometryWriter output of the geometry read by the SFWTGeometryReader:
+ * upper case type names, separated dimension tags, wrapped multi point
+ * members, shortest round trip values, and MultiCurve and MultiSurface
+ * written as GeometryCollection. Empty geometries produce no output,
+ * matching the nil geometries returned by the geometry reader.
+ */
+@interface SFWTTextNormalizer : NSObject
+
+/**
+ * Resource limits, nil for unlimited
+ */
+@property (nonatomic, strong) SFWTReaderLimits *limits;
+
+/**
+ * Normalize well-known text
+ *
+ * @param text
+ *            well-known text
+ *
+ * @return normalized well-known text, nil if empty
+ */
++(NSString *) normalizedTextWithText: (NSString *) text;
+
+/**
+ * Initializer
+ *
+ * @param text
+ *            well-known text
+ */
+-(instancetype) initWithText: (NSString *) text;
+
+/**
+ * Initializer
+ *
+ * @param reader
+ *            text reader
+ */
+-(instancetype) initWithReader: (SFTextReader *) reader;
+
+/**
+ * Normalize the next non empty geometry
+ *
+ * @return normalized well-known text, nil at the end of the text
+ */
+-(NSString *) write;
+
+/**
+ * Normalize the next non empty geometry, appending to the data
+ *
+ * @param data
+ *            UTF-8 output
+ *
+ * @return true if a geometry was written, false at the end of the text
+ */
+-(BOOL) writeToData: (NSMutableData *) data;
+
+/**
+ * Normalize the next non empty geometry to an open output stream. Each
+ * geometry is buffered until its dimension tags are known and then
+ * written.
+ *
+ * @param stream
+ *            open output stream
+ *
+ * @return true if a geometry was written, false at the end of the text
+ */
+-(BOOL) writeToStream: (NSOutputStream *) stream;
+
+@end
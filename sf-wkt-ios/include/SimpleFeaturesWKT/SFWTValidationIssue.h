@@ -0,0 +1,75 @@
+//
+//  SFWTValidationIssue.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+
+/**
+ * Exception name raised by fail fast validation, the user info holds the
+ * issue under SFWT_VALIDATION_ISSUE_KEY
+ */
+extern NSString * const SFWT_VALIDATION_FAILED;
+
+/**
+ * Exception user info key of the validation issue
+ */
+extern NSString * const SFWT_VALIDATION_ISSUE_KEY;
+
+/**
+ * Validation rules checked while reading
+ */
+typedef NS_OPTIONS(NSUInteger, SFWTValidationRules){
+    SFWT_VALIDATE_NONE = 0,
+    SFWT_VALIDATE_CLOSED_RINGS = 1 << 0,
+    SFWT_VALIDATE_MIN_POINTS = 1 << 1,
+    SFWT_VALIDATE_FINITE = 1 << 2,
+    SFWT_VALIDATE_DIMENSIONS = 1 << 3,
+    SFWT_VALIDATE_ALL = SFWT_VALIDATE_CLOSED_RINGS | SFWT_VALIDATE_MIN_POINTS | SFWT_VALIDATE_FINITE | SFWT_VALIDATE_DIMENSIONS
+};
+
+/**
+ * Geometry validation rule violation found while reading
+ */
+@interface SFWTValidationIssue : NSObject
+
+/**
+ * Violated rule
+ */
+@property (nonatomic, readonly) SFWTValidationRules rule;
+
+/**
+ * Type of the geometry violating the rule
+ */
+@property (nonatomic, readonly) SFGeometryType geometryType;
+
+/**
+ * Text character offset of the token following the violation, NSNotFound
+ * when the text reader does not track positions
+ */
+@property (nonatomic, readonly) NSUInteger position;
+
+/**
+ * Violation description
+ */
+@property (nonatomic, strong, readonly) NSString *message;
+
+/**
+ * Initializer
+ *
+ * @param rule
+ *            violated rule
+ * @param geometryType
+ *            geometry type
+ * @param position
+ *            text character offset
+ * @param message
+ *            violation description
+ */
+-(instancetype) initWithRule: (SFWTValidationRules) rule andGeometryType: (SFGeometryType) geometryType andPosition: (NSUInteger) position andMessage: (NSString *) message;
+
+@end
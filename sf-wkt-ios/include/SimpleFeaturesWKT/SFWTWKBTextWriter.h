@@ -0,0 +1,57 @@
+//
+//  SFWTWKBTextWriter.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ * Well Known Binary to Well Known Text transcoder. Walks the binary in a
+ * single pass and writes text with the same formatting rules as the
+ * SFWTGeometryWriter (type names, dimension tags, value formatting,
+ * MULTICURVE naming of multi line strings of circular strings) without
+ * creating geometry or per vertex objects. Accepts ISO (+1000 / +2000 /
+ * +3000) and extended (high bit flag) Z and M type codes.
+ */
+@interface SFWTWKBTextWriter : NSObject
+
+/**
+ * Transcode well-known binary to well-known text
+ *
+ * @param wkb
+ *            well-known binary
+ *
+ * @return well-known text
+ */
++(NSString *) textWithWKB: (NSData *) wkb;
+
+/**
+ * Transcode well-known binary, appending the well-known text
+ *
+ * @param wkb
+ *            well-known binary
+ * @param string
+ *            mutable string
+ */
++(void) writeWKB: (NSData *) wkb toString: (NSMutableString *) string;
+
+/**
+ * Transcode well-known binary into a caller supplied character buffer.
+ * Like snprintf, at most length - 1 characters are written followed by a
+ * null terminator, and the full text length is returned.
+ *
+ * @param wkb
+ *            well-known binary
+ * @param buffer
+ *            character buffer
+ * @param length
+ *            buffer length
+ *
+ * @return full well-known text length, excluding the null terminator
+ */
++(NSUInteger) writeWKB: (NSData *) wkb toBuffer: (char *) buffer withLength: (NSUInteger) length;
+
+@end
@@ -0,0 +1,103 @@
+//
+//  SFWTWKBTranscoder.h
+//  sf-wkt-ios
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import <SimpleFeatures/SimpleFeatures.h>
+#import <SimpleFeaturesWKT/SFWTEventReader.h>
+
+/**
+ * Well Known Text to Well Known Binary transcoder. Parses the text and
+ * writes ISO WKB (Z +1000, M +2000, ZM +3000 type codes) in a single pass
+ * without building geometry objects. Output is byte identical to reading
+ * the geometry and writing it with a WKB geometry writer, including
+ * MultiCurve and MultiSurface written as GeometryCollection. Untagged text
+ * mixing coordinate dimensions within a geometry has its coordinates
+ * padded with NaN to the dimensions written in the geometry type code.
+ */
+@interface SFWTWKBTranscoder : NSObject
+
+/**
+ * Byte order, big endian by default
+ */
+@property (nonatomic) CFByteOrder byteOrder;
+
+/**
+ * Resource limits, nil for unlimited
+ */
+@property (nonatomic, strong) SFWTReaderLimits *limits;
+
+/**
+ * Transcode well-known text to big endian well-known binary
+ *
+ * @param text
+ *            well-known text
+ *
+ * @return well-known binary, nil if empty
+ */
++(NSData *) wkbWithText: (NSString *) text;
+
+/**
+ * Transcode well-known text to well-known binary
+ *
+ * @param text
+ *            well-known text
+ * @param byteOrder
+ *            byte order
+ *
+ * @return well-known binary, nil if empty
+ */
++(NSData *) wkbWithText: (NSString *) text andByteOrder: (CFByteOrder) byteOrder;
+
+/**
+ * Initializer
+ *
+ * @param text
+ *            well-known text
+ */
+-(instancetype) initWithText: (NSString *) text;
+
+/**
+ * Initializer
+ *
+ * @param reader
+ *            text reader
+ */
+-(instancetype) initWithReader: (SFTextReader *) reader;
+
+/**
+ * Transcode the next non empty geometry
+ *
+ * @return well-known binary, nil at the end of the text
+ */
+-(NSData *) write;
+
+/**
+ * Transcode the next non empty geometry, appending to the data
+ *
+ * @param data
+ *            well-known binary output
+ *
+ * @return true if a geometry was written, false at the end of the text
+ */
+-(BOOL) writeToData: (NSMutableData *) data;
+
+/**
+ * Get the ISO well-known binary geometry type code
+ *
+ * @param geometryType
+ *            geometry type
+ * @param hasZ
+ *            has z values
+ * @param hasM
+ *            has m values
+ *
+ * @return geometry type code
+ */
++(uint32_t) codeOfGeometryType: (SFGeometryType) geometryType andHasZ: (BOOL) hasZ andHasM: (BOOL) hasM;
+
+@end
@@ -9,8 +9,36 @@
 #ifndef sf_wkt_ios_sf_wkt_ios_h
 #define sf_wkt_ios_sf_wkt_ios_h
 
+#import <SimpleFeaturesWKT/SFWTArcLinearizer.h>
+#import <SimpleFeaturesWKT/SFWTBatchReader.h>
+#import <SimpleFeaturesWKT/SFWTCompressedGeometryReader.h>
+#import <SimpleFeaturesWKT/SFWTCompressedGeometryWriter.h>
+#import <SimpleFeaturesWKT/SFWTDelimitedReader.h>
+#import <SimpleFeaturesWKT/SFWTDelimitedRecord.h>
+#import <SimpleFeaturesWKT/SFWTEventReader.h>
+#import <SimpleFeaturesWKT/SFWTFlatGeometry.h>
+#import <SimpleFeaturesWKT/SFWTFlatGeometryFile.h>
+#import <SimpleFeaturesWKT/SFWTGeoJSONTranscoder.h>
+#import <SimpleFeaturesWKT/SFWTGeometryArena.h>
+#import <SimpleFeaturesWKT/SFWTGeometryCache.h>
+#import <SimpleFeaturesWKT/SFWTGeometryFingerprint.h>
 #import <SimpleFeaturesWKT/SFWTGeometryReader.h>
 #import <SimpleFeaturesWKT/SFWTGeometryTypeInfo.h>
 #import <SimpleFeaturesWKT/SFWTGeometryWriter.h>
+#import <SimpleFeaturesWKT/SFWTIndexedTextReader.h>
+#import <SimpleFeaturesWKT/SFWTLazyGeometry.h>
+#import <SimpleFeaturesWKT/SFWTMemberEnumerator.h>
+#import <SimpleFeaturesWKT/SFWTQuantizedReader.h>
+#import <SimpleFeaturesWKT/SFWTReaderLimits.h>
+#import <SimpleFeaturesWKT/SFWTSpatialIndex.h>
+#import <SimpleFeaturesWKT/SFWTStructuralIndex.h>
+#import <SimpleFeaturesWKT/SFWTTWKBTextWriter.h>
+#import <SimpleFeaturesWKT/SFWTTWKBTranscoder.h>
+#import <SimpleFeaturesWKT/SFWTTextComparator.h>
+#import <SimpleFeaturesWKT/SFWTTextDifference.h>
+#import <SimpleFeaturesWKT/SFWTTextNormalizer.h>
+#import <SimpleFeaturesWKT/SFWTValidationIssue.h>
+#import <SimpleFeaturesWKT/SFWTWKBTextWriter.h>
+#import <SimpleFeaturesWKT/SFWTWKBTranscoder.h>
 
 #endif
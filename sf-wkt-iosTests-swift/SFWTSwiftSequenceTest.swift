@@ -0,0 +1,75 @@
+//
+//  SFWTSwiftSequenceTest.swift
+//  sf-wkt-iosTests
+//
+//  Created by Brian Osborn on 10/19/26.
+//  Copyright © 2026 NGA. All rights reserved.
+//
+
+import XCTest
+import SimpleFeatures
+import SimpleFeaturesWKT
+import SimpleFeaturesWKTSwift
+import TestUtils
+
+/**
+* Swift async sequence and coordinate buffer tests
+*/
+class SFWTSwiftSequenceTest: XCTestCase{
+    
+    static var TEST_TEXT : String = "POINT (1 2) POINT EMPTY LINESTRING Z (0 0 1, 3 4 5) POLYGON ((0 0, 1 0, 1 1, 0 0))"
+    
+    /**
+     * Test the geometry sequence
+     */
+    func testGeometrySequence() async throws{
+        
+        var geometries: [SFGeometry] = []
+        for try await geometry in SFWTGeometrySequence(text: SFWTSwiftSequenceTest.TEST_TEXT, batchSize: 2) {
+            geometries.append(geometry)
+        }
+        
+        SFWTTestUtils.assertEqualInt(withValue: 3, andValue2: Int32(geometries.count))
+        SFWTTestUtils.assertEqual(withValue: SFWTGeometryReader.readGeometry(withText: "LINESTRING Z (0 0 1, 3 4 5)"), andValue2: geometries[1])
+        
+        var thrown = false
+        var read: [SFGeometry] = []
+        do {
+            for try await geometry in SFWTGeometrySequence(text: "POINT (1 2) POINT (1") {
+                read.append(geometry)
+            }
+        } catch {
+            thrown = true
+        }
+        SFWTTestUtils.assertTrue(thrown)
+        SFWTTestUtils.assertEqualInt(withValue: 1, andValue2: Int32(read.count))
+        SFWTTestUtils.assertEqual(withValue: SFWTGeometryReader.readGeometry(withText: "POINT (1 2)"), andValue2: read[0])
+        
+    }
+    
+    /**
+     * Test the flat geometry sequence coordinate buffers
+     */
+    func testFlatGeometrySequence() async throws{
+        
+        var coordinates: [ContiguousArray<Double>] = []
+        var strides: [Int] = []
+        for try await flatGeometry in SFWTFlatGeometrySequence(text: SFWTSwiftSequenceTest.TEST_TEXT) {
+            let coordinateArray = flatGeometry.coordinateArray()!
+            coordinates.append(coordinateArray.values)
+            strides.append(coordinateArray.stride)
+        }
+        
+        SFWTTestUtils.assertEqualInt(withValue: 3, andValue2: Int32(coordinates.count))
+        SFWTTestUtils.assertTrue(coordinates[0] == [1, 2])
+        SFWTTestUtils.assertTrue(coordinates[1] == [0, 0, 1, 3, 4, 5])
+        SFWTTestUtils.assertTrue(coordinates[2] == [0, 0, 1, 0, 1, 1, 0, 0])
+        SFWTTestUtils.assertTrue(strides == [2, 3, 2])
+        
+        for try await flatGeometry in SFWTFlatGeometrySequence(text: "GEOMETRYCOLLECTION (POINT Z (1 2 3), POINT (4 5))") {
+            SFWTTestUtils.assertTrue(flatGeometry.coordinateArray() == nil)
+        }
+        
+    }
+    
+}
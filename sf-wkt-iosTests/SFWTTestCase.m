@@ -15,6 +15,27 @@
 
 @end
 
+/**
+ * Text reader counting token look ahead
+ */
+@interface SFWTPeekCountingTextReader : SFTextReader
+
+/**
+ * Number of peeked tokens
+ */
+@property (nonatomic) int peeks;
+
+@end
+
+@implementation SFWTPeekCountingTextReader
+
+-(NSString *) peekToken{
+    _peeks++;
+    return [super peekToken];
+}
+
+@end
+
 @implementation SFWTTestCase
 
 static NSUInteger GEOMETRIES_PER_TEST = 10;
@@ -447,6 +468,1040 @@ static NSUInteger GEOMETRIES_PER_TEST = 10;
                 withExpected:@"GEOMETRYCOLLECTION ZM(POINT ZM(13.21 47.21 0.21 1000.0),\nLINESTRING ZM(15.21 57.58 0.31 1000.0, 15.81 57.12 0.33 1100.0))" andDelta:0.0000000000001];
 }
 
+-(void) testLimits{
+    
+    NSString *text = @"GEOMETRYCOLLECTION (POINT (1 2), GEOMETRYCOLLECTION (LINESTRING (1 2, 3 4, 5 6)))";
+    
+    SFGeometry *geometry = [SFWTGeometryReader readGeometryWithText:text andLimits:[SFWTReaderLimits limits]];
+    [SFWTTestUtils assertNotNil:geometry];
+    
+    geometry = [SFWTGeometryReader readGeometryWithText:text andLimits:[SFWTReaderLimits limitsWithMaxDepth:3 andMaxCoordinates:4 andMaxBytes:text.length andMaxAllocation:10000]];
+    [SFWTTestUtils assertNotNil:geometry];
+    [SFWTGeometryTestUtils compareGeometriesWithExpected:[SFWTGeometryReader readGeometryWithText:text] andActual:geometry];
+    
+    XCTAssertThrowsSpecificNamed([SFWTGeometryReader readGeometryWithText:text andLimits:[SFWTReaderLimits limitsWithMaxDepth:2 andMaxCoordinates:0 andMaxBytes:0 andMaxAllocation:0]], NSException, SFWT_LIMIT_EXCEEDED);
+    XCTAssertThrowsSpecificNamed([SFWTGeometryReader readGeometryWithText:text andLimits:[SFWTReaderLimits limitsWithMaxDepth:0 andMaxCoordinates:3 andMaxBytes:0 andMaxAllocation:0]], NSException, SFWT_LIMIT_EXCEEDED);
+    XCTAssertThrowsSpecificNamed([SFWTGeometryReader readGeometryWithText:text andLimits:[SFWTReaderLimits limitsWithMaxDepth:0 andMaxCoordinates:0 andMaxBytes:text.length - 1 andMaxAllocation:0]], NSException, SFWT_LIMIT_EXCEEDED);
+    XCTAssertThrowsSpecificNamed([SFWTGeometryReader readGeometryWithText:text andLimits:[SFWTReaderLimits limitsWithMaxDepth:0 andMaxCoordinates:0 andMaxBytes:0 andMaxAllocation:256]], NSException, SFWT_LIMIT_EXCEEDED);
+    
+    // Limits apply per geometry when reading a sequence
+    SFWTGeometryReader *reader = [[SFWTGeometryReader alloc] initWithText:@"POINT (1 2) POINT (3 4)"];
+    [reader setLimits:[SFWTReaderLimits limitsWithMaxDepth:1 andMaxCoordinates:1 andMaxBytes:0 andMaxAllocation:0]];
+    [SFWTTestUtils assertNotNil:[reader read]];
+    [SFWTTestUtils assertNotNil:[reader read]];
+    
+    // Max bytes apply per geometry record, not to the whole text
+    NSString *records = @"POINT (1 2) LINESTRING (0 0, 1 1) LINESTRING (0 0, 1 1, 2 2)";
+    SFWTReaderLimits *limits = [SFWTReaderLimits limitsWithMaxDepth:0 andMaxCoordinates:0 andMaxBytes:22 andMaxAllocation:0];
+    reader = [[SFWTGeometryReader alloc] initWithText:records];
+    [reader setLimits:limits];
+    [SFWTTestUtils assertEqualIntWithValue:SF_POINT andValue2:(int)[reader read].geometryType];
+    [SFWTTestUtils assertEqualIntWithValue:SF_LINESTRING andValue2:(int)[reader read].geometryType];
+    XCTAssertThrowsSpecificNamed([reader read], NSException, SFWT_LIMIT_EXCEEDED);
+    
+    SFWTEventReader *eventReader = [[SFWTEventReader alloc] initWithText:records];
+    [eventReader setLimits:limits];
+    for(int record = 0; record < 2; record++){
+        [SFWTTestUtils assertEqualIntWithValue:SFWT_EVENT_START_GEOMETRY andValue2:(int)[eventReader next]];
+        [eventReader skipGeometry];
+    }
+    [SFWTTestUtils assertEqualIntWithValue:SFWT_EVENT_START_GEOMETRY andValue2:(int)[eventReader next]];
+    XCTAssertThrowsSpecificNamed([eventReader skipGeometry], NSException, SFWT_LIMIT_EXCEEDED);
+    
+}
+
+-(void) testFlatGeometry{
+    
+    NSArray<NSString *> *texts = @[
+        @"POINT (1 2)",
+        @"LINESTRING Z (1 2 3, 4 5 6)",
+        @"POLYGON ((0 0, 1 0, 1 1, 0 0), (0.2 0.2, 0.4 0.2, 0.2 0.4, 0.2 0.2))",
+        @"MULTIPOINT (1 2, (3 4))",
+        @"MULTICURVE (CIRCULARSTRING (0 0, 1 1, 2 0), (3 3, 4 4))",
+        @"GEOMETRYCOLLECTION (POINT (1 2), MULTIPOLYGON (((0 0, 1 0, 1 1, 0 0))))",
+        @"LINESTRING (1 2, 3 4 5)"
+    ];
+    
+    SFWTGeometryArena *arena = [[SFWTGeometryArena alloc] init];
+    
+    for(NSString *text in texts){
+        SFWTFlatGeometry *flatGeometry = [SFWTGeometryReader readFlatGeometryWithText:text andArena:arena];
+        [SFWTTestUtils assertNotNil:flatGeometry];
+        [SFWTGeometryTestUtils compareGeometriesWithExpected:[SFWTGeometryReader readGeometryWithText:text] andActual:[flatGeometry geometry]];
+    }
+    
+    SFWTFlatGeometry *flatGeometry = [SFWTGeometryReader readFlatGeometryWithText:@"MULTILINESTRING ((1 2, 3 4), (5 6, 7 8, 9 10))" andArena:arena];
+    [SFWTTestUtils assertEqualIntWithValue:SF_MULTILINESTRING andValue2:[flatGeometry geometryType]];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:[flatGeometry numGeometries]];
+    SFWTFlatGeometry *lineString = [flatGeometry geometryAtIndex:1];
+    [SFWTTestUtils assertEqualIntWithValue:3 andValue2:[lineString numPoints]];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:[lineString stride]];
+    [SFWTTestUtils assertEqualDoubleWithValue:9 andValue2:[lineString coordinates][4]];
+    
+    [SFWTTestUtils assertTrue:[arena size] > 0];
+    [arena reset];
+    [SFWTTestUtils assertEqualIntWithValue:0 andValue2:(int)[arena size]];
+    XCTAssertThrows([lineString numPoints]);
+    
+    // Build scratch buffers outlive resets for reuse by the next geometry
+    NSUInteger scratchSize = [arena scratchSize:0];
+    [SFWTTestUtils assertTrue:scratchSize > 0];
+    [SFWTGeometryReader readFlatGeometryWithText:@"POINT (1 2)" andArena:arena];
+    [SFWTTestUtils assertEqualIntWithValue:(int)scratchSize andValue2:(int)[arena scratchSize:0]];
+    
+    // Flat reads skip empty geometries and continue through a sequence
+    SFWTGeometryReader *reader = [[SFWTGeometryReader alloc] initWithText:@"POINT EMPTY POINT (1 2) POINT (3 4)"];
+    [SFWTTestUtils assertEqualIntWithValue:SF_POINT andValue2:[[reader readFlat] geometryType]];
+    [SFWTTestUtils assertEqualDoubleWithValue:3 andValue2:[[reader readFlat] coordinates][0]];
+    [SFWTTestUtils assertNil:[reader readFlat]];
+    
+    // NaN values read from the text are kept, missing values stay missing
+    [self nanOrdinatesTester:(SFLineString *) [[SFWTGeometryReader readFlatGeometryWithText:@"LINESTRING (1 2 NaN, 3 4 5)" andArena:arena] geometry]
+                withPartial:(SFLineString *) [[SFWTGeometryReader readFlatGeometryWithText:@"LINESTRING (1 2, 3 4 NaN)" andArena:arena] geometry]];
+    
+}
+
+-(void) testStructuralIndex{
+    
+    NSString *text = @"MULTIPOLYGON (((0 0, 10 0, 10 10, 0 0), (1 1,2 1, 1 2, 1 1)), ((-5.5 +6e2, 7 8, 9 10, -5.5 +6e2)))";
+    
+    SFWTStructuralIndex *index = [[SFWTStructuralIndex alloc] initWithText:text];
+    [SFWTTestUtils assertNotNil:[SFWTStructuralIndex implementation]];
+    [SFWTTestUtils assertTrue:[index isASCII]];
+    
+    // Every token start, compared against the standard text reader
+    SFTextReader *textReader = [[SFTextReader alloc] initWithText:text];
+    NSUInteger count = 0;
+    for(NSString *token = [textReader readToken]; token != nil; token = [textReader readToken]){
+        [SFWTTestUtils assertEqualIntWithValue:[token characterAtIndex:0] andValue2:[index characterAtIndex:count]];
+        count++;
+    }
+    [SFWTTestUtils assertEqualIntWithValue:(int)count andValue2:(int)[index count]];
+    
+    // Member and coordinate counts without parsing
+    NSUInteger first = 1;
+    [SFWTTestUtils assertEqualIntWithValue:'(' andValue2:[index characterAtIndex:first]];
+    [SFWTTestUtils assertEqualIntWithValue:(int)[index count] - 1 andValue2:(int)[index closingIndexOf:first]];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:[index countMembersAtIndex:first]];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:[index countMembersAtIndex:first + 1]];
+    [SFWTTestUtils assertEqualIntWithValue:12 andValue2:[index countCoordinatesAtIndex:first]];
+    
+    // Indexed reading matches the standard reader
+    SFGeometry *expected = [SFWTGeometryReader readGeometryWithReader:[[SFTextReader alloc] initWithText:text]];
+    SFWTIndexedTextReader *indexedReader = [[SFWTIndexedTextReader alloc] initWithText:text];
+    SFGeometry *geometry = [SFWTGeometryReader readGeometryWithReader:indexedReader];
+    [SFWTGeometryTestUtils compareGeometriesWithExpected:expected andActual:geometry];
+    [SFWTTestUtils assertNil:[indexedReader readToken]];
+    XCTAssertThrowsSpecificNamed([indexedReader readDouble], NSException, @"Invalid Token");
+    
+    [indexedReader seek:0];
+    [SFWTTestUtils assertEqualWithValue:@"MULTIPOLYGON" andValue2:[indexedReader readToken]];
+    
+    // Hex numbers parse as the standard reader parses them
+    NSString *hex = @"0x10 0x1p3 -0X2";
+    textReader = [[SFTextReader alloc] initWithText:hex];
+    indexedReader = [[SFWTIndexedTextReader alloc] initWithText:hex];
+    for(int i = 0; i < 3; i++){
+        [SFWTTestUtils assertEqualDoubleWithValue:[textReader readDouble] andValue2:[indexedReader readDouble]];
+    }
+    
+    // Non ASCII text falls back to the standard reader
+    [SFWTTestUtils assertFalse:[[SFWTIndexedTextReader readerWithText:@"POINT\u00A0(1 2)"] isKindOfClass:[SFWTIndexedTextReader class]]];
+    
+}
+
+-(void) testLazyGeometry{
+    
+    NSString *text = @"MULTIPOLYGON Z (((0 0 1, 10 0 1, 10 10 1, 0 0 1)), ((20 20 2, 30 20 2, 30 30 2, 20 20 2), (21 21 3, 22 21 3, 21 22 3, 21 21 3)))";
+    SFMultiPolygon *expected = (SFMultiPolygon *)[SFWTGeometryReader readGeometryWithText:text];
+    
+    SFWTLazyGeometry *lazyGeometry = [SFWTLazyGeometry lazyGeometryWithText:text];
+    [SFWTTestUtils assertEqualIntWithValue:SF_MULTIPOLYGON andValue2:[lazyGeometry geometryType]];
+    [SFWTTestUtils assertTrue:[lazyGeometry hasZ]];
+    [SFWTTestUtils assertFalse:[lazyGeometry hasM]];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:[lazyGeometry numMembers]];
+    
+    SFGeometry *polygon = [lazyGeometry memberAtIndex:1];
+    [SFWTGeometryTestUtils compareGeometriesWithExpected:[expected polygonAtIndex:1] andActual:polygon];
+    [SFWTTestUtils assertTrue:polygon == [lazyGeometry memberAtIndex:1]];
+    
+    SFWTLazyGeometry *lazyPolygon = [lazyGeometry lazyMemberAtIndex:1];
+    [SFWTTestUtils assertEqualIntWithValue:SF_POLYGON andValue2:[lazyPolygon geometryType]];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:[lazyPolygon numMembers]];
+    [SFWTGeometryTestUtils compareGeometriesWithExpected:[[expected polygonAtIndex:1] ringAtIndex:1] andActual:[lazyPolygon memberAtIndex:1]];
+    [SFWTTestUtils assertTrue:lazyPolygon == [lazyGeometry lazyMemberAtIndex:1]];
+    
+    [SFWTGeometryTestUtils compareGeometriesWithExpected:expected andActual:[lazyGeometry geometry]];
+    
+    SFWTLazyGeometry *collection = [SFWTLazyGeometry lazyGeometryWithText:@"GEOMETRYCOLLECTION (POINT (1 2), LINESTRING (3 4, 5 6, 7 8), POINT EMPTY)"];
+    [SFWTTestUtils assertEqualIntWithValue:3 andValue2:[collection numMembers]];
+    [SFWTTestUtils assertNil:[collection memberAtIndex:2]];
+    [SFWTTestUtils assertNil:[collection lazyMemberAtIndex:2]];
+    [SFWTTestUtils assertEqualIntWithValue:SF_LINESTRING andValue2:[[collection lazyMemberAtIndex:1] geometryType]];
+    [SFWTTestUtils assertEqualIntWithValue:3 andValue2:[[collection lazyMemberAtIndex:1] numMembers]];
+    [SFWTGeometryTestUtils compareGeometriesWithExpected:[SFWTGeometryReader readGeometryWithText:@"POINT (5 6)"] andActual:[[collection lazyMemberAtIndex:1] memberAtIndex:1]];
+    
+    [SFWTTestUtils assertNil:[SFWTLazyGeometry lazyGeometryWithText:@"POLYGON EMPTY"]];
+    
+    // Coordinate members
+    NSArray<NSString *> *coordinates = @[@"MULTIPOINT (1 2, (3 4), 5 6)", @"LINESTRING (1 2, 3 4, 5 6)", @"CIRCULARSTRING (1 2, 3 4, 5 6)"];
+    for(NSString *coordinate in coordinates){
+        SFWTLazyGeometry *lazy = [SFWTLazyGeometry lazyGeometryWithText:coordinate];
+        SFWTLazyGeometry *point = [lazy lazyMemberAtIndex:2];
+        [SFWTTestUtils assertEqualIntWithValue:SF_POINT andValue2:[point geometryType]];
+        [SFWTTestUtils assertEqualIntWithValue:1 andValue2:[point numMembers]];
+        [SFWTGeometryTestUtils compareGeometriesWithExpected:[SFWTGeometryReader readGeometryWithText:@"POINT (5 6)"] andActual:[point geometry]];
+        [SFWTGeometryTestUtils compareGeometriesWithExpected:[SFWTGeometryReader readGeometryWithText:@"POINT (5 6)"] andActual:[point memberAtIndex:0]];
+        [SFWTTestUtils assertEqualIntWithValue:SF_POINT andValue2:[[point lazyMemberAtIndex:0] geometryType]];
+        [SFWTGeometryTestUtils compareGeometriesWithExpected:[SFWTGeometryReader readGeometryWithText:@"POINT (3 4)"] andActual:[[lazy lazyMemberAtIndex:1] geometry]];
+    }
+    
+    // Non ASCII text is parsed with a plain reader
+    NSString *nonASCII = @"MULTIPOLYGON Z (((0 0 1, 10 0 1, 10 10 1, 0 0 1)),\u00A0((20 20 2, 30 20 2, 30 30 2, 20 20 2), (21 21 3, 22 21 3, 21 22 3, 21 21 3)))";
+    SFWTLazyGeometry *lazyNonASCII = [SFWTLazyGeometry lazyGeometryWithText:nonASCII];
+    [SFWTTestUtils assertEqualIntWithValue:SF_MULTIPOLYGON andValue2:[lazyNonASCII geometryType]];
+    [SFWTTestUtils assertTrue:[lazyNonASCII hasZ]];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:[lazyNonASCII numMembers]];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:[[lazyNonASCII lazyMemberAtIndex:1] numMembers]];
+    [SFWTGeometryTestUtils compareGeometriesWithExpected:[[expected polygonAtIndex:1] ringAtIndex:1] andActual:[[lazyNonASCII lazyMemberAtIndex:1] memberAtIndex:1]];
+    [SFWTGeometryTestUtils compareGeometriesWithExpected:expected andActual:[lazyNonASCII geometry]];
+    
+}
+
+-(void) testMemberEnumerator{
+    
+    NSString *text = @"GEOMETRYCOLLECTION (POINT (1 2), POINT EMPTY, LINESTRING (3 4, 5 6), MULTICURVE ((7 8, 9 10)))";
+    SFGeometryCollection *expected = (SFGeometryCollection *)[SFWTGeometryReader readGeometryWithText:text];
+    
+    SFWTMemberEnumerator *enumerator = [SFWTGeometryReader memberEnumeratorWithText:text];
+    [SFWTTestUtils assertEqualIntWithValue:SF_GEOMETRYCOLLECTION andValue2:[enumerator geometryType]];
+    
+    int index = 0;
+    for(SFGeometry *member in enumerator){
+        [SFWTGeometryTestUtils compareGeometriesWithExpected:[expected geometryAtIndex:index++] andActual:member];
+    }
+    [SFWTTestUtils assertEqualIntWithValue:[expected numGeometries] andValue2:index];
+    [SFWTTestUtils assertEqualIntWithValue:4 andValue2:[enumerator count]];
+    [SFWTTestUtils assertNil:[enumerator nextObject]];
+    
+    // Continues with the following geometry
+    SFWTGeometryReader *reader = [[SFWTGeometryReader alloc] initWithText:@"MULTIPOINT (1 2, (3 4)) POINT (5 6)"];
+    NSArray<SFGeometry *> *points = [[reader memberEnumerator] allObjects];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:(int)points.count];
+    [SFWTGeometryTestUtils compareGeometriesWithExpected:[SFWTGeometryReader readGeometryWithText:@"POINT (5 6)"] andActual:[reader read]];
+    
+    [SFWTTestUtils assertNil:[[SFWTGeometryReader memberEnumeratorWithText:@"MULTIPOLYGON EMPTY"] nextObject]];
+    
+}
+
+-(void) testWKBTranscoder{
+    
+    const uint8_t point[] = {
+        0x00, 0x00, 0x00, 0x00, 0x01,
+        0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    [SFWTTestUtils assertEqualWithValue:[NSData dataWithBytes:point length:sizeof(point)] andValue2:[SFWTWKBTranscoder wkbWithText:@"POINT (1 2)"]];
+    
+    const uint8_t lineString[] = {
+        0x01, 0xEA, 0x03, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x40,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x40
+    };
+    [SFWTTestUtils assertEqualWithValue:[NSData dataWithBytes:lineString length:sizeof(lineString)] andValue2:[SFWTWKBTranscoder wkbWithText:@"LINESTRING (1 2 3, 4 5 6)" andByteOrder:CFByteOrderLittleEndian]];
+    
+    // Polygon rings are not headered, collection members are
+    NSData *polygon = [SFWTWKBTranscoder wkbWithText:@"POLYGON ((0 0, 1 0, 1 1, 0 0))"];
+    [SFWTTestUtils assertEqualIntWithValue:1 + 4 + 4 + 4 + 4 * 16 andValue2:(int)polygon.length];
+    NSData *multiCurve = [SFWTWKBTranscoder wkbWithText:@"MULTICURVE ((0 0, 1 1), CIRCULARSTRING (0 0, 1 1, 2 0))"];
+    [SFWTTestUtils assertEqualIntWithValue:1 + 4 + 4 + (1 + 4 + 4 + 2 * 16) + (1 + 4 + 4 + 3 * 16) andValue2:(int)multiCurve.length];
+    uint32_t code;
+    [multiCurve getBytes:&code range:NSMakeRange(1, 4)];
+    [SFWTTestUtils assertEqualIntWithValue:7 andValue2:CFSwapInt32BigToHost(code)];
+    
+    [SFWTTestUtils assertNil:[SFWTWKBTranscoder wkbWithText:@"POINT EMPTY"]];
+    
+    // Untagged mixed dimensions are padded to the geometry dimensions
+    NSData *mixed = [SFWTWKBTranscoder wkbWithText:@"LINESTRING (1 2, 3 4 5)"];
+    [SFWTTestUtils assertEqualIntWithValue:1 + 4 + 4 + 2 * 24 andValue2:(int)mixed.length];
+    [SFWTTestUtils assertEqualWithValue:@"LINESTRING Z (1 2 NaN, 3 4 5)" andValue2:[SFWTWKBTextWriter textWithWKB:mixed]];
+    mixed = [SFWTWKBTranscoder wkbWithText:@"POLYGON ((0 0, 1 0, 1 1 1 2, 0 0), (0 0 1, 1 0 1, 0 0 1))" andByteOrder:CFByteOrderLittleEndian];
+    [SFWTTestUtils assertEqualIntWithValue:1 + 4 + 4 + 4 + 4 * 32 + 4 + 3 * 32 andValue2:(int)mixed.length];
+    [SFWTTestUtils assertEqualWithValue:@"POLYGON ZM ((0 0 NaN NaN, 1 0 NaN NaN, 1 1 1 2, 0 0 NaN NaN), (0 0 1 NaN, 1 0 1 NaN, 0 0 1 NaN))" andValue2:[SFWTWKBTextWriter textWithWKB:mixed]];
+    mixed = [SFWTWKBTranscoder wkbWithText:@"MULTIPOINT (1 2, 3 4 5)"];
+    [SFWTTestUtils assertEqualWithValue:@"MULTIPOINT Z ((1 2), (3 4 5))" andValue2:[SFWTWKBTextWriter textWithWKB:mixed]];
+    
+}
+
+-(void) testWKBTextWriter{
+    
+    NSArray<NSString *> *texts = @[
+        @"POINT (1.5 -2.25)",
+        @"LINESTRING Z (1 2 3, 4 5 6)",
+        @"POLYGON M ((0 0 1, 1 0 2, 1 1 3, 0 0 4))",
+        @"MULTIPOINT ((1 2), (3 4))",
+        @"MULTILINESTRING ((0.1 0.2, 1e-7 123456789012.5), (3 4, 5 6))",
+        @"MULTICURVE (CIRCULARSTRING (0 0, 1 1, 2 0), (3 3, 4 4))",
+        @"GEOMETRYCOLLECTION ZM (POINT ZM (1 2 3 4), TRIANGLE ZM ((0 0 0 0, 1 0 0 0, 0 1 0 0, 0 0 0 0)))",
+        @"COMPOUNDCURVE (CIRCULARSTRING (0 0, 1 1, 2 0), (2 0, 3 0))",
+        @"TIN (((0 0 0, 1 0 0, 0 1 0, 0 0 0)))"
+    ];
+    
+    for(NSString *text in texts){
+        NSString *expected = [SFWTGeometryWriter writeGeometry:[SFWTGeometryReader readGeometryWithText:text]];
+        NSData *wkb = [SFWTWKBTranscoder wkbWithText:text andByteOrder:CFByteOrderLittleEndian];
+        [SFWTTestUtils assertEqualWithValue:expected andValue2:[SFWTWKBTextWriter textWithWKB:wkb]];
+        [SFWTTestUtils assertEqualWithValue:expected andValue2:[SFWTWKBTextWriter textWithWKB:[SFWTWKBTranscoder wkbWithText:text]]];
+    }
+    
+    NSData *wkb = [SFWTWKBTranscoder wkbWithText:@"LINESTRING (1 2, 3 4)"];
+    char buffer[16];
+    NSUInteger length = [SFWTWKBTextWriter writeWKB:wkb toBuffer:buffer withLength:sizeof(buffer)];
+    [SFWTTestUtils assertEqualIntWithValue:(int)@"LINESTRING (1 2, 3 4)".length andValue2:(int)length];
+    [SFWTTestUtils assertEqualWithValue:@"LINESTRING (1 2" andValue2:[NSString stringWithUTF8String:buffer]];
+    
+    char value[SFWT_VALUE_BUFFER_SIZE];
+    [SFWTGeometryWriter formatValue:0.1 toBuffer:value];
+    [SFWTTestUtils assertEqualWithValue:@"0.1" andValue2:[NSString stringWithUTF8String:value]];
+    [SFWTGeometryWriter formatValue:1.0 / 3.0 toBuffer:value];
+    [SFWTTestUtils assertEqualWithValue:@"0.3333333333333333" andValue2:[NSString stringWithUTF8String:value]];
+    
+}
+
+-(void) testGeoJSONTranscoder{
+    
+    NSDictionary<NSString *, NSString *> *texts = @{
+        @"POINT Z (1 2 3)": @"{\"type\":\"Point\",\"coordinates\":[1,2,3]}",
+        @"LINESTRING M (1 2 3, 4.5 5 6)": @"{\"type\":\"LineString\",\"coordinates\":[[1,2],[4.5,5]]}",
+        @"MULTIPOINT ((1 2), (3 4))": @"{\"type\":\"MultiPoint\",\"coordinates\":[[1,2],[3,4]]}",
+        @"POLYGON ((0 0, 4 0, 4 4, 0 0), (1 1, 2 1, 2 2, 1 1))": @"{\"type\":\"Polygon\",\"coordinates\":[[[0,0],[4,0],[4,4],[0,0]],[[1,1],[2,1],[2,2],[1,1]]]}",
+        @"GEOMETRYCOLLECTION (POINT (1 2), LINESTRING (0 0, 1 1))": @"{\"type\":\"GeometryCollection\",\"geometries\":[{\"type\":\"Point\",\"coordinates\":[1,2]},{\"type\":\"LineString\",\"coordinates\":[[0,0],[1,1]]}]}",
+        @"TIN (((0 0, 1 0, 0 1, 0 0)), ((1 0, 1 1, 0 1, 1 0)))": @"{\"type\":\"MultiPolygon\",\"coordinates\":[[[[0,0],[1,0],[0,1],[0,0]]],[[[1,0],[1,1],[0,1],[1,0]]]]}",
+        @"COMPOUNDCURVE ((0 0, 1 0), (1 0, 2 0))": @"{\"type\":\"LineString\",\"coordinates\":[[0,0],[1,0],[2,0]]}"
+    };
+    
+    for(NSString *text in texts){
+        [SFWTTestUtils assertEqualWithValue:[texts objectForKey:text] andValue2:[SFWTGeoJSONTranscoder geoJSONStringWithText:text]];
+        [SFWTTestUtils assertNotNil:[NSJSONSerialization JSONObjectWithData:[SFWTGeoJSONTranscoder geoJSONWithText:text] options:0 error:nil]];
+    }
+    
+    [SFWTTestUtils assertNil:[SFWTGeoJSONTranscoder geoJSONWithText:@"POINT EMPTY"]];
+    
+    NSString *arc = @"CIRCULARSTRING (0 0, 1 1, 2 0)";
+    SFWTGeoJSONTranscoder *transcoder = [[SFWTGeoJSONTranscoder alloc] initWithText:arc];
+    [transcoder setLinearizer:[[SFWTArcLinearizer alloc] initWithSegmentsPerQuadrant:1]];
+    [SFWTTestUtils assertEqualWithValue:@"{\"type\":\"LineString\",\"coordinates\":[[0,0],[1,1],[2,0]]}" andValue2:[[NSString alloc] initWithData:[transcoder write] encoding:NSUTF8StringEncoding]];
+    
+    NSDictionary *linearized = [NSJSONSerialization JSONObjectWithData:[SFWTGeoJSONTranscoder geoJSONWithText:arc] options:0 error:nil];
+    NSArray<NSArray<NSNumber *> *> *positions = [linearized objectForKey:@"coordinates"];
+    [SFWTTestUtils assertEqualIntWithValue:2 * SFWT_DEFAULT_SEGMENTS_PER_QUADRANT + 1 andValue2:(int)positions.count];
+    for(NSArray<NSNumber *> *position in positions){
+        [SFWTTestUtils assertEqualDoubleWithValue:1.0 andValue2:hypot([position[0] doubleValue] - 1.0, [position[1] doubleValue]) andDelta:0.0000001];
+    }
+    
+    transcoder = [[SFWTGeoJSONTranscoder alloc] initWithText:[NSString stringWithFormat:@"MULTICURVE (%@)", arc]];
+    [transcoder setCurvePolicy:SFWT_CURVE_ERROR];
+    XCTAssertThrowsSpecificNamed([transcoder write], NSException, @"Unsupported Geometry");
+    
+}
+
+-(void) testTWKBTranscoder{
+    
+    NSArray<NSString *> *texts = @[
+        @"POINT (1.5 -2.25)",
+        @"LINESTRING Z (1 2 3, 4 5 6)",
+        @"POLYGON M ((0 0 1, 1 0 2, 1 1 3, 0 0 4))",
+        @"MULTIPOINT ((1 2), (3 4))",
+        @"MULTILINESTRING ((0.1 0.2, 0.000001 123456.5), (3 4, 5 6))",
+        @"MULTIPOLYGON (((0 0, 1 0, 1 1, 0 0)), ((5 5, 6 5, 6 6, 5 5), (5.2 5.1, 5.8 5.1, 5.8 5.7, 5.2 5.1)))",
+        @"GEOMETRYCOLLECTION ZM (POINT ZM (1 2 3 4), LINESTRING ZM (-10.123456 45.654321 0 1, -10.5 46 2 3))"
+    ];
+    
+    for(NSString *text in texts){
+        NSData *twkb = [SFWTTWKBTranscoder twkbWithText:text];
+        [SFWTTestUtils assertEqualWithValue:[SFWTGeometryWriter writeGeometry:[SFWTGeometryReader readGeometryWithText:text]] andValue2:[SFWTTWKBTextWriter textWithTWKB:twkb]];
+        [SFWTTestUtils assertTrue:twkb.length < [text lengthOfBytesUsingEncoding:NSUTF8StringEncoding]];
+    }
+    
+    // PostGIS ST_AsTWKB encodings
+    const uint8_t point[] = {0x01, 0x00, 0x02, 0x04};
+    [SFWTTestUtils assertEqualWithValue:[NSData dataWithBytes:point length:sizeof(point)] andValue2:[SFWTTWKBTranscoder twkbWithText:@"POINT (1 2)" andPrecision:0]];
+    const uint8_t lineString[] = {0x02, 0x00, 0x02, 0x02, 0x02, 0x08, 0x08};
+    [SFWTTestUtils assertEqualWithValue:[NSData dataWithBytes:lineString length:sizeof(lineString)] andValue2:[SFWTTWKBTranscoder twkbWithText:@"LINESTRING (1 1, 5 5)" andPrecision:0]];
+    
+    [SFWTTestUtils assertEqualWithValue:@"LINESTRING (1.2 3.5, -1.2 0)" andValue2:[SFWTTWKBTextWriter textWithTWKB:[SFWTTWKBTranscoder twkbWithText:@"LINESTRING (1.23 3.45, -1.16 0.04)" andPrecision:1]]];
+    [SFWTTestUtils assertEqualWithValue:@"POINT (1200 -3500)" andValue2:[SFWTTWKBTextWriter textWithTWKB:[SFWTTWKBTranscoder twkbWithText:@"POINT (1234.5 -3456.7)" andPrecision:-2]]];
+    [SFWTTestUtils assertEqualWithValue:@"MULTIPOLYGON (((0 0, 1 0, 0 1, 0 0)))" andValue2:[SFWTTWKBTextWriter textWithTWKB:[SFWTTWKBTranscoder twkbWithText:@"TIN (((0 0, 1 0, 0 1, 0 0)))"]]];
+    
+    [SFWTTestUtils assertNil:[SFWTTWKBTranscoder twkbWithText:@"LINESTRING EMPTY"]];
+    
+    // Geometries without coordinates take the declared dimensions
+    const uint8_t *bytes = [[SFWTTWKBTranscoder twkbWithText:@"MULTIPOINT (EMPTY)"] bytes];
+    [SFWTTestUtils assertEqualIntWithValue:0xC4 andValue2:bytes[0]];
+    [SFWTTestUtils assertEqualIntWithValue:0 andValue2:bytes[1]];
+    bytes = [[SFWTTWKBTranscoder twkbWithText:@"MULTIPOINT Z (EMPTY)"] bytes];
+    [SFWTTestUtils assertEqualIntWithValue:0x08 andValue2:bytes[1]];
+    [SFWTTestUtils assertEqualIntWithValue:0x01 andValue2:bytes[2] & 0x03];
+    bytes = [[SFWTTWKBTranscoder twkbWithText:@"GEOMETRYCOLLECTION (MULTIPOINT (EMPTY))"] bytes];
+    [SFWTTestUtils assertEqualIntWithValue:0xC7 andValue2:bytes[0]];
+    [SFWTTestUtils assertEqualIntWithValue:0 andValue2:bytes[1]];
+    [SFWTTestUtils assertEqualIntWithValue:1 andValue2:bytes[2]];
+    [SFWTTestUtils assertEqualIntWithValue:0xC4 andValue2:bytes[3]];
+    [SFWTTestUtils assertEqualIntWithValue:0 andValue2:bytes[4]];
+    XCTAssertThrowsSpecificNamed([SFWTTWKBTranscoder twkbWithText:@"CIRCULARSTRING (0 0, 1 1, 2 0)"], NSException, @"Unsupported Geometry");
+    XCTAssertThrowsSpecificNamed([SFWTTWKBTextWriter textWithTWKB:[NSData dataWithBytes:lineString length:4]], NSException, @"Invalid TWKB");
+    
+}
+
+-(void) testFlatGeometryFile{
+    
+    NSArray<NSString *> *texts = @[
+        @"POINT (1 2)",
+        @"LINESTRING EMPTY",
+        @"POLYGON Z ((0 0 1, 4 0 2, 4 4 3, 0 0 1), (1 1 1, 2 1 1, 2 2 1, 1 1 1))",
+        @"MULTIPOINT M ((1 2 3), (4 5 6))",
+        @"GEOMETRYCOLLECTION (POINT (1 2), MULTILINESTRING ((0 0, 1 1), (2 2, 3 3)), CURVEPOLYGON (CIRCULARSTRING (0 0, 1 1, 2 0, 1 -1, 0 0)))",
+        @"TIN (((0 0, 1 0, 0 1, 0 0)))"
+    ];
+    
+    SFWTFlatGeometryFileWriter *writer = [[SFWTFlatGeometryFileWriter alloc] init];
+    for(NSString *text in texts){
+        [writer addText:text];
+    }
+    [SFWTTestUtils assertEqualIntWithValue:(int)texts.count andValue2:(int)[writer count]];
+    
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+    NSError *error = nil;
+    [SFWTTestUtils assertTrue:[writer writeToFile:path error:&error]];
+    
+    SFWTFlatGeometryFile *file = [SFWTFlatGeometryFile fileWithPath:path error:&error];
+    [SFWTTestUtils assertNotNil:file];
+    [SFWTTestUtils assertEqualIntWithValue:(int)texts.count andValue2:(int)[file count]];
+    for(NSUInteger i = 0; i < texts.count; i++){
+        SFGeometry *expected = [SFWTGeometryReader readGeometryWithText:texts[i]];
+        SFGeometry *geometry = [file geometryAtIndex:i];
+        if(expected == nil){
+            [SFWTTestUtils assertNil:geometry];
+        }else{
+            [SFWTGeometryTestUtils compareGeometriesWithExpected:expected andActual:geometry];
+        }
+    }
+    
+    SFWTFlatGeometry *polygon = [file flatGeometryAtIndex:2];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:[polygon numGeometries]];
+    [SFWTTestUtils assertEqualIntWithValue:3 andValue2:[[polygon geometryAtIndex:1] stride]];
+    [SFWTTestUtils assertEqualDoubleWithValue:2.0 andValue2:[[polygon geometryAtIndex:0] coordinates][5]];
+    [SFWTTestUtils assertEqualDoubleWithValue:1.0 andValue2:[file coordinates][0]];
+    
+    [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+    
+    [SFWTFlatGeometryFileWriter writeText:@"POINT (1 2) POINT EMPTY LINESTRING (3 4, 5 6) POLYGON EMPTY" toFile:path error:&error];
+    file = [SFWTFlatGeometryFile fileWithPath:path error:&error];
+    [SFWTTestUtils assertEqualIntWithValue:4 andValue2:(int)[file count]];
+    [SFWTTestUtils assertNil:[file geometryAtIndex:1]];
+    [SFWTTestUtils assertEqualWithValue:@"LINESTRING (3 4, 5 6)" andValue2:[SFWTGeometryWriter writeGeometry:[file geometryAtIndex:2]]];
+    [SFWTTestUtils assertNil:[file geometryAtIndex:3]];
+    [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+    
+    [SFWTFlatGeometryFileWriter writeText:@"LINESTRING (1 2 NaN, 3 4 5) LINESTRING (1 2, 3 4 NaN) POINT (8 9)" toFile:path error:&error];
+    file = [SFWTFlatGeometryFile fileWithPath:path error:&error];
+    [self nanOrdinatesTester:(SFLineString *) [file geometryAtIndex:0] withPartial:(SFLineString *) [file geometryAtIndex:1]];
+    [SFWTTestUtils assertEqualWithValue:@"POINT (8 9)" andValue2:[SFWTGeometryWriter writeGeometry:[file geometryAtIndex:2]]];
+    [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+    
+    NSMutableData *corrupt = [[writer data] mutableCopy];
+    ((SFWTFlatFileHeader *) [corrupt mutableBytes])->numNodes = 1000000;
+    XCTAssertThrowsSpecificNamed([[SFWTFlatGeometryFile alloc] initWithData:corrupt], NSException, @"Invalid Flat Geometry File");
+    
+}
+
+-(void) testGeometryCache{
+    
+    SFWTGeometryCache *cache = [[SFWTGeometryCache alloc] init];
+    
+    NSString *text = @"POLYGON ((0 0, 4 0, 4 4, 0 0))";
+    SFGeometry *geometry = [cache readGeometryWithText:text];
+    SFGeometry *cached = [cache readGeometryWithText:[NSMutableString stringWithString:text]];
+    [SFWTGeometryTestUtils compareGeometriesWithExpected:geometry andActual:cached];
+    [SFWTTestUtils assertFalse:geometry == cached];
+    [SFWTTestUtils assertEqualIntWithValue:1 andValue2:(int)[cache hits]];
+    [SFWTTestUtils assertEqualIntWithValue:1 andValue2:(int)[cache misses]];
+    [SFWTTestUtils assertEqualIntWithValue:1 andValue2:(int)[cache count]];
+    
+    [cache setCopyResults:NO];
+    [SFWTTestUtils assertTrue:[cache readGeometryWithText:text] == [cache readGeometryWithText:text]];
+    
+    [cache readGeometryWithText:text andFilter:nil andExpectedType:[SFPolygon class]];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:(int)[cache count]];
+    [SFWTTestUtils assertNil:[cache readGeometryWithText:@"POINT EMPTY"]];
+    [SFWTTestUtils assertNil:[cache readGeometryWithText:@"POINT EMPTY"]];
+    [SFWTTestUtils assertEqualIntWithValue:4 andValue2:(int)[cache hits]];
+    
+    [SFWTTestUtils assertTrue:[SFWTGeometryCache hashOfText:text] == [SFWTGeometryCache hashOfText:[NSMutableString stringWithString:text]]];
+    [SFWTTestUtils assertFalse:[SFWTGeometryCache hashOfText:text] == [SFWTGeometryCache hashOfText:@"POLYGON ((0 0, 4 0, 4 5, 0 0))"]];
+    
+    SFWTGeometryCache *small = [[SFWTGeometryCache alloc] initWithMaxBytes:2048];
+    for(int i = 0; i < 100; i++){
+        [small readGeometryWithText:[NSString stringWithFormat:@"LINESTRING (%d 0, 1 1, 2 2)", i]];
+    }
+    [SFWTTestUtils assertTrue:[small bytes] <= 2048];
+    [SFWTTestUtils assertTrue:[small evictions] > 0];
+    [SFWTTestUtils assertEqualIntWithValue:100 - (int)[small evictions] andValue2:(int)[small count]];
+    
+    dispatch_apply(64, dispatch_get_global_queue(QOS_CLASS_DEFAULT, 0), ^(size_t i){
+        SFGeometry *read = [small readGeometryWithText:[NSString stringWithFormat:@"LINESTRING (%zu 0, 1 1, 2 2)", i % 8]];
+        [SFWTTestUtils assertNotNil:read];
+    });
+    [SFWTTestUtils assertTrue:[small bytes] <= 2048];
+    
+    [small removeAll];
+    [SFWTTestUtils assertEqualIntWithValue:0 andValue2:(int)[small count]];
+    [SFWTTestUtils assertEqualIntWithValue:0 andValue2:(int)[small bytes]];
+    
+}
+
+-(void) testEnvelopeFilter{
+    
+    NSString *text = @"POINT (1 1) POINT (20 20) LINESTRING (-5 5, 5 -5) LINESTRING Z (-5 -5 0, -1 -1 0) POLYGON ((0 20, 20 20, 20 30, 0 20)) POINT EMPTY MULTIPOINT ((30 30), (3 3)) GEOMETRYCOLLECTION (POINT (40 40), POINT (50 50))";
+    SFGeometryEnvelope *envelope = [SFGeometryEnvelope envelopeWithMinXDouble:0 andMinYDouble:0 andMaxXDouble:10 andMaxYDouble:10];
+    
+    NSArray<NSString *> *expected = @[@"POINT (1 1)", @"LINESTRING (-5 5, 5 -5)", @"MULTIPOINT ((30 30), (3 3))"];
+    
+    NSArray<SFWTGeometryReader *> *readers = @[
+        [[SFWTGeometryReader alloc] initWithText:text],
+        [[SFWTGeometryReader alloc] initWithReader:[[SFTextReader alloc] initWithText:text]]
+    ];
+    for(SFWTGeometryReader *reader in readers){
+        NSMutableArray<SFGeometry *> *geometries = [reader readAllWithEnvelope:envelope];
+        [SFWTTestUtils assertEqualIntWithValue:(int)expected.count andValue2:(int)geometries.count];
+        for(int i = 0; i < expected.count; i++){
+            [SFWTTestUtils assertEqualWithValue:expected[i] andValue2:[SFWTGeometryWriter writeGeometry:geometries[i]]];
+        }
+    }
+    
+    SFWTGeometryReader *reader = [[SFWTGeometryReader alloc] initWithText:@"LINESTRING (20 20, 30 30) POINT (5 5)"];
+    [SFWTTestUtils assertTrue:[reader skipDisjointWithEnvelope:envelope]];
+    [SFWTTestUtils assertFalse:[reader skipDisjointWithEnvelope:envelope]];
+    [SFWTTestUtils assertEqualWithValue:@"POINT (5 5)" andValue2:[SFWTGeometryWriter writeGeometry:[reader read]]];
+    
+    [SFWTTestUtils assertNil:[SFWTGeometryReader readGeometryWithText:@"POLYGON ((20 20, 30 20, 30 30, 20 20))" andEnvelope:envelope]];
+    [SFWTTestUtils assertNotNil:[SFWTGeometryReader readGeometryWithText:@"POLYGON ((-20 -20, 30 -20, 30 30, -20 -20))" andEnvelope:envelope]];
+    XCTAssertThrows([SFWTGeometryReader readGeometryWithText:@"LINESTRING (20 20, 30" andEnvelope:envelope]);
+    
+    // Arc apex at (5 5) is the only part within the window
+    SFGeometryEnvelope *apex = [SFGeometryEnvelope envelopeWithMinXDouble:4 andMinYDouble:4 andMaxXDouble:6 andMaxYDouble:6];
+    SFGeometryEnvelope *above = [SFGeometryEnvelope envelopeWithMinXDouble:4 andMinYDouble:6 andMaxXDouble:6 andMaxYDouble:8];
+    NSArray<NSString *> *curves = @[
+        @"CIRCULARSTRING (0 0, 1 3, 10 0)",
+        @"CIRCULARSTRING Z (0 0 1, 1 3 1, 10 0 1)",
+        @"COMPOUNDCURVE ((-10 0, 0 0), CIRCULARSTRING (0 0, 1 3, 10 0))",
+        @"CURVEPOLYGON (COMPOUNDCURVE (CIRCULARSTRING (0 0, 1 3, 10 0), (10 0, 0 0)))",
+        @"MULTICURVE (CIRCULARSTRING EMPTY, (0 0, 1 3), CIRCULARSTRING (0 0, 1 3, 10 0))"
+    ];
+    for(NSString *curve in curves){
+        [SFWTTestUtils assertNotNil:[SFWTGeometryReader readGeometryWithText:curve andEnvelope:apex]];
+        [SFWTTestUtils assertNil:[SFWTGeometryReader readGeometryWithText:curve andEnvelope:above]];
+        [SFWTTestUtils assertNotNil:[[[SFWTGeometryReader alloc] initWithReader:[[SFTextReader alloc] initWithText:curve]] readWithEnvelope:apex]];
+        double bounds[4];
+        [SFWTTestUtils assertTrue:[[[SFWTGeometryReader alloc] initWithText:curve] readBounds:bounds]];
+        [SFWTTestUtils assertEqualDoubleWithValue:5 andValue2:bounds[3] andDelta:0.0000001];
+    }
+    [SFWTTestUtils assertNil:[SFWTGeometryReader readGeometryWithText:@"MULTICURVE (CIRCULARSTRING EMPTY, (0 0, 1 3, 10 0))" andEnvelope:apex]];
+    
+}
+
+-(void) testSpatialIndex{
+    
+    NSMutableString *text = [NSMutableString string];
+    for(int x = 0; x < 30; x++){
+        for(int y = 0; y < 30; y++){
+            [text appendFormat:@"POLYGON ((%d %d, %d.5 %d, %d.5 %d.5, %d %d))\n", x, y, x, y, x, y, x, y];
+        }
+    }
+    [text appendString:@"POINT EMPTY\nLINESTRING Z (100 100 1, 101 101 2)\n"];
+    
+    SFWTSpatialIndex *index = [[SFWTSpatialIndex alloc] initWithText:text andNodeCapacity:4];
+    [SFWTTestUtils assertEqualIntWithValue:901 andValue2:(int)[index count]];
+    
+    SFGeometryEnvelope *envelope = [SFGeometryEnvelope envelopeWithMinXDouble:10.2 andMinYDouble:20.2 andMaxXDouble:11.2 andMaxYDouble:20.7];
+    NSIndexSet *records = [index recordsIntersectingEnvelope:envelope];
+    NSMutableIndexSet *expected = [NSMutableIndexSet indexSet];
+    [expected addIndex:10 * 30 + 20];
+    [expected addIndex:11 * 30 + 20];
+    [SFWTTestUtils assertTrue:[expected isEqualToIndexSet:records]];
+    
+    NSArray<SFGeometry *> *geometries = [index geometriesIntersectingEnvelope:envelope inText:text];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:(int)geometries.count];
+    [SFWTTestUtils assertEqualWithValue:@"POLYGON ((10 20, 10.5 20, 10.5 20.5, 10 20))" andValue2:[SFWTGeometryWriter writeGeometry:geometries[0]]];
+    
+    NSRange range = [index rangeOfRecord:901];
+    [SFWTTestUtils assertEqualWithValue:@"LINESTRING Z (100 100 1, 101 101 2)" andValue2:[[text substringWithRange:range] stringByTrimmingCharactersInSet:[NSCharacterSet whitespaceAndNewlineCharacterSet]]];
+    [SFWTTestUtils assertEqualIntWithValue:(int)NSNotFound andValue2:(int)[index rangeOfRecord:900].location];
+    
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSUUID UUID] UUIDString]];
+    NSError *error = nil;
+    [SFWTTestUtils assertTrue:[index writeToFile:path error:&error]];
+    SFWTSpatialIndex *loaded = [SFWTSpatialIndex indexWithPath:path error:&error];
+    [SFWTTestUtils assertEqualIntWithValue:901 andValue2:(int)[loaded count]];
+    [SFWTTestUtils assertTrue:[records isEqualToIndexSet:[loaded recordsIntersectingEnvelope:envelope]]];
+    [SFWTTestUtils assertEqualIntWithValue:0 andValue2:(int)[loaded recordsIntersectingEnvelope:[SFGeometryEnvelope envelopeWithMinXDouble:50 andMinYDouble:50 andMaxXDouble:60 andMaxYDouble:60]].count];
+    [[NSFileManager defaultManager] removeItemAtPath:path error:nil];
+    
+    [SFWTTestUtils assertEqualIntWithValue:0 andValue2:(int)[[SFWTSpatialIndex indexWithText:@"POINT EMPTY"] recordsIntersectingEnvelope:envelope].count];
+    XCTAssertThrowsSpecificNamed([[SFWTSpatialIndex alloc] initWithData:[@"SFWTSIDX" dataUsingEncoding:NSASCIIStringEncoding]], NSException, @"Invalid Spatial Index");
+    
+}
+
+-(void) testDimensionProjection{
+    
+    NSArray<NSArray *> *cases = @[
+        @[@"LINESTRING ZM (1 2 3 4, 5 6 7 8)", @"LINESTRING (1 2, 5 6)", @(SFWT_DIMENSIONS_FORCE_2D)],
+        @[@"POINT ZM (1 2 3 4)", @"POINT Z (1 2 3)", @(SFWT_DIMENSIONS_DROP_M)],
+        @[@"LINESTRING (1 2 3 4, 5 6 7 8)", @"LINESTRING M (1 2 4, 5 6 8)", @(SFWT_DIMENSIONS_DROP_Z)],
+        @[@"POLYGON ((0 0, 1 0, 1 1, 0 0))", @"POLYGON Z ((0 0 0, 1 0 0, 1 1 0, 0 0 0))", @(SFWT_DIMENSIONS_PAD_Z)],
+        @[@"GEOMETRYCOLLECTION ZM (POINT ZM (1 2 3 4))", @"GEOMETRYCOLLECTION (POINT (1 2))", @(SFWT_DIMENSIONS_FORCE_2D)],
+        @[@"MULTIPOINT Z ((1 2 3))", @"MULTIPOINT Z ((1 2 3))", @(SFWT_DIMENSIONS_NONE)]
+    ];
+    
+    for(NSArray *test in cases){
+        NSArray<SFWTGeometryReader *> *readers = @[
+            [[SFWTGeometryReader alloc] initWithText:test[0]],
+            [[SFWTGeometryReader alloc] initWithReader:[[SFTextReader alloc] initWithText:test[0]]]
+        ];
+        for(SFWTGeometryReader *reader in readers){
+            [reader setDimensionOptions:[test[2] unsignedIntegerValue]];
+            [SFWTTestUtils assertEqualWithValue:test[1] andValue2:[SFWTGeometryWriter writeGeometry:[reader read]]];
+        }
+    }
+    
+    SFWTGeometryReader *reader = [[SFWTGeometryReader alloc] initWithText:@"POINT Z (1 2 3)"];
+    [reader setDimensionOptions:SFWT_DIMENSIONS_DROP_Z | SFWT_DIMENSIONS_PAD_M];
+    [reader setPadValue:-1];
+    SFPoint *point = (SFPoint *)[reader read];
+    [SFWTTestUtils assertFalse:point.hasZ];
+    [SFWTTestUtils assertTrue:point.hasM];
+    [SFWTTestUtils assertEqualDoubleWithValue:-1 andValue2:[point.m doubleValue]];
+    
+}
+
+-(void) testQuantizedReader{
+    
+    SFWTQuantizedReader *reader = [[SFWTQuantizedReader alloc] initWithText:@"LINESTRING (0.01 0.02, 0.011 0.021, 1.5 2.5) POINT EMPTY POLYGON Z ((0 0 1, 10 0 1, 10 10 1, 0 0 1), (1 1 1, 2 1 1, 2 2 1, 1 1 1))"];
+    [reader setScale:10 andOffsetX:0 andOffsetY:0];
+    [reader setDropDuplicates:YES];
+    
+    NSMutableData *coordinates = [NSMutableData data];
+    NSMutableData *counts = [NSMutableData data];
+    [SFWTTestUtils assertTrue:[reader readToCoordinates:coordinates andCounts:counts]];
+    [SFWTTestUtils assertEqualIntWithValue:SF_LINESTRING andValue2:[reader geometryType]];
+    [SFWTTestUtils assertEqualIntWithValue:1 andValue2:[reader numParts]];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:(int)[reader numPoints]];
+    [SFWTTestUtils assertEqualIntWithValue:1 andValue2:(int)[reader numDropped]];
+    const int32_t *values = [coordinates bytes];
+    [SFWTTestUtils assertEqualIntWithValue:4 * sizeof(int32_t) andValue2:(int)coordinates.length];
+    [SFWTTestUtils assertEqualIntWithValue:0 andValue2:values[0]];
+    [SFWTTestUtils assertEqualIntWithValue:0 andValue2:values[1]];
+    [SFWTTestUtils assertEqualIntWithValue:15 andValue2:values[2]];
+    [SFWTTestUtils assertEqualIntWithValue:25 andValue2:values[3]];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:((const uint32_t *)[counts bytes])[0]];
+    
+    [reader setWidth:SFWT_QUANTIZED_INT64];
+    [reader setGridWithEnvelope:[SFGeometryEnvelope envelopeWithMinXDouble:0 andMinYDouble:0 andMaxXDouble:10 andMaxYDouble:10] andExtent:4096];
+    coordinates = [NSMutableData data];
+    counts = [NSMutableData data];
+    [SFWTTestUtils assertTrue:[reader readToCoordinates:coordinates andCounts:counts]];
+    [SFWTTestUtils assertEqualIntWithValue:SF_POLYGON andValue2:[reader geometryType]];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:[reader numParts]];
+    [SFWTTestUtils assertEqualIntWithValue:16 * sizeof(int64_t) andValue2:(int)coordinates.length];
+    const int64_t *wide = [coordinates bytes];
+    [SFWTTestUtils assertEqualIntWithValue:4096 andValue2:(int)wide[2]];
+    [SFWTTestUtils assertEqualIntWithValue:410 andValue2:(int)wide[8]];
+    [SFWTTestUtils assertEqualIntWithValue:4 andValue2:((const uint32_t *)[counts bytes])[1]];
+    
+    [SFWTTestUtils assertFalse:[reader readToCoordinates:coordinates andCounts:counts]];
+    
+    reader = [[SFWTQuantizedReader alloc] initWithText:@"POINT (1e10 0)"];
+    XCTAssertThrowsSpecificNamed([reader readToCoordinates:[NSMutableData data] andCounts:[NSMutableData data]], NSException, @"Invalid Value");
+    
+    reader = [[SFWTQuantizedReader alloc] initWithText:@"MULTIPOLYGON (((0 0, 1 0, 1 1, 0 0)), ((2 2, 3 2, 3 3, 2 2))) CIRCULARSTRING (0 0, 1 1, 2 0) MULTILINESTRING ((0 0, 1 1), (2 2, 3 3, 4 4))"];
+    coordinates = [NSMutableData data];
+    counts = [NSMutableData data];
+    XCTAssertThrowsSpecificNamed([reader readToCoordinates:coordinates andCounts:counts], NSException, @"Unsupported Geometry");
+    XCTAssertThrowsSpecificNamed([reader readToCoordinates:coordinates andCounts:counts], NSException, @"Unsupported Geometry");
+    [SFWTTestUtils assertEqualIntWithValue:0 andValue2:(int)coordinates.length];
+    [SFWTTestUtils assertTrue:[reader readToCoordinates:coordinates andCounts:counts]];
+    [SFWTTestUtils assertEqualIntWithValue:SF_MULTILINESTRING andValue2:[reader geometryType]];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:[reader numParts]];
+    [SFWTTestUtils assertEqualIntWithValue:3 andValue2:((const uint32_t *)[counts bytes])[1]];
+    
+}
+
+-(void) testCoordinateTransform{
+    
+    __block int blocks = 0;
+    SFWTCoordinateTransform transform = ^(double *coordinates, NSUInteger count, int dimension){
+        blocks++;
+        for(NSUInteger i = 0; i < count; i++){
+            double *coordinate = coordinates + i * dimension;
+            coordinate[0] = coordinate[0] * 2 + 1;
+            coordinate[1] = coordinate[1] * 2 - 1;
+        }
+    };
+    
+    SFWTGeometryReader *reader = [[SFWTGeometryReader alloc] initWithText:@"POLYGON ((0 0, 1 0, 1 1, 0 0)) GEOMETRYCOLLECTION (POINT Z (1 1 5), LINESTRING (2 2, 3 3)) POINT (100 100)"];
+    [reader setTransform:transform];
+    [SFWTTestUtils assertEqualWithValue:@"POLYGON ((1 -1, 3 -1, 3 1, 1 -1))" andValue2:[SFWTGeometryWriter writeGeometry:[reader read]]];
+    [SFWTTestUtils assertEqualIntWithValue:1 andValue2:blocks];
+    [SFWTTestUtils assertEqualWithValue:@"GEOMETRYCOLLECTION (POINT Z (3 1 5), LINESTRING (5 3, 7 5))" andValue2:[SFWTGeometryWriter writeGeometry:[reader read]]];
+    [SFWTTestUtils assertEqualIntWithValue:3 andValue2:blocks];
+    
+    SFGeometryEnvelope *envelope = [SFGeometryEnvelope envelopeWithMinXDouble:200 andMinYDouble:198 andMaxXDouble:202 andMaxYDouble:200];
+    [SFWTTestUtils assertEqualWithValue:@"POINT (201 199)" andValue2:[SFWTGeometryWriter writeGeometry:[reader readWithEnvelope:envelope]]];
+    
+    reader = [[SFWTGeometryReader alloc] initWithText:@"MULTILINESTRING Z ((0 0 1, 1 1 1), (2 2 2, 3 3 3))"];
+    [reader setTransform:transform];
+    SFWTFlatGeometry *flatGeometry = [reader readFlat];
+    [SFWTTestUtils assertEqualWithValue:@"MULTILINESTRING Z ((1 -1 1, 3 1 1), (5 3 2, 7 5 3))" andValue2:[SFWTGeometryWriter writeGeometry:[flatGeometry geometry]]];
+    [SFWTTestUtils assertEqualIntWithValue:5 andValue2:blocks];
+    
+    // Filters see the transformed points
+    reader = [[SFWTGeometryReader alloc] initWithText:@"LINESTRING (0 0, 1 1, 2 2) MULTIPOINT ((0 0), 1 1, 2 2)"];
+    [reader setTransform:^(double *coordinates, NSUInteger count, int dimension){
+        for(NSUInteger i = 0; i < count; i++){
+            double *coordinate = coordinates + i * dimension;
+            if(coordinate[0] == 1){
+                coordinate[0] = INFINITY;
+            }
+        }
+    }];
+    SFPointFiniteFilter *filter = [[SFPointFiniteFilter alloc] init];
+    [SFWTTestUtils assertEqualWithValue:@"LINESTRING (0 0, 2 2)" andValue2:[SFWTGeometryWriter writeGeometry:[reader readWithFilter:filter]]];
+    SFMultiPoint *multiPoint = (SFMultiPoint *)[reader readWithFilter:filter];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:[multiPoint numPoints]];
+    [SFWTTestUtils assertEqualDoubleWithValue:2 andValue2:[[multiPoint pointAtIndex:1].x doubleValue]];
+    
+}
+
+-(void) testValidation{
+    
+    SFWTGeometryReader *reader = [[SFWTGeometryReader alloc] initWithText:@"POLYGON ((0 0, 1 0, 1 1, 0 1), (0 0, 1 1, 0 0)) LINESTRING (1 1) TRIANGLE ((0 0, 1 0, 1 1, 0 1, 0 0)) MULTIPOINT ((1 2), (1 2 3)) CURVEPOLYGON (CIRCULARSTRING (0 0, 1 1, 2 0, 1 -1, 0 1)) POLYGON ((0 0, 1 0, 1 1, 0 0))"];
+    [reader setValidationRules:SFWT_VALIDATE_ALL];
+    
+    [SFWTTestUtils assertNotNil:[reader read]];
+    NSArray<SFWTValidationIssue *> *issues = [reader validationIssues];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:(int)issues.count];
+    [SFWTTestUtils assertEqualIntWithValue:SFWT_VALIDATE_CLOSED_RINGS andValue2:(int)issues[0].rule];
+    [SFWTTestUtils assertEqualIntWithValue:SF_POLYGON andValue2:issues[0].geometryType];
+    [SFWTTestUtils assertEqualIntWithValue:SFWT_VALIDATE_MIN_POINTS andValue2:(int)issues[1].rule];
+    [SFWTTestUtils assertEqualIntWithValue:30 andValue2:(int)issues[0].position];
+    [SFWTTestUtils assertEqualIntWithValue:46 andValue2:(int)issues[1].position];
+    
+    [reader read];
+    [SFWTTestUtils assertEqualIntWithValue:1 andValue2:(int)[reader validationIssues].count];
+    [SFWTTestUtils assertEqualIntWithValue:SF_LINESTRING andValue2:[reader validationIssues][0].geometryType];
+    
+    [reader read];
+    [SFWTTestUtils assertEqualIntWithValue:1 andValue2:(int)[reader validationIssues].count];
+    [SFWTTestUtils assertEqualIntWithValue:SF_TRIANGLE andValue2:[reader validationIssues][0].geometryType];
+    
+    [reader read];
+    [SFWTTestUtils assertEqualIntWithValue:1 andValue2:(int)[reader validationIssues].count];
+    [SFWTTestUtils assertEqualIntWithValue:SFWT_VALIDATE_DIMENSIONS andValue2:(int)[reader validationIssues][0].rule];
+    
+    [reader read];
+    [SFWTTestUtils assertEqualIntWithValue:1 andValue2:(int)[reader validationIssues].count];
+    [SFWTTestUtils assertEqualIntWithValue:SFWT_VALIDATE_CLOSED_RINGS andValue2:(int)[reader validationIssues][0].rule];
+    
+    [reader read];
+    [SFWTTestUtils assertEqualIntWithValue:0 andValue2:(int)[reader validationIssues].count];
+    
+    reader = [[SFWTGeometryReader alloc] initWithText:@"LINESTRING (1 1, NaN 2)"];
+    [reader setValidationRules:SFWT_VALIDATE_FINITE];
+    [reader setValidationFailFast:YES];
+    XCTAssertThrowsSpecificNamed([reader read], NSException, SFWT_VALIDATION_FAILED);
+    
+    [SFWTTestUtils assertEqualIntWithValue:0 andValue2:(int)[[SFWTGeometryReader alloc] initWithText:@"LINESTRING (1 1)"].validationIssues.count];
+    
+}
+
+-(void) testCurveLinearization{
+    
+    SFWTGeometryReader *reader = [[SFWTGeometryReader alloc] initWithText:@"CIRCULARSTRING (0 0, 1 1, 2 0) MULTICURVE ((0 0, 5 5), CIRCULARSTRING (0 0, 1 1, 2 0), COMPOUNDCURVE (CIRCULARSTRING (0 0, 1 1, 2 0), (2 0, 3 0))) MULTISURFACE (CURVEPOLYGON (CIRCULARSTRING (0 0, 2 0, 0 0)), ((0 0, 1 0, 1 1, 0 0)), TIN Z (((0 0 0, 1 0 0, 0 1 0, 0 0 0))))"];
+    [reader setLinearizer:[[SFWTArcLinearizer alloc] initWithSegmentsPerQuadrant:2]];
+    
+    SFLineString *lineString = (SFLineString *)[reader read];
+    [SFWTTestUtils assertEqualIntWithValue:SF_LINESTRING andValue2:lineString.geometryType];
+    [SFWTTestUtils assertEqualIntWithValue:5 andValue2:[lineString numPoints]];
+    [SFWTTestUtils assertEqualDoubleWithValue:1.0 andValue2:[[lineString pointAtIndex:2].x doubleValue] andDelta:0.0000001];
+    [SFWTTestUtils assertEqualDoubleWithValue:1.0 andValue2:[[lineString pointAtIndex:2].y doubleValue] andDelta:0.0000001];
+    
+    SFMultiLineString *multiLineString = (SFMultiLineString *)[reader read];
+    [SFWTTestUtils assertEqualIntWithValue:SF_MULTILINESTRING andValue2:multiLineString.geometryType];
+    [SFWTTestUtils assertEqualIntWithValue:3 andValue2:[multiLineString numLineStrings]];
+    [SFWTTestUtils assertEqualIntWithValue:SF_LINESTRING andValue2:[multiLineString lineStringAtIndex:2].geometryType];
+    [SFWTTestUtils assertEqualIntWithValue:6 andValue2:[[multiLineString lineStringAtIndex:2] numPoints]];
+    
+    SFMultiPolygon *multiPolygon = (SFMultiPolygon *)[reader read];
+    [SFWTTestUtils assertEqualIntWithValue:SF_MULTIPOLYGON andValue2:multiPolygon.geometryType];
+    [SFWTTestUtils assertEqualIntWithValue:3 andValue2:[multiPolygon numPolygons]];
+    [SFWTTestUtils assertEqualIntWithValue:9 andValue2:[[[multiPolygon polygonAtIndex:0] exteriorRing] numPoints]];
+    
+    reader = [[SFWTGeometryReader alloc] initWithText:@"COMPOUNDCURVE ((-2 0, 0 0), CIRCULARSTRING (0 0, 1 1, 2 0), LINESTRING (2 0, 3 0))"];
+    [reader setLinearizer:[[SFWTArcLinearizer alloc] initWithSegmentsPerQuadrant:2]];
+    lineString = (SFLineString *)[reader read];
+    [SFWTTestUtils assertEqualIntWithValue:7 andValue2:[lineString numPoints]];
+    [SFWTTestUtils assertEqualDoubleWithValue:1.0 andValue2:[[lineString pointAtIndex:3].y doubleValue] andDelta:0.0000001];
+    [SFWTTestUtils assertEqualDoubleWithValue:3.0 andValue2:[[lineString pointAtIndex:6].x doubleValue]];
+    
+    reader = [[SFWTGeometryReader alloc] initWithText:@"CIRCULARSTRING (0 0, 1 1, 2 0)"];
+    [reader setLinearizer:[[SFWTArcLinearizer alloc] initWithMaxDeviation:0.01]];
+    [SFWTTestUtils assertEqualIntWithValue:13 andValue2:[(SFLineString *)[reader read] numPoints]];
+    
+    [SFWTTestUtils assertEqualIntWithValue:SF_CIRCULARSTRING andValue2:[SFWTGeometryReader readGeometryWithText:@"CIRCULARSTRING (0 0, 1 1, 2 0)"].geometryType];
+    
+}
+
+-(void) testArityLock{
+    
+    NSString *text = @"LINESTRING (1 2 3, 4 5 6, 7 8, 9 10 11 12, 13 14 15 16) CIRCULARSTRING (0 0, 1 1 1, 2 0 2)";
+    NSArray<SFWTGeometryReader *> *readers = @[
+        [[SFWTGeometryReader alloc] initWithText:text],
+        [[SFWTGeometryReader alloc] initWithReader:[[SFTextReader alloc] initWithText:text]]
+    ];
+    for(SFWTGeometryReader *reader in readers){
+        SFLineString *lineString = (SFLineString *)[reader read];
+        [SFWTTestUtils assertEqualIntWithValue:5 andValue2:[lineString numPoints]];
+        [SFWTTestUtils assertEqualDoubleWithValue:6 andValue2:[[lineString pointAtIndex:1].z doubleValue]];
+        [SFWTTestUtils assertNil:[lineString pointAtIndex:2].z];
+        [SFWTTestUtils assertEqualDoubleWithValue:8 andValue2:[[lineString pointAtIndex:2].y doubleValue]];
+        [SFWTTestUtils assertEqualDoubleWithValue:12 andValue2:[[lineString pointAtIndex:3].m doubleValue]];
+        [SFWTTestUtils assertEqualDoubleWithValue:16 andValue2:[[lineString pointAtIndex:4].m doubleValue]];
+        [SFWTTestUtils assertTrue:lineString.hasZ];
+        [SFWTTestUtils assertTrue:lineString.hasM];
+        SFCircularString *circularString = (SFCircularString *)[reader read];
+        [SFWTTestUtils assertNil:[circularString pointAtIndex:0].z];
+        [SFWTTestUtils assertEqualDoubleWithValue:1 andValue2:[[circularString pointAtIndex:1].z doubleValue]];
+        [SFWTTestUtils assertEqualDoubleWithValue:2 andValue2:[[circularString pointAtIndex:2].z doubleValue]];
+        [SFWTTestUtils assertTrue:circularString.hasZ];
+        [SFWTTestUtils assertFalse:circularString.hasM];
+    }
+    
+    SFLineString *lineString = (SFLineString *)[SFWTGeometryReader readGeometryWithText:@"LINESTRING (1 2, 3 4 5)"];
+    [SFWTTestUtils assertTrue:lineString.hasZ];
+    [SFWTTestUtils assertFalse:lineString.hasM];
+    [SFWTTestUtils assertEqualDoubleWithValue:5 andValue2:[[lineString pointAtIndex:1].z doubleValue]];
+    NSString *written = [SFWTGeometryWriter writeGeometry:lineString];
+    [SFWTTestUtils assertTrue:[written hasPrefix:@"LINESTRING Z "]];
+    [SFWTTestUtils assertTrue:[written rangeOfString:@"3 4 5"].location != NSNotFound];
+    
+    XCTAssertThrows([SFWTGeometryReader readGeometryWithText:@"LINESTRING (1 2, 3 4 5 6 7)"]);
+    XCTAssertThrows([SFWTGeometryReader readGeometryWithReader:[[SFTextReader alloc] initWithText:@"LINESTRING (1 2, 3 4 (5)"]]);
+    
+    // Locked points are read without look ahead, peeks do not grow with the points
+    SFWTPeekCountingTextReader *shortReader = [[SFWTPeekCountingTextReader alloc] initWithText:@"LINESTRING (1 2 3, 4 5 6, 7 8)"];
+    [SFWTTestUtils assertEqualIntWithValue:3 andValue2:[(SFLineString *)[SFWTGeometryReader readGeometryWithReader:shortReader] numPoints]];
+    SFWTPeekCountingTextReader *longReader = [[SFWTPeekCountingTextReader alloc] initWithText:@"LINESTRING (1 2 3, 4 5 6, 7 8, 1 2 3, 4 5 6 7, 8 9, 1 2 3, 4 5 6, 7 8)"];
+    [SFWTTestUtils assertEqualIntWithValue:9 andValue2:[(SFLineString *)[SFWTGeometryReader readGeometryWithReader:longReader] numPoints]];
+    [SFWTTestUtils assertEqualIntWithValue:shortReader.peeks andValue2:longReader.peeks];
+    
+}
+
+-(void) testTextNormalizer{
+    
+    NSArray<NSString *> *texts = @[
+        @"point(1 2)",
+        @"POINTZM(0 0 0 0)",
+        @"POINT(0 0 0)",
+        @"MultiPoint(1 2, 3 4)",
+        @"MULTIPOINTM(0 0 0,1 2 1)",
+        @"LINESTRING  (0.10000000000000001 2 , 1e3 -4)",
+        @"POLYGON((0 0,1 0,1 1,0 0),EMPTY)",
+        @"GEOMETRYCOLLECTION(POINT EMPTY,LINESTRING Z(0 0 1,1 1 2),POINT(1 2))",
+        @"MULTICURVE((0 0,1 1),CIRCULARSTRING(0 0,1 1,2 0))",
+        @"MULTISURFACE(((0 0,1 0,1 1,0 0)),CURVEPOLYGON((0 0,1 0,1 1,0 0)))",
+        @"COMPOUNDCURVE((0 0,0.25 0),CIRCULARSTRING(0.25 0,0.5 0.25,0.75 0))",
+        @"TIN(((0 0 0,1 0 0,0 1 0,0 0 0)))",
+        @"GEOMETRYCOLLECTION(POINT EMPTY)"
+    ];
+    
+    for(NSString *text in texts){
+        [SFWTTestUtils assertEqualWithValue:[SFWTGeometryWriter writeGeometry:[SFWTGeometryReader readGeometryWithText:text]] andValue2:[SFWTTextNormalizer normalizedTextWithText:text]];
+    }
+    
+    [SFWTTestUtils assertNil:[SFWTTextNormalizer normalizedTextWithText:@"POINT EMPTY"]];
+    
+    SFWTTextNormalizer *normalizer = [[SFWTTextNormalizer alloc] initWithText:@"point(1 2) linestringz(0 0 0,1 1 1)"];
+    [SFWTTestUtils assertEqualWithValue:@"POINT (1 2)" andValue2:[normalizer write]];
+    [SFWTTestUtils assertEqualWithValue:@"LINESTRING Z (0 0 0, 1 1 1)" andValue2:[normalizer write]];
+    [SFWTTestUtils assertNil:[normalizer write]];
+    
+}
+
+-(void) testGeometryFingerprint{
+    
+    SFWTFingerprint fingerprint = [SFWTGeometryFingerprint fingerprintWithText:@"MULTIPOINT Z ((1 2 3), (4 5 6))"];
+    
+    NSArray<NSString *> *same = @[
+        @"multipointz((1.0 2 3),(4 5 6))",
+        @"MULTIPOINT (1 2 3, 4e0 5 6)",
+        @"  MultiPoint  Z ( ( 1 2 3 ) , ( 4 5.000 6 ) )  "
+    ];
+    for(NSString *text in same){
+        [SFWTTestUtils assertTrue:[SFWTGeometryFingerprint isFingerprint:fingerprint equalToFingerprint:[SFWTGeometryFingerprint fingerprintWithText:text]]];
+    }
+    
+    NSArray<NSString *> *different = @[
+        @"MULTIPOINT M ((1 2 3), (4 5 6))",
+        @"MULTIPOINT Z ((1 2 3), (4 5 6.0000001))",
+        @"LINESTRING Z (1 2 3, 4 5 6)",
+        @"MULTIPOINT Z ((1 2 3))",
+        @"MULTIPOINT Z ((4 5 6), (1 2 3))"
+    ];
+    for(NSString *text in different){
+        [SFWTTestUtils assertFalse:[SFWTGeometryFingerprint isFingerprint:fingerprint equalToFingerprint:[SFWTGeometryFingerprint fingerprintWithText:text]]];
+    }
+    
+    [SFWTTestUtils assertTrue:[SFWTGeometryFingerprint isFingerprint:[SFWTGeometryFingerprint fingerprintWithText:@"POINT (1.00001 2)" andTolerance:0.001] equalToFingerprint:[SFWTGeometryFingerprint fingerprintWithText:@"POINT (0.99999 2)" andTolerance:0.001]]];
+    [SFWTTestUtils assertTrue:[SFWTGeometryFingerprint hashWithText:@"POINT (1 2)"] != [SFWTGeometryFingerprint hashWithText:@"POINT (2 1)"]];
+    [SFWTTestUtils assertTrue:[SFWTGeometryFingerprint hashWithText:@"POINT EMPTY"] == 0];
+    
+    SFWTGeometryFingerprint *geometryFingerprint = [[SFWTGeometryFingerprint alloc] initWithText:@"POINT (1 2) point(1.0 2.0)"];
+    SFWTFingerprint first;
+    SFWTFingerprint second;
+    [SFWTTestUtils assertTrue:[geometryFingerprint readFingerprint:&first]];
+    [SFWTTestUtils assertTrue:[geometryFingerprint readFingerprint:&second]];
+    [SFWTTestUtils assertFalse:[geometryFingerprint readFingerprint:&second]];
+    [SFWTTestUtils assertTrue:[SFWTGeometryFingerprint isFingerprint:first equalToFingerprint:second]];
+    
+}
+
+-(void) testTextComparator{
+    
+    [SFWTTestUtils assertTrue:[SFWTTextComparator isEqualWithExpected:@"MULTIPOINT Z ((1 2 3), (4 5 6))" andActual:@"multipointz(1.0 2 3,4 5 6)" andDelta:0]];
+    [SFWTTestUtils assertTrue:[SFWTTextComparator isEqualWithExpected:@"POINT (1 2)" andActual:@"POINT (1.0001 2)" andDelta:0.001]];
+    [SFWTTestUtils assertFalse:[SFWTTextComparator isEqualWithExpected:@"POINT (1 2)" andActual:@"POINT (1.01 2)" andDelta:0.001]];
+    
+    SFWTTextDifference *difference = [SFWTTextComparator differenceWithExpected:@"GEOMETRYCOLLECTION (POINT (0 0), POLYGON ((0 0, 1 0, 1 1, 0 0), (0.2 0.1, 0.8 0.1, 0.8 0.7, 0.2 0.1)))" andActual:@"GEOMETRYCOLLECTION (POINT (0 0), POLYGON ((0 0, 1 0, 1 1, 0 0), (0.2 0.1, 0.8 0.2, 0.8 0.7, 0.2 0.1)))" andDelta:0.01];
+    [SFWTTestUtils assertNotNil:difference];
+    [SFWTTestUtils assertEqualIntWithValue:SFWT_DIFFERENCE_COORDINATE andValue2:(int)difference.type];
+    [SFWTTestUtils assertEqualWithValue:@"geometry 0 → geometry 1 → ring 1 → vertex 1" andValue2:difference.pathDescription];
+    NSArray<NSNumber *> *path = @[@0, @1, @1, @1];
+    [SFWTTestUtils assertEqualWithValue:path andValue2:difference.path];
+    
+    difference = [SFWTTextComparator differenceWithExpected:@"LINESTRING (0 0, 1 1, 2 2)" andActual:@"LINESTRING (0 0, 1 1)" andDelta:0];
+    [SFWTTestUtils assertEqualIntWithValue:SFWT_DIFFERENCE_COUNT andValue2:(int)difference.type];
+    [SFWTTestUtils assertEqualWithValue:@"geometry 0 → vertex 2" andValue2:difference.pathDescription];
+    
+    difference = [SFWTTextComparator differenceWithExpected:@"POINT (1 2) POINT Z (1 2 3)" andActual:@"POINT (1 2) POINT (1 2)" andDelta:0];
+    [SFWTTestUtils assertEqualIntWithValue:SFWT_DIFFERENCE_DIMENSIONS andValue2:(int)difference.type];
+    [SFWTTestUtils assertEqualWithValue:@"geometry 1 → vertex 0" andValue2:difference.pathDescription];
+    
+    difference = [SFWTTextComparator differenceWithExpected:@"POINT (1 2)" andActual:@"LINESTRING (1 2, 3 4)" andDelta:0];
+    [SFWTTestUtils assertEqualIntWithValue:SFWT_DIFFERENCE_TYPE andValue2:(int)difference.type];
+    
+    difference = [SFWTTextComparator differenceWithExpected:@"POINT (1 2)" andActual:@"POINT (1 2) POINT (3 4)" andDelta:0];
+    [SFWTTestUtils assertEqualIntWithValue:SFWT_DIFFERENCE_COUNT andValue2:(int)difference.type];
+    
+}
+
+-(void) testDelimitedReader{
+    
+    NSString *csv = @"id,name,wkt\r\n1,first,\"POINT (1 2)\"\r\n2,\"a, \"\"quoted\"\" name\",\"LINESTRING (0 0, 1 1)\"\r\n\r\n3,empty,\r\n4,last,POINT Z (3 4 5)";
+    SFWTDelimitedReader *reader = [[SFWTDelimitedReader alloc] initWithData:[csv dataUsingEncoding:NSUTF8StringEncoding] andDelimiter:SFWT_CSV_DELIMITER andColumnName:@"wkt"];
+    [reader setBatchSize:2];
+    [SFWTTestUtils assertEqualIntWithValue:2 andValue2:(int)[reader column]];
+    
+    NSArray<SFWTDelimitedRecord *> *records = [reader readAll];
+    [SFWTTestUtils assertEqualIntWithValue:4 andValue2:(int)records.count];
+    for(NSUInteger i = 0; i < records.count; i++){
+        [SFWTTestUtils assertEqualIntWithValue:(int)i andValue2:(int)[records objectAtIndex:i].row];
+    }
+    [SFWTTestUtils assertEqualWithValue:[SFWTGeometryReader readGeometryWithText:@"POINT (1 2)"] andValue2:[records objectAtIndex:0].geometry];
+    [SFWTTestUtils assertEqualWithValue:[SFWTGeometryReader readGeometryWithText:@"LINESTRING (0 0, 1 1)"] andValue2:[records objectAtIndex:1].geometry];
+    [SFWTTestUtils assertNil:[records objectAtIndex:2].geometry];
+    [SFWTTestUtils assertEqualWithValue:[SFWTGeometryReader readGeometryWithText:@"POINT Z (3 4 5)"] andValue2:[records objectAtIndex:3].geometry];
+    [SFWTTestUtils assertNil:[reader readBatch]];
+    
+    NSString *tsv = @"POLYGON ((0 0, 1 0, 1 1, 0 0))\t7\nPOINT (5 6)\t8\n";
+    reader = [[SFWTDelimitedReader alloc] initWithData:[tsv dataUsingEncoding:NSUTF8StringEncoding] andDelimiter:SFWT_TSV_DELIMITER andColumn:0 andHeader:NO];
+    SFWTDelimitedRecord *first = [[reader readBatch] firstObject];
+    [SFWTTestUtils assertEqualIntWithValue:SF_POLYGON andValue2:(int)first.geometry.geometryType];
+    
+    reader = [[SFWTDelimitedReader alloc] initWithData:[@"id,wkt\n1,POINT (1 2)\n2,POINT (1" dataUsingEncoding:NSUTF8StringEncoding] andDelimiter:SFWT_CSV_DELIMITER andColumn:1 andHeader:YES];
+    XCTAssertThrows([reader readAll]);
+    
+    XCTAssertThrowsSpecificNamed([[SFWTDelimitedReader alloc] initWithData:[csv dataUsingEncoding:NSUTF8StringEncoding] andDelimiter:SFWT_CSV_DELIMITER andColumnName:@"geometry"], NSException, @"Invalid Column");
+    
+    reader = [[SFWTDelimitedReader alloc] initWithData:[csv dataUsingEncoding:NSUTF8StringEncoding] andDelimiter:SFWT_CSV_DELIMITER andColumnName:@"wkt"];
+    [reader setBatchSize:1];
+    [reader setLimits:[SFWTReaderLimits limitsWithMaxDepth:0 andMaxCoordinates:0 andMaxBytes:11 andMaxAllocation:0]];
+    [SFWTTestUtils assertEqualWithValue:[SFWTGeometryReader readGeometryWithText:@"POINT (1 2)"] andValue2:[[reader readBatch] firstObject].geometry];
+    XCTAssertThrowsSpecificNamed([reader readBatch], NSException, SFWT_LIMIT_EXCEEDED);
+    
+}
+
+-(void) testCompressedGeometryStreams{
+    
+    NSArray<NSString *> *texts = @[
+        @"POINT (1 2)",
+        @"LINESTRING Z (0 0 1, 1 1 2, 2 2 3)",
+        @"POLYGON ((0 0, 10 0, 10 10, 0 0), (1 1, 2 1, 2 2, 1 1))",
+        @"GEOMETRYCOLLECTION (POINT (3 4), MULTIPOINT ((5 6), (7 8)))"
+    ];
+    
+    for(NSNumber *format in @[[NSNumber numberWithInteger:SFWT_COMPRESSION_GZIP], [NSNumber numberWithInteger:SFWT_COMPRESSION_ZLIB], [NSNumber numberWithInteger:SFWT_COMPRESSION_NONE]]){
+        
+        NSOutputStream *outputStream = [NSOutputStream outputStreamToMemory];
+        SFWTCompressedGeometryWriter *writer = [[SFWTCompressedGeometryWriter alloc] initWithStream:outputStream andFormat:[format integerValue] andLevel:-1];
+        for(int i = 0; i < 100; i++){
+            [writer write:[SFWTGeometryReader readGeometryWithText:[texts objectAtIndex:i % texts.count]]];
+        }
+        [writer writeText:@"POINT EMPTY\n"];
+        [writer close];
+        NSData *data = [outputStream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+        
+        SFWTCompressedGeometryReader *reader = [[SFWTCompressedGeometryReader alloc] initWithData:data];
+        [reader setBufferSize:100];
+        NSArray<SFGeometry *> *geometries = [reader readAll];
+        [SFWTTestUtils assertEqualIntWithValue:(int)[format integerValue] andValue2:(int)[reader format]];
+        [SFWTTestUtils assertEqualIntWithValue:100 andValue2:(int)geometries.count];
+        for(int i = 0; i < geometries.count; i++){
+            [SFWTTestUtils assertEqualWithValue:[SFWTGeometryReader readGeometryWithText:[texts objectAtIndex:i % texts.count]] andValue2:[geometries objectAtIndex:i]];
+        }
+        [SFWTTestUtils assertNil:[reader read]];
+        
+    }
+    
+    NSOutputStream *outputStream = [NSOutputStream outputStreamToMemory];
+    SFWTCompressedGeometryWriter *writer = [[SFWTCompressedGeometryWriter alloc] initWithStream:outputStream];
+    [writer writeText:@"POINT (1 2) LINESTRING (0 0, 1 1)"];
+    [writer close];
+    NSData *data = [outputStream propertyForKey:NSStreamDataWrittenToMemoryStreamKey];
+    NSData *truncated = [data subdataWithRange:NSMakeRange(0, data.length - 12)];
+    XCTAssertThrows([[[SFWTCompressedGeometryReader alloc] initWithData:truncated] readAll]);
+    
+    SFWTCompressedGeometryReader *reader = [[SFWTCompressedGeometryReader alloc] initWithData:data];
+    [reader setLimits:[SFWTReaderLimits limitsWithMaxDepth:0 andMaxCoordinates:0 andMaxBytes:10 andMaxAllocation:0]];
+    XCTAssertThrowsSpecificNamed([reader readAll], NSException, SFWT_LIMIT_EXCEEDED);
+    
+}
+
+-(void) nanOrdinatesTester: (SFLineString *) lineString withPartial: (SFLineString *) partial{
+    
+    [SFWTTestUtils assertNotNil:[lineString pointAtIndex:0].z];
+    [SFWTTestUtils assertTrue:isnan([[lineString pointAtIndex:0].z doubleValue])];
+    [SFWTTestUtils assertEqualDoubleWithValue:5 andValue2:[[lineString pointAtIndex:1].z doubleValue]];
+    
+    [SFWTTestUtils assertNil:[partial pointAtIndex:0].z];
+    [SFWTTestUtils assertNotNil:[partial pointAtIndex:1].z];
+    [SFWTTestUtils assertTrue:isnan([[partial pointAtIndex:1].z doubleValue])];
+    
+}
+
 -(void) geometryTextTester: (NSString *) text{
     [self geometryTextTester:text withExpected:text];
 }